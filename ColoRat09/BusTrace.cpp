@@ -0,0 +1,133 @@
+/******************************************************************************
+*		   File: BusTrace.cpp
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/21
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+#include <chrono>
+
+#include "BusTrace.h"
+
+
+//*****************************************************************************
+//	BusTrace()
+//*****************************************************************************
+//	Sets up an empty ring of at least capacity records, rounded up to a power
+// of 2. Records made before Open() are held in the ring for the writer,
+// and only dropped once it is full.
+//*****************************************************************************
+BusTrace::BusTrace(uint32_t capacity)
+{
+	uint32_t size = 1;
+
+	while ((size < capacity) && (size < 0x80000000))
+		size <<= 1;
+
+	ring = new RECORD[size];
+	mask = size - 1;
+	head = 0;
+	tail = 0;
+	tailSeen = 0;
+	dropped = 0;
+
+	file = nullptr;
+	running = false;
+}
+
+
+//*****************************************************************************
+//	~BusTrace()
+//*****************************************************************************
+//	Flushes what is left to the file and stops the writer.
+//*****************************************************************************
+BusTrace::~BusTrace()
+{
+	Close();
+	delete[] ring;
+}
+
+
+//*****************************************************************************
+//	Open()
+//*****************************************************************************
+//	Creates fileName, writes the header and starts the writer thread.
+//*****************************************************************************
+//	Returns:
+//	bool - false if a trace is already open or the file can't be created.
+//*****************************************************************************
+bool BusTrace::Open(const char* fileName)
+{
+	if (file != nullptr)
+		return(false);
+
+	file = std::fopen(fileName, "wb");
+	if (file == nullptr)
+		return(false);
+
+	HEADER header = { { 'C', '0', '9', 'T' }, VERSION, sizeof(RECORD) };
+	std::fwrite(&header, sizeof(header), 1, file);
+
+	running = true;
+	writer = std::thread(&BusTrace::Drain, this);
+	return(true);
+}
+
+
+//*****************************************************************************
+//	Close()
+//*****************************************************************************
+//	Stops the writer once it has emptied the ring, and closes the file. The
+// CPU should not be recording while this runs.
+//*****************************************************************************
+void BusTrace::Close()
+{
+	if (file == nullptr)
+		return;
+
+	running = false;
+	writer.join();
+	std::fclose(file);
+	file = nullptr;
+}
+
+
+//*****************************************************************************
+//	Drain()
+//*****************************************************************************
+//	Writer thread. Writes out everything between tail and head, as at most
+// two runs when it wraps, then hands the slots back. Sleeps a little when
+// the ring is empty.
+//*****************************************************************************
+void BusTrace::Drain()
+{
+	for (;;)
+	{
+		bool stopping = !running.load(std::memory_order_acquire);
+		uint32_t from = tail.load(std::memory_order_relaxed);
+		uint32_t to = head.load(std::memory_order_acquire);
+
+		if (from == to)
+		{
+			if (stopping)
+				break;
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			continue;
+		}
+
+		while (from != to)
+		{
+			uint32_t start = from & mask;
+			uint32_t count = ((to - from) < (mask + 1 - start)) ? (to - from) : (mask + 1 - start);
+
+			std::fwrite(&ring[start], sizeof(RECORD), count, file);
+			from += count;
+		}
+		tail.store(to, std::memory_order_release);
+	}
+
+	std::fflush(file);
+}
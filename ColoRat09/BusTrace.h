@@ -0,0 +1,110 @@
+/******************************************************************************
+*		   File: BusTrace.h
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/21
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+
+
+//*****************************************************************************
+//	Bus cycle trace for one CPU. The CPU thread is the only producer and
+// Record() is a handful of stores into a ring buffer; a writer thread started
+// by Open() is the only consumer and drains the ring into a binary file.
+// Neither side ever waits on the other. When the writer falls behind the
+// ring fills and new records are dropped (and counted) rather than stalling
+// the CPU.
+//
+//	File layout, host byte order:
+//		HEADER		once
+//		RECORD		per bus cycle, in cycle order
+//	RECORD::cycle is the low 32 bits of the CPU's cycle count; a reader
+// widens it by counting wraps, since it only ever goes up.
+//*****************************************************************************
+class BusTrace
+{
+public:
+	enum FLAG : uint8_t
+	{
+		READ = (1 << 0),			// R/W line high
+		INSTRUCTION = (1 << 1),		// first fetch of an instruction
+	};
+
+	struct HEADER
+	{
+		char magic[4];				// "C09T"
+		uint16_t version;
+		uint16_t recordSize;		// sizeof(RECORD)
+	};
+
+	struct RECORD
+	{
+		uint32_t cycle;
+		uint16_t address;
+		uint8_t data;
+		uint8_t flags;				// FLAG
+	};
+
+private:
+	static const uint16_t VERSION = 1;
+
+	RECORD* ring;
+	uint32_t mask;									// capacity - 1
+
+	alignas(64) std::atomic<uint32_t> head;			// next slot Record() fills (producer)
+	uint32_t tailSeen;								// producer's last look at tail
+	std::atomic<uint64_t> dropped;					// written by the producer only
+
+	alignas(64) std::atomic<uint32_t> tail;			// next slot the writer takes (consumer)
+
+	std::FILE* file;
+	std::thread writer;
+	std::atomic<bool> running;
+
+protected:
+public:
+
+private:
+	void Drain();
+
+protected:
+public:
+	BusTrace(uint32_t capacity = 0x10000);
+	~BusTrace();
+
+	bool Open(const char* fileName);
+	void Close();
+
+	uint64_t Dropped() const { return(dropped.load(std::memory_order_relaxed)); }
+
+	void Record(const uint32_t cycle, const uint16_t address, const uint8_t data, const uint8_t flags)
+	{
+		uint32_t at = head.load(std::memory_order_relaxed);
+
+		if ((at - tailSeen) > mask)
+		{
+			tailSeen = tail.load(std::memory_order_acquire);
+			if ((at - tailSeen) > mask)
+			{
+				dropped.store(dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+				return;
+			}
+		}
+
+		RECORD& record = ring[at & mask];
+		record.cycle = cycle;
+		record.address = address;
+		record.data = data;
+		record.flags = flags;
+		head.store(at + 1, std::memory_order_release);
+	}
+};
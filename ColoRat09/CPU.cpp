@@ -1 +1,57 @@
 #include "CPU.h"
+
+
+//*****************************************************************************
+//	Run()
+//*****************************************************************************
+//	Runs the CPU for a batch of cycles. This default clocks one cycle at a
+// time, CPUs that can do better override it. A StopRun() is used up on the
+// way out, not on the way in, so one made early is not lost.
+//*****************************************************************************
+// Params:
+//	uint32_t	- cycles to run
+// Returns:
+//	uint32_t	- cycles actually run
+//*****************************************************************************
+uint32_t CPU::Run(uint32_t cycleBudget)
+{
+	uint32_t cycles = 0;
+
+	while ((cycles < cycleBudget) && !stopRun.load(std::memory_order_relaxed))
+	{
+		Clock();
+		++cycles;
+	}
+	stopRun.store(false, std::memory_order_relaxed);
+	return(cycles);
+}
+
+
+//*****************************************************************************
+//	AdvanceTo()
+//*****************************************************************************
+//	Brings the CPU up to a tick. Whole instructions are run, so it can finish
+// a little past it, the next call takes that off. An Idle() CPU has nothing
+// to do until something raises one of its lines, so its time just moves on.
+//*****************************************************************************
+// Params:
+//	uint64_t	- the tick to run to
+//*****************************************************************************
+void CPU::AdvanceTo(uint64_t tick)
+{
+	uint64_t cycles = CyclesTo(tick);
+
+	while ((cycles != 0) && !Idle())
+	{
+		uint32_t budget = (cycles > UINT32_MAX) ? UINT32_MAX : uint32_t(cycles);
+		uint32_t used = Run(budget);
+
+		Ran(used);
+		if (used < budget)
+			break;
+		cycles = CyclesTo(tick);
+	}
+
+	if ((reached < tick) && Idle())
+		SkipTo(tick);
+}
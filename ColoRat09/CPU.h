@@ -10,17 +10,39 @@
 ******************************************************************************/
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include "ClockedDevice.h"
 #include "MMU.h"
 
 
-class CPU
+class CPU : public ClockedDevice
 {
+protected:
+	std::atomic<bool> stopRun{ false };
+
 public:
 	virtual ~CPU() {};
 
 	virtual void Clock() = 0;
 
+	// Runs until cycleBudget cycles are used and returns the cycles actually
+	// used. It may go past the budget to finish an instruction, and may stop
+	// short of it on StopRun() or, if the implementation checks, Idle().
+	// StopRun() is cleared as Run() returns, so one made before the call
+	// still stops it.
+	virtual uint32_t Run(uint32_t cycleBudget);
+	void StopRun() { stopRun.store(true, std::memory_order_relaxed); }
+
+	// Run() in batches up to tick, or straight there while Idle().
+	void AdvanceTo(uint64_t tick) override;
+
+	// True while the CPU can make no progress until an interrupt line (or
+	// some outside event) changes: parked in a wait instruction, halted, or
+	// spinning in a known idle loop. A scheduler may skip straight to its
+	// next event rather than clock it, and Run() stops early when it sees it.
+	virtual bool Idle() { return(false); }
+
 	virtual uint8_t HardwareRESET() = 0;
 	virtual uint8_t IRQ() = 0;
 
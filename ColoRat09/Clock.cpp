@@ -10,7 +10,7 @@
 ******************************************************************************/
 #include "Clock.h"
 #include <chrono>
-#include <iostream>
+#include <cstdio>
 #include <thread>
 
 
@@ -26,18 +26,17 @@ Clock::Clock(SYS_CLOCK clockSpeed)
 {
 	primaryClock = clockSpeed;
 
-	cpuClockDivider = 1;
-	vdpClockDivider = 1;
+	slice = SYS_SLICE::slice_line;
+	sliceMicroseconds = 1000;
 
 	SetMainSpeed(clockSpeed);
 
-	// Standard TV/NTSC timing
-	vdpVSyncTime = 1/60;
-	vdpHSyncTime = 1/15000;
+	turbo = false;
+	speed = 0;
+	stop = false;
 
-	// pointer initiation
-	cpu = nullptr;
-	vdp = nullptr;
+	now = 0;
+	eventOrder = 0;
 }
 
 
@@ -51,8 +50,7 @@ Clock::Clock(SYS_CLOCK clockSpeed)
 //*****************************************************************************
 Clock::~Clock()
 {
-	cpu = nullptr;
-	vdp = nullptr;
+	devices.clear();
 }
 
 
@@ -68,158 +66,400 @@ Clock::~Clock()
 void Clock::SetMainSpeed(SYS_CLOCK clockSpeed)
 {
 	primaryClock = clockSpeed;
-	primaryCycleTime = SetSpeed(primaryClock, 1);
+	primaryRate = SetSpeed(primaryClock, 1);
 
-	cpuCycleTime = SetSpeed(primaryClock, cpuClockDivider);
-	vdpCycleTime = SetSpeed(primaryClock, vdpClockDivider);
+	// devices keep their dividers, now off the new speed. Any part of a
+	// tick a device had run into is dropped.
+	for (DEVICE& device : devices)
+		device.device->SetRate(SetSpeed(primaryClock, device.divider));
+
+	SetSliceTicks();
 }
 
 
 //*****************************************************************************
-//	Add()
+//	SetSlice()
 //*****************************************************************************
-//	Sets the memory bus (aka, MMU since the MMU handles memory mapping.)
+//	Sets how much emulated time Run() gets through between looks at the host
+// clock. Longer slices cost less to keep in step, shorter ones keep sound
+// and input closer to real time.
 //*****************************************************************************
 // Params:
-//	CPU* 	- The CPU that we need to trigger clock access for
+//	SYS_SLICE	- a scanline, a frame, or a number of microseconds
+//	uint32_t	- microseconds, for slice_us only (default 1000)
 //*****************************************************************************
-void Clock::Add(CPU* processorType, float divider)
+void Clock::SetSlice(SYS_SLICE length, uint32_t microseconds)
 {
-	cpu = processorType;
-	cpuClockDivider = divider;
+	slice = length;
+	sliceMicroseconds = (microseconds != 0) ? microseconds : 1;
+
+	SetSliceTicks();
+}
+
+
+//*****************************************************************************
+//	SetSliceTicks()
+//*****************************************************************************
+//	Works out how many ticks make up a slice, at least one. Lines and frames
+// are whole numbers of ticks, microseconds are rounded down.
+//*****************************************************************************
+void Clock::SetSliceTicks()
+{
+	switch (slice)
+	{
+	case SYS_SLICE::slice_line:		// NTSC, 15734.26 lines a second
+		sliceTicks = LINE_TICKS;
+		break;
+	case SYS_SLICE::slice_frame:	// 262 lines, as the VDG draws them
+		sliceTicks = 262 * LINE_TICKS;
+		break;
+	default:
+		sliceTicks = (uint64_t(sliceMicroseconds) * MASTER_HZ_NUM) / (uint64_t(1000000) * MASTER_HZ_DEN);
+		break;
+	}
 
-	cpuCycleTime = SetSpeed(primaryClock, cpuClockDivider);
+	if (sliceTicks == 0)
+		sliceTicks = 1;
 }
 
 
 //*****************************************************************************
 //	Add()
 //*****************************************************************************
-//	Sets the memory bus (aka, MMU since the MMU handles memory mapping.)
+//	Puts a device on the clock. Without an event it drives the rest, as a
+// CPU does, and is run in bulk up to the next event on the queue each time
+// rather than a cycle at a time. With one, event is called straight away
+// for the tick of its first event, and only then is the device run (a VDP
+// gets VdpLine()).
+//*****************************************************************************
+// Params:
+//	ClockedDevice*	- the device to clock
+//	uint32_t		- primary cycles to one device cycle (default 1)
+//	DEVICE_EVENT	- its event, nullptr for a device that drives the rest
+//*****************************************************************************
+void Clock::Add(ClockedDevice* device, uint32_t divider, DEVICE_EVENT event)
+{
+	DEVICE entry;
+
+	entry.device = device;
+	entry.event = event;
+	entry.divider = (divider != 0) ? divider : 1;
+	entry.drives = (event == nullptr);
+
+	device->SetRate(SetSpeed(primaryClock, entry.divider));
+	device->SkipTo(now);
+	devices.push_back(entry);
+	if (event != nullptr)
+	{
+		uint64_t tick = event(device, now);
+		if (tick != 0)
+			Schedule(uint32_t(devices.size() - 1), tick);
+	}
+}
+
+
+//*****************************************************************************
+//	Schedule()
+//*****************************************************************************
+//	Queues an event for a device, O(log n) in the events already queued.
 //*****************************************************************************
 // Params:
-//	VDP* 	- The Video Display Processor that we need to trigger clock access
-//				for
+//	uint32_t	- the device, its index in devices
+//	uint64_t	- the tick the event falls on
 //*****************************************************************************
-void Clock::Add(VDP* vdpType, float divider)
+void Clock::Schedule(uint32_t device, uint64_t tick)
 {
-	vdp = vdpType;
-	vdpClockDivider = divider;
+	EVENT event;
+
+	event.tick = tick;
+	event.order = eventOrder++;
+	event.device = device;
 
-	vdpCycleTime = SetSpeed(primaryClock, vdpClockDivider);
+	events.push(event);
 }
 
 
 //*****************************************************************************
 //	SetSpeed()
 //*****************************************************************************
-//	Sets the memory bus (aka, MMU since the MMU handles memory mapping.)
+//	Gives a clock speed as a ratio of the 14.31818MHz crystal. The CoCo's
+// own speeds are the crystal divided down, the rest are as near as a small
+// ratio gets.
 //*****************************************************************************
 // Params:
 //	SYS_CLOCK	- the root system clock speed designator
-//	float		- the divider for the system clock (default 1)
+//	uint32_t	- the divider for the system clock (default 1)
 // Returns:
-//	uint16_t	- The time in nanoseconds that a clock cycle should take
+//	RATIO		- ticks of the crystal to cycles of the clock, in lowest terms
 //*****************************************************************************
-uint16_t Clock::SetSpeed(SYS_CLOCK clockSpeed, float divider)
+Clock::RATIO Clock::SetSpeed(SYS_CLOCK clockSpeed, uint32_t divider)
 {
-	uint16_t cycleTime;
+	RATIO rate;
 	switch (clockSpeed)
 	{
 	case SYS_CLOCK::clk_10K:	//   10uS	0.010MHz (10KHz)
-		cycleTime = uint16_t(10000 / divider);
+		rate = { 15750, 11 };
 		break;
-	case SYS_CLOCK::clk_890K:	// 1123nS	0.89MHz (890KHz)
-		cycleTime = uint16_t( 1123 / divider);
+	case SYS_CLOCK::clk_890K:	// 1117nS	0.895MHz	crystal / 16
+		rate = { 16, 1 };
 		break;
 	case SYS_CLOCK::clk_1M:		//    1uS	1MHz
-		cycleTime = uint16_t( 1000 / divider);
+		rate = { 315, 22 };
 		break;
-	case SYS_CLOCK::clk_1M5:	//  666nS	1.5MHz
-		cycleTime = uint16_t(  666 / divider);
+	case SYS_CLOCK::clk_1M5:	//  667nS	1.5MHz
+		rate = { 105, 11 };
 		break;
-	case SYS_CLOCK::clk_1M78:	//  529nS	1.788MHz
-		cycleTime = uint16_t(  529 / divider);
+	case SYS_CLOCK::clk_1M78:	//  559nS	1.79MHz		crystal / 8
+		rate = { 8, 1 };
 		break;
 	case SYS_CLOCK::clk_2M:		//  500nS	2MHz
-		cycleTime = uint16_t(  500 / divider);
+		rate = { 315, 44 };
 		break;
 	case SYS_CLOCK::clk_3M:		//  333nS	3MHz
-		cycleTime = uint16_t(  333 / divider);
+		rate = { 105, 22 };
 		break;
 	case SYS_CLOCK::clk_4M:		//  250nS	4MHz
-		cycleTime = uint16_t(  250 / divider);
+		rate = { 315, 88 };
 		break;
-	case SYS_CLOCK::clk_4M77:	//  209nS	4.77MHz
-		cycleTime = uint16_t(  209 / divider);
+	case SYS_CLOCK::clk_4M77:	//  210nS	4.77MHz		crystal / 3
+		rate = { 3, 1 };
 		break;
-	case SYS_CLOCK::clk_6M:		//  166nS	6MHz
-		cycleTime = uint16_t(  166 / divider);
+	case SYS_CLOCK::clk_6M:		//  167nS	6MHz
+		rate = { 105, 44 };
 		break;
 	case SYS_CLOCK::clk_8M:		//  125nS	8MHz
-		cycleTime = uint16_t(  125 / divider);
+		rate = { 315, 176 };
 		break;
 	case SYS_CLOCK::clk_10M:	//  100nS	10MHz
-		cycleTime = uint16_t(  100 / divider);
+		rate = { 63, 44 };
 		break;
-	case SYS_CLOCK::clk_16M:	//   62nS	16MHz
-		cycleTime = uint16_t(   62 / divider);
+	case SYS_CLOCK::clk_16M:	//   63nS	16MHz
+		rate = { 315, 352 };
 		break;
 	default:
-		cycleTime = uint16_t( 1000 / divider);
+		rate = { 315, 22 };
 		break;
 	}
-	return(cycleTime);
+
+	rate.ticks *= divider;
+	for (uint32_t a = rate.ticks, b = rate.cycles; ; )
+	{
+		if (b == 0)
+		{
+			rate.ticks /= a;
+			rate.cycles /= a;
+			break;
+		}
+		uint32_t r = a % b;
+		a = b;
+		b = r;
+	}
+	return(rate);
 }
 
 
 //*****************************************************************************
-//	Run()
+//	Advance()
 //*****************************************************************************
-//	Runs the clock(s) triggering functionality based on the clock.
+//	Moves emulated time on. Between events every device that drives the
+// rest is brought up to the next event in one go, then the events that
+// fall due are handled, in the order they were queued when they share a
+// tick. Any other device is only run at its own events, or when the CPU
+// touches it and the MMU catches it up.
 //*****************************************************************************
 // Params:
-//	SYS_CLOCK	- the root system clock speed designator
-//	float		- the divider for the system clock (default 1)
-// Returns:
-//	uint16_t	- The time in nanoseconds that a clock cycle should take
+//	uint64_t	- ticks to move on by
 //*****************************************************************************
-bool Clock::Run()
+void Clock::Advance(uint64_t ticks)
 {
-	uint16_t time[2];
+	const uint64_t end = now + ticks;
 
-	if (vdpCycleTime <= cpuCycleTime)
+	while (now < end)
 	{
-		time[0] = vdpCycleTime;
-		time[1] = cpuCycleTime;
+		uint64_t next = end;
+		if (!events.empty() && (events.top().tick < next))
+			next = events.top().tick;
+
+		for (DEVICE& device : devices)
+			if (device.drives)
+				device.device->AdvanceTo(next);
+		now = next;
+
+		while (!events.empty() && (events.top().tick <= now))
+		{
+			EVENT event = events.top();
+			events.pop();
+
+			DEVICE& device = devices[event.device];
+			uint64_t tick = device.event(device.device, event.tick);
+			if (tick != 0)
+				Schedule(event.device, tick);
+		}
 	}
-	else
+}
+
+
+//*****************************************************************************
+//	VdpLine()
+//*****************************************************************************
+//	End of a scanline, the VDP is brought up to it. It draws nothing yet, but
+// the line events already break the CPU's runs up a scanline at a time.
+//*****************************************************************************
+// Params:
+//	ClockedDevice*	- the VDP
+//	uint64_t		- the tick the line ended on
+// Returns:
+//	uint64_t		- the tick the next line ends on
+//*****************************************************************************
+uint64_t Clock::VdpLine(ClockedDevice* device, uint64_t tick)
+{
+	device->AdvanceTo(tick);
+	return(tick + LINE_TICKS);
+}
+
+
+//*****************************************************************************
+//	ClockName()
+//*****************************************************************************
+// Params:
+//	SYS_CLOCK	- the clock speed designator
+// Returns:
+//	const char*	- its name as in ConfigData.h, "clk_890K" and so on
+//*****************************************************************************
+const char* Clock::ClockName(SYS_CLOCK clockSpeed)
+{
+	static const char* names[] =
 	{
-		time[0] = cpuCycleTime;
-		time[1] = vdpCycleTime;
-	}
+		"clk_10K", "clk_890K", "clk_1M", "clk_1M5", "clk_1M78", "clk_2M", "clk_3M",
+		"clk_4M", "clk_4M77", "clk_6M", "clk_8M", "clk_10M", "clk_16M"
+	};
+
+	if ((unsigned)clockSpeed >= sizeof(names) / sizeof(names[0]))
+		return("clk_?");
+	return(names[clockSpeed]);
+}
+
+
+//*****************************************************************************
+//	SpeedText()
+//*****************************************************************************
+//	The last speed Run() measured as text, "37.2x of clk_890K".
+//*****************************************************************************
+// Params:
+//	char*		- where to put it
+//	size_t		- room there, terminator included
+// Returns:
+//	int			- as snprintf()
+//*****************************************************************************
+int Clock::SpeedText(char* text, size_t size) const
+{
+	return(snprintf(text, size, "%.1fx of %s", speed.load(), ClockName(primaryClock)));
+}
+
+
+//*****************************************************************************
+//	TicksToNanoseconds()
+//*****************************************************************************
+//	Host time for a number of ticks, 22000/315 ns each, rounded down. Good
+// for about nine years of ticks before it overflows.
+//*****************************************************************************
+// Params:
+//	uint64_t	- ticks of the crystal
+// Returns:
+//	uint64_t	- nanoseconds
+//*****************************************************************************
+uint64_t Clock::TicksToNanoseconds(uint64_t ticks)
+{
+	return((ticks * 4400) / 63);			// 1000000000 * 22 / 315000000
+}
+
+
+//*****************************************************************************
+//	Run()
+//*****************************************************************************
+//	Runs the clock(s) triggering functionality based on the clock. Each slice
+// of emulated time (see SetSlice()) is run flat out, then Run() sleeps
+// until the host clock reaches the end of it. Once a slice, the ticks run
+// since Run() started are turned into host time, so the end of a slice is
+// exact and neither rounding nor oversleeping adds up over a long session.
+// If the host falls more than a few frames behind it stops trying to catch
+// up and carries on from where it is.
+//
+//	In turbo (see SetTurbo()) there is no waiting at all. Turbo can be
+// switched either way while Run() is going, coming out of it starts the
+// host clock afresh from there. Every half second of host time Speed() is
+// updated with how many times faster than the set clock it ran.
+//
+//	Stop() ends it at the end of the slice it is in. A Stop() made before
+// Run() starts ends it after the first slice, it is not lost.
+//*****************************************************************************
+// Returns:
+//	bool		- false once asked to stop
+//*****************************************************************************
+bool Clock::Run()
+{
+	const std::chrono::nanoseconds maxBehind(100000000);
+	const std::chrono::nanoseconds speedWindow(500000000);
+	std::chrono::steady_clock::time_point start(std::chrono::steady_clock::now());
+	uint64_t startTick = now;
+	std::chrono::steady_clock::time_point measured(start);
+	uint64_t measuredTick = now;
+	bool wasTurbo = turbo;
 
 	bool run = true;
 	while (run)
 	{
-		std::chrono::steady_clock::time_point _start(std::chrono::steady_clock::now());
+		Advance(sliceTicks);
+		run = !stop.exchange(false);
 
-		run = Execute();
+		bool fast = turbo;
+		std::chrono::steady_clock::time_point host(std::chrono::steady_clock::now());
+		if (host - measured >= speedWindow)
+		{
+			speed = float(double(TicksToNanoseconds(now - measuredTick)) /
+				std::chrono::duration_cast<std::chrono::nanoseconds>(host - measured).count());
+			measured = host;
+			measuredTick = now;
+		}
 
-		std::chrono::steady_clock::time_point _end(std::chrono::steady_clock::now());
-		auto timeDifference = _end - _start;
-		auto timelapse = std::chrono::duration_cast<std::chrono::nanoseconds>(timeDifference);
-		auto cycleTime = (std::chrono::nanoseconds)(primaryCycleTime);
-		if (timelapse < cycleTime)
-			std::this_thread::sleep_for((cycleTime - timelapse));
+		if (fast || wasTurbo)
+		{
+			start = host;
+			startTick = now;
+		}
 		else
-			std::cout << "WARN: Cycle exceeded cycle by " << (timelapse - cycleTime).count() << " nanoseconds" << std::endl;
+		{
+			std::chrono::steady_clock::time_point due(start + std::chrono::nanoseconds(TicksToNanoseconds(now - startTick)));
+			if (host < due)
+				std::this_thread::sleep_until(due);
+			else if ((host - due) > maxBehind)
+			{
+				start = host;
+				startTick = now;
+			}
+		}
+		wasTurbo = fast;
 	}
 	return(run);
 }
 
 
-bool Clock::Execute()
+//*****************************************************************************
+//	RunFor()
+//*****************************************************************************
+//	Runs the whole machine on by a number of ticks as fast as it will go and
+// comes back. Nothing here looks at the host clock, so the same machine
+// given the same RunFor() calls ends up the same on any host, every time.
+// A CPU finishes the instruction it is in, a few cycles past the end, and
+// the next call takes that off.
+//*****************************************************************************
+// Params:
+//	uint64_t	- ticks of the crystal to run
+// Returns:
+//	uint64_t	- Now(), afterwards
+//*****************************************************************************
+uint64_t Clock::RunFor(uint64_t ticks)
 {
-	return(true);
+	Advance(ticks);
+	return(now);
 }
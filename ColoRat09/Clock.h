@@ -10,46 +10,109 @@
 ******************************************************************************/
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <queue>
+#include <vector>
 
+#include "ClockedDevice.h"
 #include "VDP.h"
 #include "CPU.h"
 #include "ConfigData.h"
 
 class Clock
 {
+public:
+	// Emulated time is counted in ticks of the CoCo's 14.31818MHz crystal,
+	// which is 315/22 MHz exactly.
+	static const uint32_t MASTER_HZ_NUM = 315000000;	// ticks a second is
+	static const uint32_t MASTER_HZ_DEN = 22;			//	NUM / DEN
+	static const uint32_t LINE_TICKS = 910;				// one NTSC scanline
+
+	typedef ClockedDevice::RATIO RATIO;
+
+	// A device's event, called at each tick it asked for. Hands back the
+	// tick of the next one, or 0 for none.
+	typedef uint64_t(*DEVICE_EVENT)(ClockedDevice* device, uint64_t tick);
+
 private:
+	//-------------------------------------------------------------------------
+	// A clocked device. One with no event of its own drives the rest (a CPU)
+	// and is run up to every event, others only wait for their own events or
+	// for the MMU to catch them up.
+	//-------------------------------------------------------------------------
+	struct DEVICE
+	{
+		ClockedDevice* device;
+		DEVICE_EVENT event;
+		uint32_t divider;								// primary cycles per device cycle
+		bool drives;
+	};
+
+	struct EVENT
+	{
+		uint64_t tick;
+		uint64_t order;									// same tick, first scheduled goes first
+		uint32_t device;
+
+		bool operator>(const EVENT& other) const
+		{
+			return((tick != other.tick) ? (tick > other.tick) : (order > other.order));
+		}
+	};
+
 	SYS_CLOCK primaryClock;
+	RATIO primaryRate;
 
-	float cpuClockDivider;
-	float vdpClockDivider;
+	// Run() runs a slice of emulated time flat out, then waits for the host
+	// clock to catch up, once per slice.
+	SYS_SLICE slice;
+	uint32_t sliceMicroseconds;							// slice_us only
+	uint64_t sliceTicks;
 
-	// time in nanoseconds for process to run.
-	uint16_t primaryCycleTime;
-	uint16_t cpuCycleTime;
-	uint16_t vdpCycleTime;
-	uint16_t vdpVSyncTime;
-	uint16_t vdpHSyncTime;
+	// In turbo Run() never waits, it goes as fast as the host can. Either
+	// way it measures how fast emulated time is going against host time.
+	std::atomic<bool> turbo;
+	std::atomic<float> speed;							// emulated / host time
+	std::atomic<bool> stop;
 
-	CPU* cpu;
-	VDP* vdp;
+	// Emulated time is the tick count here and nowhere else. Devices run in
+	// bulk from one event to the next.
+	uint64_t now;
+	uint64_t eventOrder;
+	std::vector<DEVICE> devices;
+	std::priority_queue<EVENT, std::vector<EVENT>, std::greater<EVENT>> events;
 
 protected:
 public:
 
 private:
-	uint16_t SetSpeed(SYS_CLOCK clockSpeed, float divider = 1);
-	bool Execute();
+	RATIO SetSpeed(SYS_CLOCK clockSpeed, uint32_t divider = 1);
+	void SetSliceTicks();
+	void Schedule(uint32_t device, uint64_t tick);
+	void Advance(uint64_t ticks);
 protected:
 public:
 	Clock(SYS_CLOCK clockSpeed = SYS_CLOCK::clk_890K);
 	~Clock();
 
 	void SetMainSpeed(SYS_CLOCK clockSpeed = SYS_CLOCK::clk_890K);
+	void SetSlice(SYS_SLICE length = SYS_SLICE::slice_line, uint32_t microseconds = 1000);
 
-	void Add(CPU* processorType, float divider);
-	void Add(VDP* vdpType, float divider);
+	void Add(ClockedDevice* device, uint32_t divider = 1, DEVICE_EVENT event = nullptr);
+	static uint64_t VdpLine(ClockedDevice* device, uint64_t tick);
 
+	void SetTurbo(bool on) { turbo = on; }
+	bool Turbo() const { return(turbo); }
+	float Speed() const { return(speed); }
+	int SpeedText(char* text, size_t size) const;
+	static const char* ClockName(SYS_CLOCK clockSpeed);
+
+	uint64_t Now() const { return(now); }
+	static uint64_t TicksToNanoseconds(uint64_t ticks);
 	bool Run();
+	void Stop() { stop = true; }
+	uint64_t RunFor(uint64_t ticks);
 };
-
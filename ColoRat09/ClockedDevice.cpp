@@ -0,0 +1,94 @@
+/******************************************************************************
+*		   File: ClockedDevice.cpp
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/21
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+#include "ClockedDevice.h"
+
+
+//*****************************************************************************
+//	ClockedDevice()
+//*****************************************************************************
+//	Starts at tick 0, one cycle a tick until SetRate() says otherwise.
+//*****************************************************************************
+ClockedDevice::ClockedDevice()
+{
+	rate = { 1, 1 };
+	reached = 0;
+	phase = 0;
+}
+
+
+//*****************************************************************************
+//	SetRate()
+//*****************************************************************************
+//	Sets how the device's cycles line up with ticks. Any part of a tick the
+// device had run into is dropped.
+//*****************************************************************************
+// Params:
+//	RATIO		- ticks to cycles, neither 0
+//*****************************************************************************
+void ClockedDevice::SetRate(RATIO ratio)
+{
+	rate.ticks = (ratio.ticks != 0) ? ratio.ticks : 1;
+	rate.cycles = (ratio.cycles != 0) ? ratio.cycles : 1;
+	phase = 0;
+}
+
+
+//*****************************************************************************
+//	SkipTo()
+//*****************************************************************************
+//	Moves the device on to a tick without running it, for a device that has
+// nothing to do until then.
+//*****************************************************************************
+// Params:
+//	uint64_t	- the tick
+//*****************************************************************************
+void ClockedDevice::SkipTo(uint64_t tick)
+{
+	reached = tick;
+	phase = 0;
+}
+
+
+//*****************************************************************************
+//	CyclesTo()
+//*****************************************************************************
+// Params:
+//	uint64_t	- a tick
+// Returns:
+//	uint64_t	- the cycles the device has to run to get to it, rounded up, 0
+//					if it is already there
+//*****************************************************************************
+uint64_t ClockedDevice::CyclesTo(uint64_t tick) const
+{
+	if (reached >= tick)
+		return(0);
+
+	uint64_t owed = (tick - reached) * rate.cycles - phase;
+	return((owed + rate.ticks - 1) / rate.ticks);
+}
+
+
+//*****************************************************************************
+//	Ran()
+//*****************************************************************************
+//	Moves the device on by cycles it has run. Cycles that end part way
+// through a tick are carried in phase, so nothing is lost to rounding.
+//*****************************************************************************
+// Params:
+//	uint64_t	- cycles run
+//*****************************************************************************
+void ClockedDevice::Ran(uint64_t cycles)
+{
+	uint64_t run = cycles * rate.ticks + phase;
+
+	reached += run / rate.cycles;
+	phase = uint32_t(run % rate.cycles);
+}
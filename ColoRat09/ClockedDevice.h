@@ -0,0 +1,62 @@
+/******************************************************************************
+*		   File: ClockedDevice.h
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/21
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+#pragma once
+
+#include <cstdint>
+
+
+//*****************************************************************************
+//	Anything with a clock: CPUs, the VDP, and later the PIAs and sound. Time
+// is in ticks of the 14.31818MHz crystal (see Clock), and every device
+// keeps track of the tick it has been run to.
+//
+//	Devices are not kept in step cycle by cycle. Clock runs them in batches
+// with AdvanceTo(), and when the CPU touches a device's registers the MMU
+// brings just that device up to the CPU's Now() first (see MMU::Attach()).
+// AdvanceTo() must do nothing for a tick the device has already reached.
+//*****************************************************************************
+class ClockedDevice
+{
+public:
+	// cycles of a clock take exactly ticks of the crystal
+	struct RATIO
+	{
+		uint32_t ticks;
+		uint32_t cycles;
+	};
+
+private:
+protected:
+	RATIO rate;											// own cycles to ticks
+	uint64_t reached;									// tick run to
+	uint32_t phase;										// and rate.cycles'ths of one more
+
+public:
+
+private:
+protected:
+	uint64_t CyclesTo(uint64_t tick) const;
+	void Ran(uint64_t cycles);
+
+public:
+	ClockedDevice();
+	virtual ~ClockedDevice() {};
+
+	void SetRate(RATIO ratio);
+	RATIO Rate() const { return(rate); }
+	uint64_t Reached() const { return(reached); }
+	void SkipTo(uint64_t tick);
+
+	// The tick the device is at. Past Reached() only while it is part way
+	// through a batch, as a CPU is inside Run().
+	virtual uint64_t Now() const { return(reached); }
+	virtual void AdvanceTo(uint64_t tick) = 0;
+};
@@ -40,6 +40,13 @@ enum SYS_CLOCK
 	clk_16M,	//   62nS	16MHz				680xx
 };
 
+enum SYS_SLICE
+{
+	slice_line,		//   63.5uS	one NTSC scanline
+	slice_frame,	// 16.68mS	one NTSC field, 262 scanlines
+	slice_us,		//  N uS	set with Clock::SetSlice()
+};
+
 enum SYS_CPU
 {
 	cpu_z80,	// Zilog	 Z80		8-bit
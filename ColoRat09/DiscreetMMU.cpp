@@ -1 +1,109 @@
+#include <cstring>
+
 #include "DiscreetMMU.h"
+
+
+//*****************************************************************************
+//	DiscreetMMU()
+//*****************************************************************************
+//	Allocates and clears size bytes of RAM and banks the first 64K of it in,
+// slot n at block n.
+//*****************************************************************************
+DiscreetMMU::DiscreetMMU(SYS_RAM size)
+{
+	// 8K blocks for each SYS_RAM size. Bank registers are 8 bits, so only
+	// the first 2MB can ever be banked in.
+	static const uint16_t blockCount[] = { 8, 16, 64, 128, 256, 512, 1024, 2048 };
+
+	blocks = blockCount[size];
+	ram = new uint8_t[blocks * 0x2000];
+	memset(ram, 0x00, blocks * 0x2000);
+
+	for (uint8_t slot = 0; slot < 8; slot++)
+	{
+		bank[slot] = slot;
+		Remap(slot);
+	}
+}
+
+
+//*****************************************************************************
+//	~DiscreetMMU()
+//*****************************************************************************
+//	Releases RAM.
+//*****************************************************************************
+DiscreetMMU::~DiscreetMMU()
+{
+	delete[] ram;
+}
+
+
+//*****************************************************************************
+//	Remap()
+//*****************************************************************************
+//	Points the 32 pages of one slot at the RAM block its bank register picks.
+//	Slot 7 stops short of the I/O page.
+//*****************************************************************************
+void DiscreetMMU::Remap(uint8_t slot)
+{
+	uint8_t* block = &ram[(bank[slot] % blocks) * 0x2000];
+
+	MapPages(slot * 0x20, (slot == 7) ? 0x1f : 0x20, block, block);
+}
+
+
+//*****************************************************************************
+//	Read()
+//*****************************************************************************
+//	Reads anywhere in the map, though the CPU only calls it for the I/O page.
+//	Bank registers read back, other I/O reads as $FF.
+//*****************************************************************************
+uint8_t DiscreetMMU::Read(uint16_t address, bool /*readOnly*/)
+{
+	const uint8_t* page = ReadPage(address);
+
+	if (page != nullptr)
+		return(page[address & 0xff]);
+	if ((address >= 0xffa0) && (address <= 0xffa7))
+		return(bank[address & 0x07]);
+	if (address >= 0xfff0)
+		return(ram[(bank[7] % blocks) * 0x2000 + (address & 0x1fff)]);
+	return(0xff);
+}
+
+
+//*****************************************************************************
+//	Write()
+//*****************************************************************************
+//	Writes anywhere in the map, though the CPU only calls it for the I/O page.
+//	A bank register write re-points only that slot's pages.
+//*****************************************************************************
+void DiscreetMMU::Write(uint16_t address, uint8_t byte)
+{
+	uint8_t* page = WritePage(address);
+
+	if (page != nullptr)
+		page[address & 0xff] = byte;
+	else if ((address >= 0xffa0) && (address <= 0xffa7))
+	{
+		if (bank[address & 0x07] != byte)
+		{
+			bank[address & 0x07] = byte;
+			Remap(address & 0x07);
+		}
+	}
+	else if (address >= 0xfff0)
+	{
+		ram[(bank[7] % blocks) * 0x2000 + (address & 0x1fff)] = byte;
+
+		// another slot on slot 7's bank reads the vectors through its pages
+		for (uint8_t slot = 0; slot < 7; slot++)
+		{
+			if ((bank[slot] % blocks) == (bank[7] % blocks))
+			{
+				MemoryChanged();
+				break;
+			}
+		}
+	}
+}
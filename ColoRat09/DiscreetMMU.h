@@ -10,18 +10,39 @@
 ******************************************************************************/
 #pragma once
 
+#include <cstdint>
+
+#include "ConfigData.h"
 #include "MMU.h"
 
 
+//*****************************************************************************
+//	Paging MMU built from discrete logic: the 64K address space is split into
+// eight 8K slots, each pointed at any 8K block of RAM by a bank register at
+// $FFA0-$FFA7. $FF00-$FFFF is the I/O page; its last 16 bytes (the vectors)
+// come from the RAM behind slot 7.
+//*****************************************************************************
 class DiscreetMMU : public MMU
 {
 private:
+	uint8_t* ram;
+	uint32_t blocks;
+	uint8_t bank[8];
+
 protected:
 public:
 
 private:
+	void Remap(uint8_t slot);
+
 protected:
 public:
+	DiscreetMMU(SYS_RAM size = ram_512K);
+	~DiscreetMMU();
 
-};
+	uint8_t Bank(uint16_t address) const override { return(bank[address >> 13]); }
+
+	uint8_t Read(uint16_t address, bool readOnly = false) override;
+	void Write(uint16_t address, uint8_t byte) override;
 
+};
@@ -0,0 +1,25 @@
+/******************************************************************************
+*		   File: FlatRAM.cpp
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/21
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+#include <cstring>
+
+#include "FlatRAM.h"
+
+
+//*****************************************************************************
+//	FlatRAM()
+//*****************************************************************************
+//	Powers up with all 64K cleared and every page mapped for read and write.
+//*****************************************************************************
+FlatRAM::FlatRAM()
+{
+	memset(memory, 0x00, sizeof(memory));
+	MapPages(0x00, 256, memory, memory);
+}
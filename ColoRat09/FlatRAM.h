@@ -0,0 +1,48 @@
+/******************************************************************************
+*		   File: FlatRAM.h
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/21
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+#pragma once
+
+#include <cstdint>
+
+#include "MMU.h"
+
+
+//*****************************************************************************
+//	64K of flat RAM with no mapping, as seen by a CoCo 2 in all-RAM mode.
+//	Every page is mapped, so the CPU never calls Read()/Write() for a bus
+// access.
+//*****************************************************************************
+class FlatRAM final : public MMU
+{
+private:
+	uint8_t memory[0x10000];
+
+protected:
+public:
+
+private:
+protected:
+public:
+	FlatRAM();
+	~FlatRAM() {};
+
+	uint8_t Read(uint16_t address, bool /*readOnly*/ = false) override
+	{
+		return(memory[address]);
+	}
+
+	void Write(uint16_t address, uint8_t byte) override
+	{
+		memory[address] = byte;
+	}
+
+	uint8_t* Memory() { return(memory); }
+};
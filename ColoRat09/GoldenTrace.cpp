@@ -0,0 +1,290 @@
+/******************************************************************************
+*		   File: GoldenTrace.cpp
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/21
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+#include <cstring>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "GoldenTrace.h"
+
+static_assert(sizeof(GoldenTrace::HEADER) == 32, "GoldenTrace::HEADER is written as is");
+
+
+//*****************************************************************************
+//	GoldenTrace()
+//*****************************************************************************
+GoldenTrace::GoldenTrace()
+{
+	file = nullptr;
+	view = nullptr;
+	viewSize = 0;
+	cursor = nullptr;
+	end = nullptr;
+
+	memset(&header, 0x00, sizeof(header));
+	memset(&last, 0x00, sizeof(last));
+	records = 0;
+}
+
+
+//*****************************************************************************
+//	~GoldenTrace()
+//*****************************************************************************
+GoldenTrace::~GoldenTrace()
+{
+	Close();
+}
+
+
+//*****************************************************************************
+//	Create()
+//*****************************************************************************
+//	Starts a new trace in fileName from the registers in start.
+//*****************************************************************************
+//	Returns:
+//	bool - false if a trace is already open or the file can't be created.
+//*****************************************************************************
+bool GoldenTrace::Create(const char* fileName, const Mc6809::REGISTERS& start)
+{
+	if ((file != nullptr) || (view != nullptr))
+		return(false);
+
+	file = std::fopen(fileName, "wb");
+	if (file == nullptr)
+		return(false);
+
+	memset(&header, 0x00, sizeof(header));
+	memcpy(header.magic, "C09G", 4);
+	header.version = VERSION;
+	header.headerSize = sizeof(HEADER);
+	header.start = start;
+	std::fwrite(&header, sizeof(header), 1, file);		// count filled in by Close()
+
+	last = start;
+	records = 0;
+	buffer.reserve(0x10000 + 16);
+	return(true);
+}
+
+
+//*****************************************************************************
+//	Append()
+//*****************************************************************************
+//	Adds the registers after one more instruction, and what it took.
+//*****************************************************************************
+void GoldenTrace::Append(const Mc6809::REGISTERS& regs, const uint8_t cycles)
+{
+	uint8_t mask = 0;
+
+	mask |= (regs.cc != last.cc) ? FIELD::CC : 0;
+	mask |= (regs.a != last.a) ? FIELD::A : 0;
+	mask |= (regs.b != last.b) ? FIELD::B : 0;
+	mask |= (regs.dp != last.dp) ? FIELD::DP : 0;
+	mask |= (regs.x != last.x) ? FIELD::X : 0;
+	mask |= (regs.y != last.y) ? FIELD::Y : 0;
+	mask |= (regs.u != last.u) ? FIELD::U : 0;
+	mask |= (regs.s != last.s) ? FIELD::S : 0;
+
+	buffer.push_back(mask);
+	PutVarint(Zigzag(last.pc, regs.pc));
+	buffer.push_back(cycles);
+
+	if (mask & FIELD::CC)
+		buffer.push_back(regs.cc);
+	if (mask & FIELD::A)
+		buffer.push_back(regs.a);
+	if (mask & FIELD::B)
+		buffer.push_back(regs.b);
+	if (mask & FIELD::DP)
+		buffer.push_back(regs.dp);
+	if (mask & FIELD::X)
+		PutVarint(Zigzag(last.x, regs.x));
+	if (mask & FIELD::Y)
+		PutVarint(Zigzag(last.y, regs.y));
+	if (mask & FIELD::U)
+		PutVarint(Zigzag(last.u, regs.u));
+	if (mask & FIELD::S)
+		PutVarint(Zigzag(last.s, regs.s));
+
+	last = regs;
+	records++;
+	if (buffer.size() >= 0x10000)
+		Flush();
+}
+
+
+//*****************************************************************************
+//	Flush()
+//*****************************************************************************
+//	Writes out the encoded records held in buffer.
+//*****************************************************************************
+//	Returns:
+//	bool - false if the write failed.
+//*****************************************************************************
+bool GoldenTrace::Flush()
+{
+	size_t size = buffer.size();
+	bool ok = (size == 0) || (std::fwrite(buffer.data(), 1, size, file) == size);
+
+	buffer.clear();
+	return(ok);
+}
+
+
+//*****************************************************************************
+//	Open()
+//*****************************************************************************
+//	Maps a trace written by Create() for reading with Next().
+//*****************************************************************************
+//	Returns:
+//	bool - false if the file can't be mapped or isn't a trace this version
+//			can read.
+//*****************************************************************************
+bool GoldenTrace::Open(const char* fileName)
+{
+	if ((file != nullptr) || (view != nullptr) || !Map(fileName))
+		return(false);
+
+	memcpy(&header, view, sizeof(header));
+	if ((memcmp(header.magic, "C09G", 4) != 0) || (header.version != VERSION) ||
+		(header.headerSize < sizeof(HEADER)) || (header.headerSize > viewSize))
+	{
+		Unmap();
+		return(false);
+	}
+
+	cursor = view + header.headerSize;
+	end = view + viewSize;
+	last = header.start;
+	records = 0;
+	return(true);
+}
+
+
+//*****************************************************************************
+//	Close()
+//*****************************************************************************
+//	Finishes a trace being written, filling in the record count, or lets go
+// of one being read.
+//*****************************************************************************
+//	Returns:
+//	bool - false if writing the trace failed at any point.
+//*****************************************************************************
+bool GoldenTrace::Close()
+{
+	if (view != nullptr)
+	{
+		Unmap();
+		return(true);
+	}
+	if (file == nullptr)
+		return(true);
+
+	bool ok = Flush();
+
+	header.count = records;
+	ok = ok && (std::fseek(file, 0, SEEK_SET) == 0);
+	ok = ok && (std::fwrite(&header, sizeof(header), 1, file) == 1);
+	ok = ok && !std::ferror(file);
+	ok = (std::fclose(file) == 0) && ok;
+	file = nullptr;
+	return(ok);
+}
+
+
+//*****************************************************************************
+//	Map()
+//*****************************************************************************
+//	Maps the whole of fileName read only into view. Traces run to hundreds
+// of megabytes, mapping leaves paging them in to the OS.
+//*****************************************************************************
+//	Returns:
+//	bool - false if the file can't be opened, is too short to hold a header
+//			or can't be mapped.
+//*****************************************************************************
+#ifdef _WIN32
+bool GoldenTrace::Map(const char* fileName)
+{
+	HANDLE handle = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	LARGE_INTEGER size;
+
+	if (handle == INVALID_HANDLE_VALUE)
+		return(false);
+	if (!GetFileSizeEx(handle, &size) || (size.QuadPart < (LONGLONG)sizeof(HEADER)))
+	{
+		CloseHandle(handle);
+		return(false);
+	}
+
+	// the view outlives both handles
+	HANDLE mapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mapping != nullptr)
+	{
+		view = (const uint8_t*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(mapping);
+	}
+	CloseHandle(handle);
+
+	viewSize = (view != nullptr) ? (uint64_t)size.QuadPart : 0;
+	return(view != nullptr);
+}
+
+void GoldenTrace::Unmap()
+{
+	UnmapViewOfFile(view);
+	view = nullptr;
+	viewSize = 0;
+	cursor = nullptr;
+	end = nullptr;
+}
+#else
+bool GoldenTrace::Map(const char* fileName)
+{
+	int handle = open(fileName, O_RDONLY);
+	struct stat status;
+
+	if (handle < 0)
+		return(false);
+	if ((fstat(handle, &status) != 0) || (status.st_size < (off_t)sizeof(HEADER)))
+	{
+		close(handle);
+		return(false);
+	}
+
+	// the mapping outlives the descriptor
+	void* address = mmap(nullptr, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, handle, 0);
+	close(handle);
+	if (address == MAP_FAILED)
+		return(false);
+
+	madvise(address, (size_t)status.st_size, MADV_SEQUENTIAL);
+	view = (const uint8_t*)address;
+	viewSize = (uint64_t)status.st_size;
+	return(true);
+}
+
+void GoldenTrace::Unmap()
+{
+	munmap((void*)view, (size_t)viewSize);
+	view = nullptr;
+	viewSize = 0;
+	cursor = nullptr;
+	end = nullptr;
+}
+#endif
@@ -0,0 +1,184 @@
+/******************************************************************************
+*		   File: GoldenTrace.h
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/21
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "Mc6809.h"
+
+
+//*****************************************************************************
+//	Register state at every instruction boundary of a known good run, to
+// check a later run against.
+//
+//	The file is a HEADER, holding the registers the run starts from, then
+// one record per instruction:
+//		mask		one byte, a bit for each of CC A B DP X Y U S that changed
+//		PC			varint, zigzag of the signed 16 bit step from the last PC
+//		cycles		one byte, what Step() returned
+//		registers	the changed ones in mask order, 8 bit ones as the value,
+//					16 bit ones as a varint of the zigzag step from the last
+// Varints are 7 bits a byte, low bits first, top bit set while more follow.
+// Most instructions come to 3 or 4 bytes.
+//
+//	Create()/Append()/Close() write a trace. Open() maps one for reading
+// and Next() decodes it a record at a time.
+//*****************************************************************************
+class GoldenTrace
+{
+public:
+	static const uint16_t VERSION = 1;
+
+	enum FIELD : uint8_t
+	{
+		CC = (1 << 0),
+		A = (1 << 1),
+		B = (1 << 2),
+		DP = (1 << 3),
+		X = (1 << 4),
+		Y = (1 << 5),
+		U = (1 << 6),
+		S = (1 << 7)
+	};
+
+	struct HEADER
+	{
+		char magic[4];									// "C09G"
+		uint16_t version;
+		uint16_t headerSize;
+		uint64_t count;									// records
+		Mc6809::REGISTERS start;
+		uint8_t reserved[2];
+	};
+
+private:
+	// writing
+	std::FILE* file;
+	std::vector<uint8_t> buffer;
+
+	// reading
+	const uint8_t* view;
+	uint64_t viewSize;
+	const uint8_t* cursor;
+	const uint8_t* end;
+
+	HEADER header;
+	Mc6809::REGISTERS last;
+	uint64_t records;
+
+protected:
+public:
+
+private:
+	static uint16_t Zigzag(const uint16_t from, const uint16_t to)
+	{
+		int16_t step = (int16_t)(to - from);
+
+		return((uint16_t)((step << 1) ^ (step >> 15)));
+	}
+
+	static uint16_t Unzigzag(const uint16_t from, const uint16_t code)
+	{
+		return((uint16_t)(from + ((code >> 1) ^ (0 - (code & 1)))));
+	}
+
+	void PutVarint(uint16_t value)
+	{
+		while (value >= 0x80)
+		{
+			buffer.push_back((uint8_t)(value | 0x80));
+			value >>= 7;
+		}
+		buffer.push_back((uint8_t)value);
+	}
+
+	bool GetByte(uint8_t& value)
+	{
+		if (cursor == end)
+			return(false);
+		value = *cursor++;
+		return(true);
+	}
+
+	// a varint holding the zigzag step from value
+	bool GetStep(uint16_t& value)
+	{
+		uint32_t code = 0;
+
+		for (uint8_t shift = 0; shift < 21; shift += 7)
+		{
+			if (cursor == end)
+				return(false);
+			uint8_t byte = *cursor++;
+			code |= (uint32_t)(byte & 0x7f) << shift;
+			if ((byte & 0x80) == 0)
+			{
+				value = Unzigzag(value, (uint16_t)code);
+				return(true);
+			}
+		}
+		return(false);
+	}
+
+	bool Flush();
+	bool Map(const char* fileName);
+	void Unmap();
+
+protected:
+public:
+	GoldenTrace();
+	~GoldenTrace();
+
+	bool Create(const char* fileName, const Mc6809::REGISTERS& start);
+	void Append(const Mc6809::REGISTERS& regs, uint8_t cycles);
+	bool Open(const char* fileName);
+	bool Close();
+
+	const Mc6809::REGISTERS& Start() const { return(header.start); }
+	uint64_t Count() const { return(header.count); }
+	uint64_t Position() const { return(records); }
+	uint64_t Size() const { return(viewSize); }
+
+	//*************************************************************************
+	//	Decodes the next record into regs and cycles. False at the end of the
+	// trace, or if the record is cut short.
+	//*************************************************************************
+	bool Next(Mc6809::REGISTERS& regs, uint8_t& cycles)
+	{
+		uint8_t mask;
+
+		if ((records == header.count) || !GetByte(mask) || !GetStep(last.pc) || !GetByte(cycles))
+			return(false);
+
+		if ((mask & FIELD::CC) && !GetByte(last.cc))
+			return(false);
+		if ((mask & FIELD::A) && !GetByte(last.a))
+			return(false);
+		if ((mask & FIELD::B) && !GetByte(last.b))
+			return(false);
+		if ((mask & FIELD::DP) && !GetByte(last.dp))
+			return(false);
+		if ((mask & FIELD::X) && !GetStep(last.x))
+			return(false);
+		if ((mask & FIELD::Y) && !GetStep(last.y))
+			return(false);
+		if ((mask & FIELD::U) && !GetStep(last.u))
+			return(false);
+		if ((mask & FIELD::S) && !GetStep(last.s))
+			return(false);
+
+		records++;
+		regs = last;
+		return(true);
+	}
+};
@@ -1 +1,57 @@
 #include "MMU.h"
+
+
+//*****************************************************************************
+//	MMU()
+//*****************************************************************************
+//	Starts with every page unmapped, so all accesses go to Read()/Write()
+// until the subclass maps its memory in.
+//*****************************************************************************
+MMU::MMU()
+{
+	mapGeneration = 0;
+	MapPages(0x00, 256, nullptr, nullptr);
+}
+
+
+//*****************************************************************************
+//	MapPages()
+//*****************************************************************************
+//	Points pages firstPage through firstPage + pages - 1 at consecutive 256
+// byte blocks of read and write. nullptr unmaps that direction.
+//*****************************************************************************
+void MMU::MapPages(uint8_t firstPage, uint16_t pages, uint8_t* read, uint8_t* write)
+{
+	for (uint16_t page = 0; (page < pages) && ((firstPage + page) < 256); page++)
+	{
+		readPage[firstPage + page] = (read != nullptr) ? (read + (page << 8)) : nullptr;
+		writePage[firstPage + page] = (write != nullptr) ? (write + (page << 8)) : nullptr;
+	}
+	mapGeneration++;
+}
+
+
+//*****************************************************************************
+//	Attach()
+//*****************************************************************************
+//	Registers a device's address range for CatchUp(). The range should be in
+// pages left unmapped, or the CPU never comes through here for it.
+//*****************************************************************************
+void MMU::Attach(ClockedDevice* device, uint16_t first, uint16_t last)
+{
+	attached.push_back({ first, last, device });
+}
+
+
+//*****************************************************************************
+//	CatchUp()
+//*****************************************************************************
+//	Brings whatever is attached at address up to tick, before the CPU reads
+// or writes it. Only the I/O path comes here, so a short list is fine.
+//*****************************************************************************
+void MMU::CatchUp(uint16_t address, uint64_t tick)
+{
+	for (const ATTACHED& entry : attached)
+		if ((address >= entry.first) && (address <= entry.last))
+			entry.device->AdvanceTo(tick);
+}
@@ -11,21 +11,70 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
+#include "ClockedDevice.h"
 
+
+//*****************************************************************************
+//	Besides the virtual Read()/Write(), every MMU keeps a read and a write
+// pointer for each 256 byte page of the 16 bit address space. The CPU goes
+// straight through the pointer when it is set, and only calls Read()/Write()
+// for pages left as nullptr, such as I/O or ROM being written. A subclass
+// re-points pages only when its mapping registers change.
+//
+//	MapGeneration() changes whenever the map does, so a CPU holding anything
+// decoded from memory knows to drop it. Code that changes memory behind the
+// CPU's back (loading a program or ROM image) calls MemoryChanged() for the
+// same reason, and so does a Write() that stores into memory some page
+// reads through its pointer. Pages pointed at the same memory are fine, the
+// CPU follows writes across them.
+//
+//	Bank() tells tools which bank an address is mapped to, so code at the
+// same address in different banks can be told apart. Unbanked MMUs leave it
+// at 0.
+//
+//	Devices with registers in unmapped pages are Attach()ed to their address
+// range. Before the CPU reads or writes one of them through Read()/Write()
+// it calls CatchUp() with its own Now(), and only that device is brought up
+// to the CPU. Everything else waits for its next batch.
+//*****************************************************************************
 class MMU
 {
 private:
 protected:
+	uint8_t* readPage[256];
+	uint8_t* writePage[256];
+	uint32_t mapGeneration;
+
+	struct ATTACHED
+	{
+		uint16_t first;
+		uint16_t last;
+		ClockedDevice* device;
+	};
+	std::vector<ATTACHED> attached;
+
 public:
 
 private:
 protected:
+	void MapPages(uint8_t firstPage, uint16_t pages, uint8_t* read, uint8_t* write);
+
 public:
+	MMU();
 	virtual ~MMU() {};
 
+	uint8_t* ReadPage(uint16_t address) const { return(readPage[address >> 8]); }
+	uint8_t* WritePage(uint16_t address) const { return(writePage[address >> 8]); }
+	uint32_t MapGeneration() const { return(mapGeneration); }
+	void MemoryChanged() { mapGeneration++; }
+	virtual uint8_t Bank(uint16_t /*address*/) const { return(0); }
+
+	void Attach(ClockedDevice* device, uint16_t first, uint16_t last);
+	void CatchUp(uint16_t address, uint64_t tick);
+
 	virtual uint8_t Read(uint16_t address, bool readOnly = false) = 0;
 	virtual void Write(uint16_t address, uint8_t byte) = 0;
 
 };
-
@@ -10,7 +10,12 @@
 ******************************************************************************/
 #include "Mc6809.h"
 
-#define USE_RESET_3E
+// counts a cycle for the bus trace, nothing when it is compiled out
+#ifdef USE_BUS_TRACE
+#define TRACE_CYCLE()	(++traceCycle)
+#else
+#define TRACE_CYCLE()
+#endif
 
 //*********************************************************************************************************************************
 // Constructors, destructors, and any sets and/or gets for data.
@@ -30,9 +35,16 @@ Mc6809::Mc6809(MMU* device)
 	exec = nullptr;
 
 	clocksUsed = 0;
+	waitState = false;
+	lines = LINE::RESET;		// powers up into reset
 
 	// set all registers to a clear state.
 	reg_CC = 0x00;			// Condition Code Register
+	ccLazy = 0x00;			// (internal only)
+	ccOp = CCOP::NZ8;		// (internal only)
+	ccA = 0x0000;			// (internal only)
+	ccB = 0x0000;			// (internal only)
+	ccR = 0x00000000;		// (internal only)
 
 	reg_DP = 0x00;			// Direct Page Registe
 
@@ -63,86 +75,40 @@ Mc6809::Mc6809(MMU* device)
 	scratch_hi = 0x00;		// (internal only)
 	scratch_lo = 0x00;		// (internal only)
 	reg_scratch = 0x0000;	// (internal only)
+	operand_hi = 0x00;		// (internal only)
+	operand_lo = 0x00;		// (internal only)
+	reg_operand = 0x0000;	// (internal only)
+	indexedAddress = 0x0000;	// (internal only)
+	postByte = 0x00;		// (internal only)
+	bitNumber = 0;			// (internal only)
+	syncCount = 0;			// (internal only)
+	runCycles = 0;			// (internal only)
+	idleLoopCount = 0;
 
-	using op = Mc6809;
-
-	OpCode[0] =
-	{
-#ifdef USE_RESET_3E
-		{"NEG"	,&op::NEG_dir  ,6 ,6, 2 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"COM"	 ,&op::COM_dir	,6 ,6 ,2 }, {"LSR"		,&op::LSR_dir	  ,6 ,6 ,2 }, {"???"	  ,&op::XXX			,1 ,1 ,1 }, {"ROR"	,&op::ROR_dir  ,6 ,6 ,2 }, {"ASR"  ,&op::ASR_dir  ,6 ,6 ,2 }, {"ASL/LSL"  ,&op::ASL_LSL_dir	  ,6 ,6 ,2 }, {"ROL"  ,&op::ROL_dir	 ,6 ,6 ,2 }, {"DEC"	 ,&op::DEC_dir	,6 ,6 ,2 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"INC"  ,&op::INC_dir  ,6 ,6 ,2 }, {"TST"  ,&op::TST_dir	 ,6 ,6 ,2 }, {"JMP"	 ,&op::JMP_dir	,3 ,3 ,2 }, {"CLR"	,&op::CLR_dir  ,6 ,6 ,2 },
-		{"***"	,nullptr	   ,1 ,1 ,1 }, {"***"  ,nullptr		  ,1 ,1 ,1 }, {"NOP"  ,&op::NOP_inh	 ,2 ,2 ,1 }, {"SYNC" ,&op::SYNC_inh ,4 ,00,1 }, {"???"		,&op::XXX		  ,1 ,1 ,1 }, {"???"	  ,&op::XXX			,1 ,1 ,1 }, {"LBRA" ,&op::LBRA_rel ,5 ,5 ,3 }, {"LBSR" ,&op::LBSR_rel ,9 ,9 ,3 }, {"???"	  ,&op::XXX			  ,1 ,1 ,1 }, {"DAA"  ,&op::DAA_inh	 ,2 ,2 ,1 }, {"ORCC" ,&op::ORCC_imm ,3 ,3 ,2 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"ANDCC",&op::ANDCC_imm,3 ,3 ,2 }, {"SEX"  ,&op::SEX_inh	 ,2 ,2 ,1 }, {"EXG"	 ,&op::EXG_imm	,8 ,8 ,2 }, {"TFR"	,&op::TFR_imm  ,6 ,6 ,2 },
-		{"BRA"	,&op::BRA_rel  ,3 ,3 ,2 }, {"BRN"  ,&op::BRN_rel  ,3 ,3 ,2 }, {"BHI"  ,&op::BHI_rel	 ,3 ,3 ,2 }, {"BLS"	 ,&op::BLS_rel	,3 ,3 ,2 }, {"BHS/BCC"	,&op::BHS_BCC_rel ,3 ,3 ,2 }, {"BLO/BCS"  ,&op::BLO_BCS_rel ,3 ,3 ,2 }, {"BNE"	,&op::BNE_rel  ,3 ,3 ,2 }, {"BEQ"  ,&op::BEQ_rel  ,3 ,3 ,2 }, {"BVC"	  ,&op::BVC_rel		  ,3 ,3 ,2 }, {"BVS"  ,&op::BVS_rel	 ,3 ,3 ,2 }, {"BPL"	 ,&op::BPL_rel	,3 ,3 ,2 }, {"BMI"	,&op::BMI_rel  ,3 ,3 ,2 }, {"BGE"  ,&op::BGE_rel  ,3 ,3 ,2 }, {"BLT"  ,&op::BLT_rel	 ,3 ,3 ,2 }, {"BGT"	 ,&op::BGT_rel	,3 ,3 ,2 }, {"BLE"	,&op::BLE_rel  ,3 ,3 ,2 },
-		{"LEAX" ,&op::LEAX_idx ,4 ,99,2 }, {"LEAY" ,&op::LEAY_idx ,4 ,99,2 }, {"LEAS" ,&op::LEAS_idx ,4 ,99,2 }, {"LEAU" ,&op::LEAU_idx ,4 ,99,2 }, {"PSHS"		,&op::PSHS_imm	  ,5 ,99,2 }, {"PULS"	  ,&op::PULS_imm	,5 ,99,2 }, {"PSHU" ,&op::PSHU_imm ,5 ,99,2 }, {"PULU" ,&op::PULU_imm ,5 ,99,2 }, {"???"	  ,&op::XXX			  ,1 ,1 ,1 }, {"RTS"  ,&op::RTS_inh	 ,5 ,5 ,1 }, {"ABX"	 ,&op::ABX_inh	,3 ,3 ,1 }, {"RTI"	,&op::RTI_inh  ,6 ,15,1 }, {"CWAI" ,&op::CWAI_inh ,20,00,2 }, {"MUL"  ,&op::MUL_inh	 ,11,11,1 }, {"RESET",&op::RESET_inh,19,19,1 }, {"SWI"	,&op::SWI_inh  ,19,19,1 },
-		{"NEGA" ,&op::NEGA_inh ,2 ,2 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"COMA" ,&op::COMA_inh ,2 ,2 ,1 }, {"LSRA"		,&op::LSRA_inh	  ,2 ,2 ,1 }, {"???"	  ,&op::XXX			,1 ,1 ,1 }, {"RORA" ,&op::RORA_inh ,2 ,2 ,1 }, {"ASRA" ,&op::ASRA_inh ,2 ,2 ,1 }, {"ASLA/LSLA",&op::ASLA_LSLA_inh ,2 ,2 ,1 }, {"ROLA" ,&op::ROLA_inh ,2 ,2 ,1 }, {"DECA" ,&op::DECA_inh ,2 ,2 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"INCA" ,&op::INCA_inh ,2 ,2 ,1 }, {"TSTA" ,&op::TSTA_inh ,2 ,2 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"CLRA" ,&op::CLRA_inh ,2 ,2 ,1 },
-		{"NEGB" ,&op::NEGB_inh ,2 ,2 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"COMB" ,&op::COMB_inh ,2 ,2 ,1 }, {"LSRB"		,&op::LSRB_inh	  ,2 ,2 ,1 }, {"???"	  ,&op::XXX			,1 ,1 ,1 }, {"RORB" ,&op::RORB_inh ,2 ,2 ,1 }, {"ASRB" ,&op::ASRB_inh ,2 ,2 ,1 }, {"ASLB/LSLB",&op::ASLB_LSLB_inh ,2 ,2 ,1 }, {"ROLB" ,&op::ROLB_inh ,2 ,2 ,1 }, {"DECB" ,&op::DECB_inh ,2 ,2 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"INCB" ,&op::INCB_inh ,2 ,2 ,1 }, {"TSTB" ,&op::TSTB_inh ,2 ,2 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"CLRB" ,&op::CLRB_inh ,2 ,2 ,1 },
-		{"NEG"	,&op::NEG_idx  ,6 ,99,2 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"COM"	 ,&op::COM_idx	,6 ,99,2 }, {"LSR"		,&op::LSR_idx	  ,6 ,99,2 }, {"???"	  ,&op::XXX			,1 ,1 ,1 }, {"ROR"	,&op::ROR_idx  ,6 ,99,2 }, {"ASR"  ,&op::ASR_idx  ,6 ,99,2 }, {"ASL/LSL"  ,&op::ASL_LSL_idx	  ,6 ,99,2 }, {"ROL"  ,&op::ROL_idx	 ,6 ,99,2 }, {"DEC"	 ,&op::DEC_idx	,6 ,99,2 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"INC"  ,&op::INC_idx  ,6 ,99,2 }, {"TST"  ,&op::TST_idx	 ,6 ,99,2 }, {"JMP"	 ,&op::JMP_idx	,3 ,99,2 }, {"CLR"	,&op::CLR_idx  ,6 ,99,2 },
-		{"NEG"	,&op::NEG_ext  ,7 ,7 ,3 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"COM"	 ,&op::COM_ext	,7 ,7 ,3 }, {"LSR"		,&op::LSR_ext	  ,7 ,7 ,3 }, {"???"	  ,&op::XXX			,1 ,1 ,1 }, {"ROR"	,&op::ROR_ext  ,7 ,7 ,3 }, {"ASR"  ,&op::ASR_ext  ,7 ,7 ,3 }, {"ASL/LSL"  ,&op::ASL_LSL_ext	  ,7 ,7 ,3 }, {"ROL"  ,&op::ROL_ext	 ,7 ,7 ,3 }, {"DEC"	 ,&op::DEC_ext	,7 ,7 ,3 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"INC"  ,&op::INC_ext  ,7 ,7 ,3 }, {"TST"  ,&op::TST_ext	 ,7 ,7 ,3 }, {"JMP"	 ,&op::JMP_ext	,4 ,4 ,3 }, {"CLR"	,&op::CLR_ext  ,7 ,7 ,3 },
-		{"SUBA" ,&op::SUBA_imm ,2 ,2 ,2 }, {"CMPA" ,&op::CMPA_imm ,2 ,2 ,2 }, {"SBCA" ,&op::SBCA_imm ,2 ,2 ,2 }, {"SUBD" ,&op::SUBD_imm ,4 ,4 ,3 }, {"ANDA"		,&op::ANDA_imm	  ,2 ,2 ,2 }, {"BITA"	  ,&op::BITA_imm	,2 ,2 ,2 }, {"LDA"	,&op::LDA_imm  ,2 ,2 ,2 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"EORA"	  ,&op::EORA_imm	  ,2 ,2 ,2 }, {"ADCA" ,&op::ADCA_imm ,2 ,2 ,2 }, {"ORA"	 ,&op::ORA_imm	,2 ,2 ,2 }, {"ADDA" ,&op::ADDA_imm ,2 ,2 ,2 }, {"CMPX" ,&op::CMPX_imm ,4 ,2 ,3 }, {"BSR"  ,&op::BSR_rel	 ,7 ,7 ,2 }, {"LDX"	 ,&op::LDX_imm	,3 ,3 ,3 }, {"???"	,&op::XXX	   ,1 ,1 ,1 },
-		{"SUBA" ,&op::SUBA_dir ,4 ,4 ,2 }, {"CMPA" ,&op::CMPA_dir ,4 ,4 ,2 }, {"SBCA" ,&op::SBCA_dir ,4 ,4 ,2 }, {"SUBD" ,&op::SUBD_dir ,6 ,6 ,2 }, {"ANDA"		,&op::ANDA_dir	  ,4 ,4 ,2 }, {"BITA"	  ,&op::BITA_dir	,4 ,4 ,2 }, {"LDA"	,&op::LDA_dir  ,4 ,4 ,2 }, {"STA"  ,&op::STA_dir  ,4 ,4 ,2 }, {"EORA"	  ,&op::EORA_dir	  ,4 ,4 ,2 }, {"ADCA" ,&op::ADCA_dir ,4 ,4 ,2 }, {"ORA"	 ,&op::ORA_dir	,4 ,4 ,2 }, {"ADDA" ,&op::ADDA_dir ,4 ,4 ,2 }, {"CMPX" ,&op::CMPX_dir ,6 ,6 ,2 }, {"JSR"  ,&op::JSR_dir	 ,7 ,7 ,2 }, {"LDX"	 ,&op::LDX_dir	,5 ,5 ,2 }, {"STX"	,&op::STX_dir  ,5 ,5 ,2 },
-		{"SUBA" ,&op::SUBA_idx ,4 ,99,2 }, {"CMPA" ,&op::CMPA_idx ,4 ,99,2 }, {"SBCA" ,&op::SBCA_idx ,4 ,99,2 }, {"SUBD" ,&op::SUBD_idx ,4 ,99,2 }, {"ANDA"		,&op::ANDA_idx	  ,4 ,99,2 }, {"BITA"	  ,&op::BITA_idx	,4 ,99,2 }, {"LDA"	,&op::LDA_idx  ,4 ,99,2 }, {"STA"  ,&op::STA_idx  ,4 ,99,2 }, {"EORA"	  ,&op::EORA_idx	  ,4 ,99,2 }, {"ADCA" ,&op::ADCA_idx ,4 ,99,2 }, {"ORA"	 ,&op::ORA_idx	,4 ,99,2 }, {"ADDA" ,&op::ADDA_idx ,4 ,99,2 }, {"CMPX" ,&op::CMPX_idx ,6 ,99,2 }, {"JSR"  ,&op::JSR_idx	 ,7 ,99,2 }, {"LDX"	 ,&op::LDX_idx	,5 ,99,2 }, {"STX"	,&op::STX_idx  ,5 ,99,2 },
-		{"SUBA" ,&op::SUBA_ext ,5 ,5 ,3 }, {"CMPA" ,&op::CMPA_ext ,5 ,5 ,3 }, {"SBCA" ,&op::SBCA_ext ,5 ,5 ,3 }, {"SUBD" ,&op::SUBD_ext ,7 ,7 ,3 }, {"ANDA"		,&op::ANDA_ext	  ,5 ,5 ,3 }, {"BITA"	  ,&op::BITA_ext	,5 ,5 ,3 }, {"LDA"	,&op::LDA_ext  ,5 ,5 ,3 }, {"STA"  ,&op::STA_ext  ,5 ,5 ,3 }, {"EORA"	  ,&op::EORA_ext	  ,5 ,5 ,3 }, {"ADCA" ,&op::ADCA_ext ,5 ,5 ,3 }, {"ORA"	 ,&op::ORA_ext	,5 ,5 ,3 }, {"ADDA" ,&op::ADDA_ext ,5 ,5 ,3 }, {"CMPX" ,&op::CMPX_ext ,7 ,7 ,3 }, {"JSR"  ,&op::JSR_ext	 ,8 ,8 ,3 }, {"LDX"	 ,&op::LDX_ext	,6 ,6 ,3 }, {"STX"	,&op::STX_ext  ,6 ,6 ,3 },
-		{"SUBB" ,&op::SUBB_imm ,2 ,2 ,2 }, {"CMPB" ,&op::CMPB_imm ,2 ,2 ,2 }, {"SBCB" ,&op::SBCB_imm ,2 ,2 ,2 }, {"ADDD" ,&op::ADDD_imm ,4 ,4 ,3 }, {"ANDB"		,&op::ANDB_imm	  ,2 ,2, 2 }, {"BITB"	  ,&op::BITB_imm	,2 ,2 ,2 }, {"LDB"	,&op::LDB_imm  ,2 ,2 ,2 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"EORB"	  ,&op::EORB_imm	  ,2 ,2 ,2 }, {"ADCB" ,&op::ADCB_imm ,2 ,2 ,2 }, {"ORB"	 ,&op::ORB_imm	,2 ,2 ,2 }, {"ADDB" ,&op::ADDB_imm ,2 ,2 ,2 }, {"LDD"  ,&op::LDD_imm  ,3 ,3 ,3 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"LDU"	 ,&op::LDU_imm	,3 ,3 ,3 }, {"???"	,&op::XXX	   ,1 ,1 ,1 },
-		{"SUBB" ,&op::SUBB_dir ,4 ,4 ,2 }, {"CMPB" ,&op::CMPB_dir ,4 ,4 ,2 }, {"SBCB" ,&op::SBCB_dir ,4 ,4 ,2 }, {"ADDD" ,&op::ADDD_dir ,6 ,6 ,2 }, {"ANDB"		,&op::ANDB_dir	  ,4 ,4 ,2 }, {"BITB"	  ,&op::BITB_dir	,4 ,4 ,2 }, {"LDB"	,&op::LDB_dir  ,4 ,4 ,2 }, {"STB"  ,&op::STB_dir  ,4 ,4 ,2 }, {"EORB"	  ,&op::EORB_dir	  ,4 ,4 ,2 }, {"ADCB" ,&op::ADCB_dir ,4 ,4 ,2 }, {"ORB"	 ,&op::ORB_dir	,4 ,4 ,2 }, {"ADDB" ,&op::ADDB_dir ,4 ,4 ,2 }, {"LDD"  ,&op::LDD_dir  ,5 ,5 ,2 }, {"STD"  ,&op::STD_dir	 ,5 ,5 ,2 }, {"LDU"	 ,&op::LDU_dir	,5 ,5 ,2 }, {"STU"	,&op::STU_dir  ,5 ,5 ,2 },
-		{"SUBB" ,&op::SUBB_idx ,4 ,99,2 }, {"CMPB" ,&op::CMPB_idx ,4 ,99,2 }, {"SBCB" ,&op::SBCB_idx ,4 ,99,2 }, {"ADDD" ,&op::ADDD_idx ,6 ,99,2 }, {"ANDB"		,&op::ANDB_idx	  ,4 ,99,2 }, {"BITB"	  ,&op::BITB_idx	,4 ,99,2 }, {"LDB"	,&op::LDB_idx  ,4 ,99,2 }, {"STB"  ,&op::STB_idx  ,4 ,99,2 }, {"EORB"	  ,&op::EORB_idx	  ,4 ,99,2 }, {"ADCB" ,&op::ADCB_idx ,4 ,99,2 }, {"ORB"	 ,&op::ORB_idx	,4 ,99,2 }, {"ADDB" ,&op::ADDB_idx ,4 ,99,2 }, {"LDD"  ,&op::LDD_idx  ,5 ,99,2 }, {"STD"  ,&op::STD_idx	 ,5 ,99,2 }, {"LDU"	 ,&op::LDU_idx	,5 ,99,2 }, {"STU"	,&op::STU_idx  ,5 ,99,2 },
-		{"SUBB" ,&op::SUBB_ext ,5 ,5 ,3 }, {"CMPB" ,&op::CMPB_ext ,5 ,5 ,3 }, {"SBCB" ,&op::SBCB_ext ,5 ,5 ,3 }, {"ADDD" ,&op::ADDD_ext ,7 ,7 ,3 }, {"ANDB"		,&op::ANDB_ext	  ,5 ,5 ,3 }, {"BITB"	  ,&op::BITB_ext	,5 ,5 ,3 }, {"LDB"	,&op::LDB_ext  ,5 ,5 ,3 }, {"STB"  ,&op::STB_ext  ,5 ,5 ,3 }, {"EORB"	  ,&op::EORB_ext	  ,5 ,5 ,3 }, {"ADCB" ,&op::ADCB_ext ,5 ,5 ,3 }, {"ORB"	 ,&op::ORB_ext	,5 ,5 ,3 }, {"ADDB" ,&op::ADDB_ext ,5 ,5 ,3 }, {"LDD"  ,&op::LDD_ext  ,6 ,6 ,3 }, {"STD"  ,&op::STD_ext	 ,6 ,6 ,3 }, {"LDU"	 ,&op::LDU_ext	,6 ,6 ,3 }, {"STU"	,&op::STU_ext  ,6 ,6 ,3 }
-#else
-		{"NEG"	,& op::NEG_dir  ,6 ,6, 2 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"COM"	 ,&op::COM_dir	,6 ,6 ,2 }, {"LSR"		,&op::LSR_dir	  ,6 ,6 ,2 }, {"???"	  ,&op::XXX			,1 ,1 ,1 }, {"ROR"	,&op::ROR_dir  ,6 ,6 ,2 }, {"ASR"  ,&op::ASR_dir  ,6 ,6 ,2 }, {"ASL/LSL"  ,&op::ASL_LSL_dir	  ,6 ,6 ,2 }, {"ROL"  ,&op::ROL_dir	 ,6 ,6 ,2 }, {"DEC"	 ,&op::DEC_dir	,6 ,6 ,2 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"INC"  ,&op::INC_dir  ,6 ,6 ,2 }, {"TST"  ,&op::TST_dir	 ,6 ,6 ,2 }, {"JMP"	 ,&op::JMP_dir	,3 ,3 ,2 }, {"CLR"	,&op::CLR_dir  ,6 ,6 ,2 },
-		{"***"	,nullptr	   ,1 ,1 ,1 }, {"***"  ,nullptr		  ,1 ,1 ,1 }, {"NOP"  ,&op::NOP_inh	 ,2 ,2 ,1 }, {"SYNC" ,&op::SYNC_inh ,4 ,00,1 }, {"???"		,&op::XXX		  ,1 ,1 ,1 }, {"???"	  ,&op::XXX			,1 ,1 ,1 }, {"LBRA" ,&op::LBRA_rel ,5 ,5 ,3 }, {"LBSR" ,&op::LBSR_rel ,9 ,9 ,3 }, {"???"	  ,&op::XXX			  ,1 ,1 ,1 }, {"DAA"  ,&op::DAA_inh	 ,2 ,2 ,1 }, {"ORCC" ,&op::ORCC_imm ,3 ,3 ,2 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"ANDCC",&op::ANDCC_imm,3 ,3 ,2 }, {"SEX"  ,&op::SEX_inh	 ,2 ,2 ,1 }, {"EXG"	 ,&op::EXG_imm	,8 ,8 ,2 }, {"TFR"	,&op::TFR_imm  ,6 ,6 ,2 },
-		{"BRA"	,&op::BRA_rel  ,3 ,3 ,2 }, {"BRN"  ,&op::BRN_rel  ,3 ,3 ,2 }, {"BHI"  ,&op::BHI_rel	 ,3 ,3 ,2 }, {"BLS"	 ,&op::BLS_rel	,3 ,3 ,2 }, {"BHS/BCC"	,&op::BHS_BCC_rel ,3 ,3 ,2 }, {"BLO/BCS"  ,&op::BLO_BCS_rel ,3 ,3 ,2 }, {"BNE"	,&op::BNE_rel  ,3 ,3 ,2 }, {"BEQ"  ,&op::BEQ_rel  ,3 ,3 ,2 }, {"BVC"	  ,&op::BVC_rel		  ,3 ,3 ,2 }, {"BVS"  ,&op::BVS_rel	 ,3 ,3 ,2 }, {"BPL"	 ,&op::BPL_rel	,3 ,3 ,2 }, {"BMI"	,&op::BMI_rel  ,3 ,3 ,2 }, {"BGE"  ,&op::BGE_rel  ,3 ,3 ,2 }, {"BLT"  ,&op::BLT_rel	 ,3 ,3 ,2 }, {"BGT"	 ,&op::BGT_rel	,3 ,3 ,2 }, {"BLE"	,&op::BLE_rel  ,3 ,3 ,2 },
-		{"LEAX" ,&op::LEAX_idx ,4 ,99,2 }, {"LEAY" ,&op::LEAY_idx ,4 ,99,2 }, {"LEAS" ,&op::LEAS_idx ,4 ,99,2 }, {"LEAU" ,&op::LEAU_idx ,4 ,99,2 }, {"PSHS"		,&op::PSHS_imm	  ,5 ,4 ,2 }, {"PULS"	  ,&op::PULS_imm	,5 ,5 ,2 }, {"PSHU" ,&op::PSHU_imm ,5 ,5 ,2 }, {"PULU" ,&op::PULU_imm ,5 ,5 ,2 }, {"???"	  ,&op::XXX			  ,1 ,1 ,1 }, {"RTS"  ,&op::RTS_inh	 ,5 ,5 ,1 }, {"ABX"	 ,&op::ABX_inh	,3 ,3 ,1 }, {"RTI"	,&op::RTI_inh  ,6 ,15,1 }, {"CWAI" ,&op::CWAI_inh ,20,00,2 }, {"MUL"  ,&op::MUL_inh	 ,11,11,1 }, {"RESET",&op::RESET_inh,20,20,1 }, {"SWI"	,&op::SWI_inh  ,19,19,1 },
-		{"NEGA" ,&op::NEGA_inh ,2 ,2 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"COMA" ,&op::COMA_inh ,2 ,2 ,1 }, {"LSRA"		,&op::LSRA_inh	  ,2 ,2 ,1 }, {"???"	  ,&op::XXX			,1 ,1 ,1 }, {"RORA" ,&op::RORA_inh ,2 ,2 ,1 }, {"ASRA" ,&op::ASRA_inh ,2 ,2 ,1 }, {"ASLA/LSLA",&op::ASLA_LSLA_inh ,2 ,2 ,1 }, {"ROLA" ,&op::ROLA_inh ,2 ,2 ,1 }, {"DECA" ,&op::DECA_inh ,2 ,2 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"INCA" ,&op::INCA_inh ,2 ,2 ,1 }, {"TSTA" ,&op::TSTA_inh ,2 ,2 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"CLRA" ,&op::CLRA_inh ,2 ,2 ,1 },
-		{"NEGB" ,&op::NEGB_inh ,2 ,2 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"COMB" ,&op::COMB_inh ,2 ,2 ,1 }, {"LSRB"		,&op::LSRB_inh	  ,2 ,2 ,1 }, {"???"	  ,&op::XXX			,1 ,1 ,1 }, {"RORB" ,&op::RORB_inh ,2 ,2 ,1 }, {"ASRB" ,&op::ASRB_inh ,2 ,2 ,1 }, {"ASLB/LSLB",&op::ASLB_LSLB_inh ,2 ,2 ,1 }, {"ROLB" ,&op::ROLB_inh ,2 ,2 ,1 }, {"DECB" ,&op::DECB_inh ,2 ,2 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"INCB" ,&op::INCB_inh ,2 ,2 ,1 }, {"TSTB" ,&op::TSTB_inh ,2 ,2 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"CLRB" ,&op::CLRB_inh ,2 ,2 ,1 },
-		{"NEG"	,&op::NEG_idx  ,6 ,99,2 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"COM"	 ,&op::COM_idx	,6 ,99,2 }, {"LSR"		,&op::LSR_idx	  ,6 ,99,2 }, {"???"	  ,&op::XXX			,1 ,1 ,1 }, {"ROR"	,&op::ROR_idx  ,6 ,99,2 }, {"ASR"  ,&op::ASR_idx  ,6 ,99,2 }, {"ASL/LSL"  ,&op::ASL_LSL_idx	  ,6 ,99,2 }, {"ROL"  ,&op::ROL_idx	 ,6 ,99,2 }, {"DEC"	 ,&op::DEC_idx	,6 ,99,2 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"INC"  ,&op::INC_idx  ,6 ,99,2 }, {"TST"  ,&op::TST_idx	 ,6 ,99,2 }, {"JMP"	 ,&op::JMP_idx	,3 ,99,2 }, {"CLR"	,&op::CLR_idx  ,6 ,99,2 },
-		{"NEG"	,&op::NEG_ext  ,7 ,7 ,3 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"COM"	 ,&op::COM_ext	,7 ,7 ,3 }, {"LSR"		,&op::LSR_ext	  ,7 ,7 ,3 }, {"???"	  ,&op::XXX			,1 ,1 ,1 }, {"ROR"	,&op::ROR_ext  ,7 ,7 ,3 }, {"ASR"  ,&op::ASR_ext  ,7 ,7 ,3 }, {"ASL/LSL"  ,&op::ASL_LSL_ext	  ,7 ,7 ,3 }, {"ROL"  ,&op::ROL_ext	 ,7 ,7 ,3 }, {"DEC"	 ,&op::DEC_ext	,7 ,7 ,3 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"INC"  ,&op::INC_ext  ,7 ,7 ,3 }, {"TST"  ,&op::TST_ext	 ,7 ,7 ,3 }, {"JMP"	 ,&op::JMP_ext	,4 ,4 ,3 }, {"CLR"	,&op::CLR_ext  ,7 ,7 ,3 },
-		{"SUBA" ,&op::SUBA_imm ,2 ,2 ,2 }, {"CMPA" ,&op::CMPA_imm ,2 ,2 ,2 }, {"SBCA" ,&op::SBCA_imm ,2 ,2 ,2 }, {"SUBD" ,&op::SUBD_imm ,4 ,4 ,3 }, {"ANDA"		,&op::ANDA_imm	  ,2 ,2 ,2 }, {"BITA"	  ,&op::BITA_imm	,2 ,2 ,2 }, {"LDA"	,&op::LDA_imm  ,2 ,2 ,2 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"EORA"	  ,&op::EORA_imm	  ,2 ,2 ,2 }, {"ADCA" ,&op::ADCA_imm ,2 ,2 ,2 }, {"ORA"	 ,&op::ORA_imm	,2 ,2 ,2 }, {"ADDA" ,&op::ADDA_imm ,2 ,2 ,2 }, {"CMPX" ,&op::CMPX_imm ,4 ,2 ,3 }, {"BSR"  ,&op::BSR_rel	 ,7 ,7 ,2 }, {"LDX"	 ,&op::LDX_imm	,3 ,3 ,3 }, {"???"	,&op::XXX	   ,1 ,1 ,1 },
-		{"SUBA" ,&op::SUBA_dir ,4 ,4 ,2 }, {"CMPA" ,&op::CMPA_dir ,4 ,4 ,2 }, {"SBCA" ,&op::SBCA_dir ,4 ,4 ,2 }, {"SUBD" ,&op::SUBD_dir ,6 ,6 ,2 }, {"ANDA"		,&op::ANDA_dir	  ,4 ,4 ,2 }, {"BITA"	  ,&op::BITA_dir	,4 ,4 ,2 }, {"LDA"	,&op::LDA_dir  ,4 ,4 ,2 }, {"STA"  ,&op::STA_dir  ,4 ,4 ,2 }, {"EORA"	  ,&op::EORA_dir	  ,4 ,4 ,2 }, {"ADCA" ,&op::ADCA_dir ,4 ,4 ,2 }, {"ORA"	 ,&op::ORA_dir	,4 ,4 ,2 }, {"ADDA" ,&op::ADDA_dir ,4 ,4 ,2 }, {"CMPX" ,&op::CMPX_dir ,6 ,6 ,2 }, {"JSR"  ,&op::JSR_dir	 ,7 ,7 ,2 }, {"LDX"	 ,&op::LDX_dir	,5 ,5 ,2 }, {"STX"	,&op::STX_dir  ,5 ,5 ,2 },
-		{"SUBA" ,&op::SUBA_idx ,4 ,99,2 }, {"CMPA" ,&op::CMPA_idx ,4 ,99,2 }, {"SBCA" ,&op::SBCA_idx ,4 ,99,2 }, {"SUBD" ,&op::SUBD_idx ,4 ,99,2 }, {"ANDA"		,&op::ANDA_idx	  ,4 ,99,2 }, {"BITA"	  ,&op::BITA_idx	,4 ,99,2 }, {"LDA"	,&op::LDA_idx  ,4 ,99,2 }, {"STA"  ,&op::STA_idx  ,4 ,99,2 }, {"EORA"	  ,&op::EORA_idx	  ,4 ,99,2 }, {"ADCA" ,&op::ADCA_idx ,4 ,99,2 }, {"ORA"	 ,&op::ORA_idx	,4 ,99,2 }, {"ADDA" ,&op::ADDA_idx ,4 ,99,2 }, {"CMPX" ,&op::CMPX_idx ,6 ,99,2 }, {"JSR"  ,&op::JSR_idx	 ,7 ,99,2 }, {"LDX"	 ,&op::LDX_idx	,5 ,99,2 }, {"STX"	,&op::STX_idx  ,5 ,99,2 },
-		{"SUBA" ,&op::SUBA_ext ,5 ,5 ,3 }, {"CMPA" ,&op::CMPA_ext ,5 ,5 ,3 }, {"SBCA" ,&op::SBCA_ext ,5 ,5 ,3 }, {"SUBD" ,&op::SUBD_ext ,7 ,7 ,3 }, {"ANDA"		,&op::ANDA_ext	  ,5 ,5 ,3 }, {"BITA"	  ,&op::BITA_ext	,5 ,5 ,3 }, {"LDA"	,&op::LDA_ext  ,5 ,5 ,3 }, {"STA"  ,&op::STA_ext  ,5 ,5 ,3 }, {"EORA"	  ,&op::EORA_ext	  ,5 ,5 ,3 }, {"ADCA" ,&op::ADCA_ext ,5 ,5 ,3 }, {"ORA"	 ,&op::ORA_ext	,5 ,5 ,3 }, {"ADDA" ,&op::ADDA_ext ,5 ,5 ,3 }, {"CMPX" ,&op::CMPX_ext ,7 ,7 ,3 }, {"JSR"  ,&op::JSR_ext	 ,8 ,8 ,3 }, {"LDX"	 ,&op::LDX_ext	,6 ,6 ,3 }, {"STX"	,&op::STX_ext  ,6 ,6 ,3 },
-		{"SUBB" ,&op::SUBB_imm ,2 ,2 ,2 }, {"CMPB" ,&op::CMPB_imm ,2 ,2 ,2 }, {"SBCB" ,&op::SBCB_imm ,2 ,2 ,2 }, {"ADDD" ,&op::ADDD_imm ,4 ,4 ,3 }, {"ANDB"		,&op::ANDB_imm	  ,2 ,2, 2 }, {"BITB"	  ,&op::BITB_imm	,2 ,2 ,2 }, {"LDB"	,&op::LDB_imm  ,2 ,2 ,2 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"EORB"	  ,&op::EORB_imm	  ,2 ,2 ,2 }, {"ADCB" ,&op::ADCB_imm ,2 ,2 ,2 }, {"ORB"	 ,&op::ORB_imm	,2 ,2 ,2 }, {"ADDB" ,&op::ADDB_imm ,2 ,2 ,2 }, {"LDD"  ,&op::LDD_imm  ,3 ,3 ,3 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"LDU"	 ,&op::LDU_imm	,3 ,3 ,3 }, {"???"	,&op::XXX	   ,1 ,1 ,1 },
-		{"SUBB" ,&op::SUBB_dir ,4 ,4 ,2 }, {"CMPB" ,&op::CMPB_dir ,4 ,4 ,2 }, {"SBCB" ,&op::SBCB_dir ,4 ,4 ,2 }, {"ADDD" ,&op::ADDD_dir ,6 ,6 ,2 }, {"ANDB"		,&op::ANDB_dir	  ,4 ,4 ,2 }, {"BITB"	  ,&op::BITB_dir	,4 ,4 ,2 }, {"LDB"	,&op::LDB_dir  ,4 ,4 ,2 }, {"STB"  ,&op::STB_dir  ,4 ,4 ,2 }, {"EORB"	  ,&op::EORB_dir	  ,4 ,4 ,2 }, {"ADCB" ,&op::ADCB_dir ,4 ,4 ,2 }, {"ORB"	 ,&op::ORB_dir	,4 ,4 ,2 }, {"ADDB" ,&op::ADDB_dir ,4 ,4 ,2 }, {"LDD"  ,&op::LDD_dir  ,5 ,5 ,2 }, {"STD"  ,&op::STD_dir	 ,5 ,5 ,2 }, {"LDU"	 ,&op::LDU_dir	,5 ,5 ,2 }, {"STU"	,&op::STU_dir  ,5 ,5 ,2 },
-		{"SUBB" ,&op::SUBB_idx ,4 ,99,2 }, {"CMPB" ,&op::CMPB_idx ,4 ,99,2 }, {"SBCB" ,&op::SBCB_idx ,4 ,99,2 }, {"ADDD" ,&op::ADDD_idx ,6 ,99,2 }, {"ANDB"		,&op::ANDB_idx	  ,4 ,99,2 }, {"BITB"	  ,&op::BITB_idx	,4 ,99,2 }, {"LDB"	,&op::LDB_idx  ,4 ,99,2 }, {"STB"  ,&op::STB_idx  ,4 ,99,2 }, {"EORB"	  ,&op::EORB_idx	  ,4 ,99,2 }, {"ADCB" ,&op::ADCB_idx ,4 ,99,2 }, {"ORB"	 ,&op::ORB_idx	,4 ,99,2 }, {"ADDB" ,&op::ADDB_idx ,4 ,99,2 }, {"LDD"  ,&op::LDD_idx  ,5 ,99,2 }, {"STD"  ,&op::STD_idx	 ,5 ,99,2 }, {"LDU"	 ,&op::LDU_idx	,5 ,99,2 }, {"STU"	,&op::STU_idx  ,5 ,99,2 },
-		{"SUBB" ,&op::SUBB_ext ,5 ,5 ,3 }, {"CMPB" ,&op::CMPB_ext ,5 ,5 ,3 }, {"SBCB" ,&op::SBCB_ext ,5 ,5 ,3 }, {"ADDD" ,&op::ADDD_ext ,7 ,7 ,3 }, {"ANDB"		,&op::ANDB_ext	  ,5 ,5 ,3 }, {"BITB"	  ,&op::BITB_ext	,5 ,5 ,3 }, {"LDB"	,&op::LDB_ext  ,5 ,5 ,3 }, {"STB"  ,&op::STB_ext  ,5 ,5 ,3 }, {"EORB"	  ,&op::EORB_ext	  ,5 ,5 ,3 }, {"ADCB" ,&op::ADCB_ext ,5 ,5 ,3 }, {"ORB"	 ,&op::ORB_ext	,5 ,5 ,3 }, {"ADDB" ,&op::ADDB_ext ,5 ,5 ,3 }, {"LDD"  ,&op::LDD_ext  ,6 ,6 ,3 }, {"STD"  ,&op::STD_ext	 ,6 ,6 ,3 }, {"LDU"	 ,&op::LDU_ext	,6 ,6 ,3 }, {"STU"	,&op::STU_ext  ,6 ,6 ,3 }
-#endif
-	};
-	OpCode[1] =
-	{
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"		,&op::XXX		   ,1 ,1 ,1 }, {"???"	   ,&op::XXX		  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 },
-		{"***"	,nullptr   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"		,&op::XXX		   ,1 ,1 ,1 }, {"???"	   ,&op::XXX		  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"LBRN" ,&op::LBRN_rel ,5 ,5 ,4 }, {"LBHI" ,&op::LBHI_rel ,5 ,6 ,4 }, {"LBLS" ,&op::LBLS_rel ,5 ,6 ,4 }, {"LBHS/LBCC",&op::LBHS_LBCC_rel,5 ,6 ,4 }, {"LBCS/LBLO",&op::LBCS_LBLO_rel,5 ,6 ,4 }, {"LBNE" ,&op::LBNE_rel ,5 ,6 ,4 }, {"LBEQ" ,&op::LBEQ_rel ,5 ,6 ,4 }, {"LBVC" ,&op::LBVC_rel ,5 ,6 ,4 }, {"LBVS" ,&op::LBVS_rel ,5 ,6 ,4 }, {"LBPL" ,&op::LBPL_rel ,5 ,6 ,4 }, {"LBMI" ,&op::LBMI_rel ,5 ,6 ,4 }, {"LBGE" ,&op::LBGE_rel ,5 ,6 ,4 }, {"LBLT" ,&op::LBLT_rel ,5 ,6 ,4 }, {"LBGT" ,&op::LBGT_rel ,5 ,6 ,4 }, {"LBLE" ,&op::LBLE_rel ,5 ,6 ,4 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"		,&op::XXX		   ,1 ,1 ,1 }, {"???"	   ,&op::XXX		  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"SWI2" ,&op::SWI2_inh ,20,20,1 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"		,&op::XXX		   ,1 ,1 ,1 }, {"???"	   ,&op::XXX		  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"		,&op::XXX		   ,1 ,1 ,1 }, {"???"	   ,&op::XXX		  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"		,&op::XXX		   ,1 ,1 ,1 }, {"???"	   ,&op::XXX		  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"		,&op::XXX		   ,1 ,1 ,1 }, {"???"	   ,&op::XXX		  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"CMPD" ,&op::CMPD_imm ,5 ,5 ,4 }, {"???"		,&op::XXX		   ,1 ,1 ,1 }, {"???"	   ,&op::XXX		  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"CMPY" ,&op::CMPY_imm ,5 ,5 ,4 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"LDY"  ,&op::LDY_imm	 ,4 ,4 ,4 }, {"???"	 ,&op::XXX		,1 ,1 ,1 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"CMPD" ,&op::CMPD_dir ,7 ,7 ,3 }, {"???"		,&op::XXX		   ,1 ,1 ,1 }, {"???"	   ,&op::XXX		  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"CMPY" ,&op::CMPY_dir ,7 ,7 ,3 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"LDY"  ,&op::LDY_dir	 ,6 ,6 ,3 }, {"STY"	 ,&op::STY_dir	,6 ,6 ,3 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"CMPD" ,&op::CMPD_idx ,7 ,99,3 }, {"???"		,&op::XXX		   ,1 ,1 ,1 }, {"???"	   ,&op::XXX		  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"CMPY" ,&op::CMPY_idx ,7 ,99,3 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"LDY"  ,&op::LDY_idx	 ,6 ,99,3 }, {"STY"	 ,&op::STY_idx	,6 ,99,3 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"CMPD" ,&op::CMPD_ext ,8 ,8 ,4 }, {"???"		,&op::XXX		   ,1 ,1 ,1 }, {"???"	   ,&op::XXX		  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"CMPY" ,&op::CMPY_ext ,8 ,8 ,4 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"LDY"  ,&op::LDY_ext	 ,7 ,7 ,4 }, {"STY"	 ,&op::STY_ext	,7 ,7 ,4 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"		,&op::XXX		   ,1 ,1 ,1 }, {"???"	   ,&op::XXX		  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"LDS"  ,&op::LDS_imm	 ,4 ,4 ,4 }, {"???"	 ,&op::XXX		,1 ,1 ,1 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"		,&op::XXX		   ,1 ,1 ,1 }, {"???"	   ,&op::XXX		  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"LDS"  ,&op::LDS_dir	 ,6 ,6 ,4 }, {"STS"	 ,&op::STS_dir	,6 ,6, 3 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"		,&op::XXX		   ,1 ,1 ,1 }, {"???"	   ,&op::XXX		  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"LDS"  ,&op::LDS_idx	 ,6 ,99,3 }, {"STS"	 ,&op::STS_idx	,6 ,99,3 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"		,&op::XXX		   ,1 ,1 ,1 }, {"???"	   ,&op::XXX		  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"???"  ,&op::XXX		 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX	  ,1 ,1 ,1 }, {"LDS"  ,&op::LDS_ext	 ,7 ,7 ,4 }, {"STS"	 ,&op::STS_ext	,7 ,7, 4 },
-	};
-	OpCode[2] =
-	{
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 },
-		{"***"	,nullptr   ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"SWI3" ,&op::SWI3_inh ,20,20,2 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"CMPU" ,&op::CMPU_imm ,5 ,5 ,4 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"CMPS" ,&op::CMPS_imm ,5 ,5 ,4 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"CMPU" ,&op::CMPU_dir ,7 ,7 ,3 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"CMPS" ,&op::CMPS_dir ,7 ,7 ,3 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"CMPU" ,&op::CMPU_idx ,7 ,99,3 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"CMPS" ,&op::CMPS_idx ,7 ,99,3 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"CMPU" ,&op::CMPU_ext ,8 ,8 ,4 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"CMPS" ,&op::CMPS_ext ,8 ,8 ,4 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 },
-		{"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX	,1 ,1 ,1 }, {"???"	,&op::XXX	   ,1 ,1 ,1 }, {"???"  ,&op::XXX  ,1 ,1 ,1 }, {"???"  ,&op::XXX	 ,1 ,1 ,1 }, {"???"	 ,&op::XXX		,1 ,1 ,1 }
-	};
 	opCodePage = 0;
+#ifdef USE_DECODE_CACHE
+	decoded = new DECODED[0x10000]();
+	for (uint32_t& generation : pageGeneration)
+		generation = 1;								// entries start at 0, so none match
+	decodeMapGeneration = (bus != nullptr) ? bus->MapGeneration() : 0;
+	MapAliases();
+#endif
+#ifdef USE_BLOCK_CACHE
+	FlushBlocks();
+	blockMapGeneration = (bus != nullptr) ? bus->MapGeneration() : 0;
+#endif
+#ifdef USE_BUS_TRACE
+	trace = nullptr;
+	traceCycle = 0;
+	traceFlags = 0;
+#endif
+#ifdef USE_OPCODE_PROFILE
+	ClearProfile();
+#endif
+#ifdef USE_PC_PROFILE
+	pcProfile = nullptr;
+	pcCountdown = 0;
+#endif
 }
 
 
@@ -152,7 +118,11 @@ Mc6809::Mc6809(MMU* device)
 //	 Cleans up memory, if owned, on exit.
 //*****************************************************************************
 Mc6809::~Mc6809()
-{}
+{
+#ifdef USE_DECODE_CACHE
+	delete[] decoded;
+#endif
+}
 
 
 //*****************************************************************************
@@ -163,6 +133,16 @@ Mc6809::~Mc6809()
 void Mc6809::SetMMU(MMU* device)
 {
 	bus = device;
+#ifdef USE_DECODE_CACHE
+	for (uint32_t& generation : pageGeneration)
+		generation++;
+	decodeMapGeneration = (bus != nullptr) ? bus->MapGeneration() : 0;
+	MapAliases();
+#endif
+#ifdef USE_BLOCK_CACHE
+	FlushBlocks();
+	blockMapGeneration = (bus != nullptr) ? bus->MapGeneration() : 0;
+#endif
 }
 
 
@@ -178,1120 +158,977 @@ void Mc6809::SetMMU(MMU* device)
 //*****************************************************************************
 void Mc6809::Clock()
 {
+	TRACE_CYCLE();
 	if (exec == nullptr)
 	{
-		if (Halt && (opCodePage == 0))
+		uint8_t pending = (opCodePage == 0) ? Unmasked() : 0;
+
+		if (pending & LINE::HALT)
 			exec = &Mc6809::HALT;
-		else if (Reset && (opCodePage == 0))
+		else if (pending & LINE::RESET)
 			exec = &Mc6809::RESET;
-		else if (Nmi && (opCodePage == 0))
+		else if (pending & LINE::NMI)
 			exec = &Mc6809::NMI;
-		else if (Firq && (opCodePage == 0))
+		else if (pending & LINE::FIRQ)
 			exec = &Mc6809::FIRQ;
-		else if (Irq && (opCodePage == 0))
+		else if (pending & LINE::IRQ)
 			exec = &Mc6809::IRQ;
 		else
 			Fetch(reg_PC);
+#ifdef USE_OPCODE_PROFILE
+		if (pending != 0)
+			profiling = nullptr;
+#endif
 	}
-	//						   (obj->*fp)(m, n)
-	else if (uint8_t result = (this->*exec)() == 255)
+	else
 	{
-		exec = nullptr;
-		clocksUsed = 0;
-		opCodePage = 0;
+		//	(obj->*fp)(m, n)
+		waitState = false;
+		if ((this->*exec)() == 255)
+		{
+			exec = nullptr;
+			clocksUsed = 0;
+			opCodePage = 0;
+		}
 	}
+#ifdef USE_OPCODE_PROFILE
+	if (profiling != nullptr)
+		profiling->cycles++;
+#endif
+#ifdef USE_PC_PROFILE
+	SamplePC(reg_PC, 1);
+#endif
 	return;
 }
 
 
 //*****************************************************************************
-//	Read()
-//*****************************************************************************
-//	Reads a byte of data from the address bus.
+//	Step()
 //*****************************************************************************
-uint8_t Mc6809::Read(const uint16_t address, const bool readOnly)
-{
-	if (address >= 0x0000 && address <= 0xffff)
-		return (bus->Read(address, readOnly));
-	return(0x00);
-}
-
-
-//*****************************************************************************
-//	Write()
+//	Runs one complete instruction (or one complete interrupt sequence) per
+//	call instead of a single bus cycle. Interrupt lines are only looked at on
+//	the instruction boundary, and the opcode's handler is driven through all
+//	of its cycles without returning to the caller, so there is no
+//	sub-instruction bus timing. Use Clock() when cycle exact behaviour is
+//	needed.
+//
+//	If the CPU parks itself waiting on an external line (SYNC, CWAI, HALT)
+//	Step() returns after that cycle and picks the same instruction back up on
+//	the next call.
 //*****************************************************************************
-//	Writes a byte of data to the address bus.
+//	Returns:
+//	uint8_t - the number of cycles the instruction took. Instructions with a
+//				fixed cost use minCycles from the OpCode table, variable ones
+//				(indexed, stack, long branches, interrupts) are counted.
 //*****************************************************************************
-void Mc6809::Write(const uint16_t address, const uint8_t byte)
+uint8_t Mc6809::Step()
 {
-	if (address >= 0x0000 && address <= 0xffff)
-		bus->Write(address, byte);
-}
+	if (exec == nullptr)
+	{
+		// one load of the lines per instruction
+		uint8_t pending = Unmasked();
 
+		clocksUsed = 0;
+		opCodePage = 0;
 
-//*****************************************************************************
-//	Fetch()
-//*****************************************************************************
-//	Retrieve opcodes, and determine addressing and instruction to execute
-//*****************************************************************************
-uint8_t Mc6809::Fetch(const uint16_t address)
-{
-	static uint8_t opcode;
-	opcode = Read(reg_PC);
+		if (pending == 0)
+		{
+			// the handlers step PC past the prefix and opcode themselves, so
+			// only peek at them here. (With the page tables this is cheaper
+			// than a Decode() lookup, which only pays off for whole blocks.)
+			uint8_t page = 0;
+			uint8_t opcode = Read(reg_PC, true);
 
-	if (opcode == 0x10)
-	{
-		opCodePage = 1;
-		clocksUsed = 1;
-	}
-	else if (opcode == 0x11)
-	{
-		opCodePage = 2;
-		clocksUsed = 1;
-	}
-	else
-	{
-		exec = OpCode[opCodePage][opcode].opcode;
-		++clocksUsed;
+			if (opcode == 0x10 || opcode == 0x11)
+			{
+				page = (opcode == 0x10) ? 1 : 2;
+				opcode = Read(reg_PC + 1, true);
+			}
+			return(Execute(page, opcode));
+		}
+		else if (pending & LINE::HALT)
+			exec = &Mc6809::HALT;
+		else if (pending & LINE::RESET)
+			exec = &Mc6809::RESET;
+		else if (pending & LINE::NMI)
+			exec = &Mc6809::NMI;
+		else if (pending & LINE::FIRQ)
+			exec = &Mc6809::FIRQ;
+		else
+			exec = &Mc6809::IRQ;
+#ifdef USE_OPCODE_PROFILE
+		profiling = nullptr;
+#endif
 	}
 
-	// process opcode and set it to execute it.
-	return(clocksUsed);
-}
-
+#ifdef USE_PC_PROFILE
+	const uint16_t pc = reg_PC;
+#endif
+	uint8_t cycles = Resume();
 
-//*********************************************************************************************************************************
-//	Condition Code adjustments. This covers MOST adjustments. 
-//	Sets or Clears are handled in the function doing the setting or clearing
-//	Some other special adjustments are left in the function doing the setting
-// or clearing
-//*********************************************************************************************************************************
+#ifdef USE_OPCODE_PROFILE
+	if (profiling != nullptr)
+		profiling->cycles += cycles;
+#endif
+#ifdef USE_PC_PROFILE
+	SamplePC(pc, cycles);
+#endif
+	return(cycles);
+}
 
 
 //*****************************************************************************
-//	AdjustCC_H()
+//	Execute()
 //*****************************************************************************
-//	Set or Clear Half-Carry Condition Code
+//	Runs an already decoded opcode from its first cycle, for Step() and for
+// replaying a translated block.
 //*****************************************************************************
-void Mc6809::AdjustCC_H(uint8_t data)
+//	Returns:
+//	uint8_t - the number of cycles the instruction took, as Step().
+//*****************************************************************************
+uint8_t Mc6809::Execute(const uint8_t page, const uint8_t opcode)
 {
-	reg_CC = ((data & 0x0010) == 0x0010) ? (reg_CC | CC::H) : (reg_CC & ~CC::H);
+	const OPCODE& op = OpCode[page][opcode];
+	uint8_t cycles;
+#ifdef USE_PC_PROFILE
+	const uint16_t pc = reg_PC;
+#endif
+
+	clocksUsed = 0;
+	opCodePage = page;
+#ifdef USE_OPCODE_PROFILE
+	profiling = &profile[page][opcode];
+	profiling->executions++;
+#endif
+#ifdef USE_BUS_TRACE
+	// the handlers don't read the prefix and opcode back, so record the
+	// fetch cycles here
+	if (trace != nullptr)
+	{
+		if (page != 0)
+			trace->Record(traceCycle + 1, reg_PC, (page == 1) ? 0x10 : 0x11, BusTrace::READ | BusTrace::INSTRUCTION);
+		trace->Record(traceCycle + 1 + (page != 0), reg_PC + (page != 0), opcode, BusTrace::READ | ((page == 0) ? BusTrace::INSTRUCTION : 0));
+	}
+#endif
+#if defined(USE_THREADED_DISPATCH) && defined(USE_COMPUTED_GOTO)
+	cycles = DispatchTable(page, opcode);
+#elif defined(USE_THREADED_DISPATCH)
+	cycles = DispatchSwitch(page, opcode);
+#else
+	cycles = Interpret(page, opcode);
+#endif
+	if ((op.minCycles == op.maxCycles) && (op.minCycles != 0))
+		cycles = op.minCycles;
+#ifdef USE_OPCODE_PROFILE
+	profiling->cycles += cycles;
+#endif
+#ifdef USE_PC_PROFILE
+	SamplePC(pc, cycles);
+#endif
+	return(cycles);
 }
 
 
 //*****************************************************************************
-//	AdjustCC_N()
+//	Resume()
 //*****************************************************************************
-//	Set or Clear Negative Condition Code
+//	Drives exec until it finishes or parks in a wait state.
 //*****************************************************************************
-void Mc6809::AdjustCC_N(uint8_t data)
+//	Returns:
+//	uint8_t - the number of cycles run.
+//*****************************************************************************
+uint8_t Mc6809::Resume()
 {
-	reg_CC = ((data & 0x80) == 0x80) ? (reg_CC | CC::N) : (reg_CC | ~CC::N);
-}
+	uint8_t cycles = 0;
 
+	do
+	{
+		waitState = false;
+		++cycles;
+		TRACE_CYCLE();
+		if ((this->*exec)() == 255)
+		{
+			exec = nullptr;
+			clocksUsed = 0;
+			opCodePage = 0;
+			break;
+		}
+	} while (!waitState);
 
-//*****************************************************************************
-//	AdjustCC_Z()
-//*****************************************************************************
-//	Set or Clear Zero Condition Code
-//*****************************************************************************
-void Mc6809::AdjustCC_Z(uint8_t data)
-{
-	reg_CC = (data == 0) ? (reg_CC | CC::Z) : (reg_CC & ~CC::Z);
+	return(cycles);
 }
 
 
 //*****************************************************************************
-//	AdjustCC_V()
+//	Interpret()
 //*****************************************************************************
-//	Set or Clear Overflow Condition Code
+//	Starts an opcode just decoded through exec and Resume(), the path used
+// without USE_THREADED_DISPATCH.
 //*****************************************************************************
-void Mc6809::AdjustCC_V(uint8_t reg)
+//	Returns:
+//	uint8_t - the number of cycles run.
+//*****************************************************************************
+uint8_t Mc6809::Interpret(const uint8_t page, const uint8_t opcode)
 {
-	reg_CC = (((reg >> 6) & 0x01) != ((reg >> 7) & 0x01)) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
+	const OPCODE& op = OpCode[page][opcode];
+
+	exec = (op.opcode != nullptr) ? op.opcode : &Mc6809::XXX;
+	return(Resume());
 }
 
 
 //*****************************************************************************
-//	AdjustCC_V()
+//	DispatchSwitch() / DispatchTable()
 //*****************************************************************************
-//	Set or Clear Overflow Condition Code
+//	Threaded forms of Interpret(). Every opcode gets its own copy of the
+// Resume() loop with its handler called directly, so there is no
+// pointer-to-member call per cycle and each opcode's dispatch branch is
+// predicted on its own. DispatchSwitch() picks the copy with a switch,
+// DispatchTable() jumps to it through a table of label addresses (computed
+// goto, GCC and Clang only). Both are built from the DISPATCH() list in
+// Mc6809Dispatch.h. USE_COMPUTED_GOTO picks which one Execute() uses; both
+// are built so CoreCheck can hold them against Interpret().
+//
+//	If the handler parks in a wait state, exec is left pointing at it so the
+// next Step() picks it up through Resume().
+//*****************************************************************************
+//	Returns:
+//	uint8_t - the number of cycles run.
 //*****************************************************************************
-void Mc6809::AdjustCC_V(uint8_t dataA, uint8_t dataB, uint8_t result)
+#define RUN(handler)					\
+	do									\
+	{									\
+		waitState = false;				\
+		++cycles;						\
+		TRACE_CYCLE();					\
+		if (handler() == 255)			\
+		{								\
+			clocksUsed = 0;				\
+			opCodePage = 0;				\
+			return(cycles);				\
+		}								\
+	} while (!waitState);				\
+	exec = &Mc6809::handler;			\
+	return(cycles);
+
+uint8_t Mc6809::DispatchSwitch(const uint8_t page, const uint8_t opcode)
 {
-	reg_CC = (((dataA & 0x80) == 0) && ((dataB & 0x80) == 0) && ((result & 0x80) == 0x80)) ? (reg_CC | CC::V) : (reg_CC | ~CC::V);
-}
+	uint8_t cycles = 0;
 
+#define DISPATCH(p, code, handler)		case ((p << 8) | code): RUN(handler)
+	switch ((page << 8) | opcode)
+	{
+#include "Mc6809Dispatch.h"
+	}
+#undef DISPATCH
 
-//*****************************************************************************
-//	AdjustCC_C()
-//*****************************************************************************
-//	Set or Clear Carry Condition Code
-//*****************************************************************************
-void Mc6809::AdjustCC_C(uint16_t data)
-{
-	reg_CC = ((data & 0x0100) == 0x0100) ? (reg_CC | CC::C) : (reg_CC | ~CC::C);
+	return(cycles);
 }
 
-
-//*****************************************************************************
-//	AdjustCC_N()
-//*****************************************************************************
-//	Set or Clear Negative Condition Code
-//*****************************************************************************
-void Mc6809::AdjustCC_N(uint16_t data)
+#if defined(__GNUC__)
+uint8_t Mc6809::DispatchTable(const uint8_t page, const uint8_t opcode)
 {
-	reg_CC = ((data & 0x8000) == 0x8000) ? (reg_CC | CC::N) : (reg_CC | ~CC::N);
-}
+	uint8_t cycles = 0;
 
+#define DISPATCH(p, code, handler)		&&op_##p##_##code,
+	static const void* const label[3 * 256] =
+	{
+#include "Mc6809Dispatch.h"
+	};
+#undef DISPATCH
 
-//*****************************************************************************
-//	AdjustCC_Z()
-//*****************************************************************************
-//	Set or Clear Zero Condition Code
-//*****************************************************************************
-void Mc6809::AdjustCC_Z(uint16_t data)
-{
-	reg_CC = (data == 0) ? (reg_CC | CC::Z) : (reg_CC & ~CC::Z);
-}
+	goto *label[(page << 8) | opcode];
 
+#define DISPATCH(p, code, handler)		op_##p##_##code: RUN(handler)
+#include "Mc6809Dispatch.h"
+#undef DISPATCH
 
-//*****************************************************************************
-//	AdjustCC_V()
-//*****************************************************************************
-//	Set or Clear Overflow Condition Code
-//*****************************************************************************
-void Mc6809::AdjustCC_V(uint16_t dataA, uint16_t dataB, uint16_t result)
-{
-	reg_CC = (((dataA & 0x8000) == 0) && ((dataB & 0x8000) == 0) && ((result & 0x8000) == 0x8000)) ? (reg_CC | CC::V) : (reg_CC | ~CC::V);
+	return(cycles);
 }
+#endif
+#undef RUN
 
 
 //*****************************************************************************
-//	AdjustCC_C()
-//*****************************************************************************
-//	Set or Clear Carry Condition Code
+//	Run()
 //*****************************************************************************
-void Mc6809::AdjustCC_C(uint32_t data)
-{
-	reg_CC = ((data & 0x00010000) == 0x00010000) ? (reg_CC | CC::C) : (reg_CC | ~CC::C);
-}
-
-
-//*********************************************************************************************************************************
-// Index mode determinations - to help process index modes
-//*********************************************************************************************************************************
-
-
+//	Runs whole instructions until cycleBudget cycles have been used or
+//	StopRun() is called, so the driver pays for one call per slice instead of
+//	one per cycle. The last instruction is always finished, so the count can
+//	run past the budget by up to one instruction. Interrupt lines are sampled
+//	between instructions, as Step() does. With USE_BLOCK_CACHE, straight-line
+//	code is replayed from translated blocks (see Mc6809Blocks.cpp).
+//
+//	StopRun() is cleared on the way out, so one made before the call still
+//	stops it, before the first instruction.
+//
+//	Returns early, under budget, once the CPU goes Idle(), so the caller can
+//	skip ahead to whatever raises the next interrupt.
+//
+//	runCycles is kept up to date before each instruction, so Now() is right
+// while it runs.
 //*****************************************************************************
-//	IndexedIncRegister()
+//	Returns:
+//	uint32_t - the number of cycles actually used.
 //*****************************************************************************
-void Mc6809::IndexedIncRegister(uint8_t postByte)
+uint32_t Mc6809::Run(uint32_t cycleBudget)
 {
-	uint8_t reg_ID = (postByte & 0x60) >> 5;
+	uint32_t cycles = 0;
 
-	switch (reg_ID)
+	while ((cycles < cycleBudget) && !stopRun.load(std::memory_order_relaxed))
 	{
-	case 00:		// reg X
-		++reg_X;
-		break;
-	case 01:		// reg Y
-		++reg_Y;
-		break;
-	case 02:		// reg U
-		++reg_U;
-		break;
-	case 03:		// reg S
-		++reg_S;
-		break;
+		uint16_t pc = reg_PC;
+
+		runCycles = cycles;
+#ifdef USE_BLOCK_CACHE
+		uint32_t used = RunBlock(cycleBudget - cycles);
+
+		cycles += (used != 0) ? used : Step();
+#else
+		cycles += Step();
+#endif
+		// only a wait state or a backward jump can be the start of idling
+		if (((exec != nullptr) || (reg_PC <= pc)) && Idle())
+			break;
 	}
+
+	runCycles = 0;
+	stopRun.store(false, std::memory_order_relaxed);
+	return(cycles);
 }
 
 
 //*****************************************************************************
-//	IndexedDecRegister()
+//	Assert()
+//*****************************************************************************
+//	Raises one or more LINE:: lines. Safe from any thread; the CPU sees the
+// change at its next instruction boundary (or wait state cycle). A new NMI
+// is latched only when its line was not already up.
 //*****************************************************************************
-void Mc6809::IndexedDecRegister(uint8_t postByte)
+void Mc6809::Assert(const uint8_t line)
 {
-	uint8_t reg_ID = (postByte & 0x60) >> 5;
+	uint8_t old = lines.load(std::memory_order_relaxed);
+	uint8_t raised;
 
-	switch (reg_ID)
+	do
 	{
-	case 00:		// reg X
-		--reg_X;
-		break;
-	case 01:		// reg Y
-		--reg_Y;
-		break;
-	case 02:		// reg U
-		--reg_U;
-		break;
-	case 03:		// reg S
-		--reg_S;
-		break;
-	}
+		raised = old | (line & ~LINE::NMI) | ((line & LINE::NMI) ? NMI_LEVEL : 0);
+		if ((line & LINE::NMI) && !(old & NMI_LEVEL))
+			raised |= LINE::NMI;						// asserting edge
+	} while (!lines.compare_exchange_weak(old, raised, std::memory_order_release, std::memory_order_relaxed));
 }
 
 
 //*****************************************************************************
-//	IndexedAddToScratchRegister()
+//	Deassert()
+//*****************************************************************************
+//	Drops one or more LINE:: lines. Dropping NMI only drops its level, a
+// latched NMI is still taken. RESET is cleared by the CPU itself.
 //*****************************************************************************
-void Mc6809::IndexedAddToScratchRegister(uint8_t postByte)
+void Mc6809::Deassert(const uint8_t line)
 {
-	uint8_t reg_ID = (postByte & 0x60) >> 5;
+	uint8_t dropped = line & ~(LINE::NMI | LINE::RESET);
 
-	switch (reg_ID)
-	{
-	case 00:		// reg X
-		reg_scratch += reg_X;
-		break;
-	case 01:		// reg Y
-		reg_scratch += reg_Y;
-		break;
-	case 02:		// reg U
-		reg_scratch += reg_U;
-		break;
-	case 03:		// reg S
-		reg_scratch += reg_S;
-		break;
-	}
+	if (line & LINE::NMI)
+		dropped |= NMI_LEVEL;
+	lines.fetch_and((uint8_t)~dropped, std::memory_order_release);
 }
 
 
-const uint8_t Mc6809::HIGH_BYTE = 0;
-const uint8_t Mc6809::LOW_BYTE = 1;
-const uint8_t Mc6809::SINGLE_BYTE = 0;
-
-
+#ifdef USE_PC_PROFILE
+//*****************************************************************************
+//	SetPcProfile()
 //*****************************************************************************
-//	Direct()
+//	Starts sampling PC into sampler, or stops with nullptr. The first sample
+// is a full interval away.
 //*****************************************************************************
-uint8_t Mc6809::IndexedReadByteFromIndex(uint8_t postByte, uint8_t offset)
+void Mc6809::SetPcProfile(PcProfile* sampler)
 {
-	uint16_t address = 0;
-	uint8_t reg_ID = (postByte & 0x60) >> 5;
-
-	switch (reg_ID)
-	{
-	case 00:		// reg X
-		address = reg_X + offset;
-		break;
-	case 01:		// reg Y
-		address = reg_Y + offset;
-		break;
-	case 02:		// reg U
-		address = reg_U + offset;
-		break;
-	case 03:		// reg S
-		address = reg_S + offset;
-		break;
-	}
-	return(Read(address));
+	pcProfile = sampler;
+	pcCountdown = (sampler != nullptr) ? (int32_t)sampler->Interval() : 0;
 }
+#endif
+
 
 //*****************************************************************************
-//	Direct()
+//	Idle()
+//*****************************************************************************
+//	True while nothing can happen until a line changes:
+//		- halted, for as long as the HALT line is held
+//		- parked in SYNC with no interrupt line raised, masked or not
+//		- parked in CWAI with no unmasked interrupt line raised
+//		- on an instruction boundary at a branch to itself (BRA *, LBRA *,
+//			JMP *) or at a loop added with AddIdleLoop(), with no unmasked
+//			line raised
 //*****************************************************************************
-uint8_t Mc6809::Direct(uint8_t postByte, uint8_t clocksUsed)
+bool Mc6809::Idle()
 {
-	auto idxMode = (((postByte & 0x80) == 0) ? 0 : (postByte & 0x9f));
-
-	switch (idxMode)
-	{
-	case 0x84:		// no offset
-		clocksUsed = DirectNoOffset(postByte, clocksUsed);
-		break;
-	case 0x00:		// 5-bit offset
-		clocksUsed = Direct5bitOffset(postByte, clocksUsed);
-		break;
-	case 0x88:		// 8-bit offset
-		clocksUsed = Direct8BitOffset(postByte, clocksUsed);
-		break;
-	case 0x89:		// 16-bit offset
-		clocksUsed = Direct16BitOffset(postByte, clocksUsed);
-		break;
-	case 0x86:		// A Accumulator Offset
-		clocksUsed = DirectAccAOffset(postByte, clocksUsed);
-		break;
-	case 0x85:		// B Accumulator Offset
-		clocksUsed = DirectAccBOffset(postByte, clocksUsed);
-		break;
-	case 0x8b:		// D Accumulator Offset
-		clocksUsed = DirectAccDOffset(postByte, clocksUsed);
-		break;
-	case 0x80:		// Increment by 1
-		clocksUsed = DirectInc1Offset(postByte, clocksUsed);
-		break;
-	case 0x81:		// Increment by 2
-		clocksUsed = DirectInc2Offset(postByte, clocksUsed);
-		break;
-	case 0x82:		// Decrement by 1
-		clocksUsed = DirectDec1Offset(postByte, clocksUsed);
-		break;
-	case 0x83:		// Decrement by 2
-		clocksUsed = DirectDec2Offset(postByte, clocksUsed);
-		break;
-	case 0x8c:		// 8-bit offset from PC
-		clocksUsed = Direct8BitFromPcOffset(postByte, clocksUsed);
-		break;
-	case 0x8d:		// 16-bit offset from PC
-		clocksUsed = Direct16BitFromPcOffset(postByte, clocksUsed);
-		break;
-	case 0x8f:		// 16-bit address - INVALID
-	default:		// Invalid/Undefined values
-		clocksUsed = 0xff;
-		break;
-	}
-	return(clocksUsed);
+	if (exec == &Mc6809::HALT)
+		return((Pending() & LINE::HALT) != 0);
+	if (exec == &Mc6809::SYNC_inh)
+		return(waitState && (Pending() == 0));
+	if (Unmasked() != 0)
+		return(false);
+	if (exec != nullptr)
+		return(waitState);
+	return(IdleLoopAt(reg_PC));
 }
 
 
 //*****************************************************************************
-//	DirectNoOffset				Indexed - Direct - No Offset
-//								Constant offset from Regester   2s complement
+//	Unmasked()
+//*****************************************************************************
+//	The lines an instruction boundary acts on: Pending() less FIRQ while CC.F
+// is set and IRQ while CC.I is set.
 //*****************************************************************************
-uint8_t Mc6809::DirectNoOffset(uint8_t postByte, uint8_t clocksUsed)
+//	Returns:
+//	uint8_t - LINE bits
+//*****************************************************************************
+uint8_t Mc6809::Unmasked()
 {
-	uint8_t reg_ID = (postByte & 0x60) >> 5;
+	uint8_t pending = Pending();
 
-	switch (reg_ID)		//	R	Don't Care
+	if (pending & (LINE::FIRQ | LINE::IRQ))
 	{
-	case 00:		// reg X
-		reg_scratch = reg_X;
-		break;
-	case 01:		// reg Y
-		reg_scratch = reg_Y;
-		break;
-	case 02:		// reg U
-		reg_scratch = reg_U;
-		break;
-	case 03:		// reg S
-		reg_scratch = reg_S;
-		break;
+		ResolveCC();
+		if (reg_CC & CC::F)
+			pending &= ~LINE::FIRQ;
+		if (reg_CC & CC::I)
+			pending &= ~LINE::IRQ;
 	}
-	clocksUsed = 9;
-	return(clocksUsed);
+	return(pending);
 }
 
 
 //*****************************************************************************
-//	Direct5bitOffset			Indexed - Direct - 5-bit Offset
-//								Constant offset from Regester   2s complement
+//	IdleLoopAt()
+//*****************************************************************************
+//	Checks the code at pc against the built in self branches and the added
+// signatures, reading it without side effects.
 //*****************************************************************************
-uint8_t Mc6809::Direct5bitOffset(uint8_t postByte, uint8_t clocksUsed)
+bool Mc6809::IdleLoopAt(const uint16_t pc)
 {
-	switch (clocksUsed)
-	{
-	case 100:		//	R	Don't Care
-		reg_scratch = (((postByte & 0x10) == 0x10) ? 0xfff0 : 0x0000);
-		break;
-	case 101:		//	R	Don't Care
-		scratch_lo |= (postByte & 0x0f);
+	uint8_t code[3];
 
-		IndexedAddToScratchRegister(postByte);
-		clocksUsed = 9;
-		break;
-	}
-	return(clocksUsed);
-}
+	for (uint8_t n = 0; n < 3; n++)
+		code[n] = Read(pc + n, true);
 
+	if ((code[0] == 0x20) && (code[1] == 0xfe))								// BRA *
+		return(true);
+	if ((code[0] == 0x16) && (code[1] == 0xff) && (code[2] == 0xfd))		// LBRA *
+		return(true);
+	if ((code[0] == 0x7e) && (((code[1] << 8) | code[2]) == pc))			// JMP *
+		return(true);
 
-//*****************************************************************************
-//	Direct8BitOffset			Indexed - Direct - 8-Bit Offset
-//								Constant offset from Regester   2s complement
-//*****************************************************************************
-uint8_t Mc6809::Direct8BitOffset(uint8_t postByte, uint8_t clocksUsed)
-{
-	switch (clocksUsed)
+	for (uint8_t i = 0; i < idleLoopCount; i++)
 	{
-	case 100:		//	R	Offset
-		scratch_lo = Read(reg_PC++);
-		break;
-	case 101:		//	R	Don't Care
-		scratch_hi = (((scratch_lo & 0x80) == 0x80) ? 0xff : 0x00);
+		const IDLELOOP& loop = idleLoops[i];
 
-		IndexedAddToScratchRegister(postByte);
-		clocksUsed = 9;
-		break;
+		if (loop.pc != pc)
+			continue;
+
+		uint8_t n = 0;
+		while ((n < loop.length) && (Read(pc + n, true) == loop.code[n]))
+			n++;
+		if (n == loop.length)
+			return(true);
 	}
-	return(clocksUsed);
+	return(false);
 }
 
 
 //*****************************************************************************
-//	Direct16BitOffset			Indexed - Direct - 16-Bit Offset
-//								Constant offset from Regester   2s complement
+//	AddIdleLoop()
 //*****************************************************************************
-uint8_t Mc6809::Direct16BitOffset(uint8_t postByte, uint8_t clocksUsed)
-{
-	switch (clocksUsed)
-	{
-	case 100:		//	R	Offset High
-		scratch_hi = Read(reg_PC++);
-		break;
-	case 101:		//	R	Offset Low
-		scratch_lo = Read(reg_PC++);
-		break;
-	case 102:		//	R	Don't Care
-		break;
-	case 103:		//	R	Don't Care
-		IndexedAddToScratchRegister(postByte);
-		break;
-	case 104:		//	R	Don't Care
-		clocksUsed = 9;
-		break;
-	}
-	return(clocksUsed);
-}
-
-
+//	Marks the code at pc as an idle loop when it still reads as code[]. Only
+// add loops that can leave on nothing but an interrupt or an outside event,
+// such as a keyboard poll; time spent in them may be skipped.
 //*****************************************************************************
-//	DirectAccAOffset			Indexed - Direct - A Accumulator Offset
-//								Accumulator Offset from register 2s complement
+//	Returns:
+//	bool - false if the table is full or the signature is too long.
 //*****************************************************************************
-uint8_t Mc6809::DirectAccAOffset(uint8_t postByte, uint8_t clocksUsed)
+bool Mc6809::AddIdleLoop(const uint16_t pc, const uint8_t* code, const uint8_t length)
 {
-	switch (clocksUsed)
-	{
-	case 100:		//	R	Don't Care
-		scratch_lo = reg_A;
-		break;
-	case 101:		//	R	Don't Care
-		scratch_hi = ((reg_A & 0x80) == 0x80 ? 0xff : 0);
+	if ((idleLoopCount >= IDLE_LOOPS) || (length == 0) || (length > IDLE_LOOP_BYTES))
+		return(false);
 
-		IndexedAddToScratchRegister(postByte);
-		clocksUsed = 9;
-		break;
-	}
-	return(clocksUsed);
+	IDLELOOP& loop = idleLoops[idleLoopCount++];
+	loop.pc = pc;
+	loop.length = length;
+	for (uint8_t n = 0; n < length; n++)
+		loop.code[n] = code[n];
+	return(true);
 }
 
 
 //*****************************************************************************
-//	DirectAccBOffset			Indexed - Direct - B Accumulator Offset
-//								Accumulator Offset from register 2s complement
+//	ClearIdleLoops()
+//*****************************************************************************
+//	Drops every signature added with AddIdleLoop().
 //*****************************************************************************
-uint8_t Mc6809::DirectAccBOffset(uint8_t postByte, uint8_t clocksUsed)
+void Mc6809::ClearIdleLoops()
 {
-	switch (clocksUsed)
-	{
-	case 100:		//	R	Don't Care
-		scratch_lo = reg_B;
-		break;
-	case 101:		//	R	Don't Care
-		scratch_hi = ((reg_B & 0x80) == 0x80 ? 0xff : 0);
-
-		IndexedAddToScratchRegister(postByte);
-		clocksUsed = 9;
-		break;
-	}
-	return(clocksUsed);
+	idleLoopCount = 0;
 }
 
 
 //*****************************************************************************
-//	DirectAccDOffset			Indexed - Direct - D Accumulator Offset
-//								Accumulator Offset from register 2s complement
+//	GetCC()
+//*****************************************************************************
+//	Condition Code register as the program would see it, for debuggers and
+// front panels. Resolves any deferred flags first.
 //*****************************************************************************
-uint8_t Mc6809::DirectAccDOffset(uint8_t postByte, uint8_t clocksUsed)
+uint8_t Mc6809::GetCC()
 {
-	switch (clocksUsed)
-	{
-	case 100:		//	R	Don't Care
-		reg_scratch = reg_D;
-		break;
-	case 101:		//	R	Don't Care
-		break;
-	case 102:		//	R	Don't Care
-		break;
-	case 103:		//	R	Don't Care
-		IndexedAddToScratchRegister(postByte);
-		break;
-	case 104:		//	R	Don't Care
-		clocksUsed = 9;
-		break;
-	}
-	return(clocksUsed);
+	ResolveCC();
+	return(reg_CC);
 }
 
 
 //*****************************************************************************
-//	DirectInc1Offset			Indexed - Direct - Increment Offset by 1
-//								Auto Increment/Decrement Register
+//	GetRegisters()
 //*****************************************************************************
-uint8_t Mc6809::DirectInc1Offset(uint8_t postByte, uint8_t clocksUsed)
+//	Copies out every register the program can see, CC resolved. Only
+// meaningful between instructions (see Step()).
+//*****************************************************************************
+void Mc6809::GetRegisters(REGISTERS& regs)
 {
-	switch (clocksUsed)
-	{
-	case 100:		//	R	Don't Care
-		IndexedAddToScratchRegister(postByte);
-		break;
-	case 101:		//	R	Don't Care
-		IndexedIncRegister(postByte);
-		break;
-	case 102:		//	R	Don't Care
-		clocksUsed = 9;
-		break;
-	}
-	return(clocksUsed);
+	regs.pc = reg_PC;
+	regs.x = reg_X;
+	regs.y = reg_Y;
+	regs.u = reg_U;
+	regs.s = reg_S;
+	regs.a = reg_A;
+	regs.b = reg_B;
+	regs.dp = reg_DP;
+	regs.cc = GetCC();
 }
 
 
 //*****************************************************************************
-//	DirectInc2Offset			Indexed - Direct - Increment Offset by 2
-//								Auto Increment/Decrement Register
+//	Read()
+//*****************************************************************************
+//	Reads a byte of data from the address bus. RAM and ROM pages are read
+// through the MMU page table, only unmapped pages go to the MMU itself.
 //*****************************************************************************
-uint8_t Mc6809::DirectInc2Offset(uint8_t postByte, uint8_t clocksUsed)
+uint8_t Mc6809::Read(const uint16_t address, const bool readOnly)
 {
-	switch (clocksUsed)
+	const uint8_t* page = bus->ReadPage(address);
+	uint8_t data;
+
+	if (page != nullptr)
+		data = page[address & 0xff];
+	else
 	{
-	case 100:		//	R	Don't Care
-		IndexedAddToScratchRegister(postByte);
-		break;
-	case 101:		//	R	Don't Care
-		IndexedIncRegister(postByte);
-		break;
-	case 102:		//	R	Don't Care
-		IndexedIncRegister(postByte);
-		break;
-	case 103:		//	R	Don't Care
-		clocksUsed = 9;
-		break;
+		if (!readOnly)
+			bus->CatchUp(address, Mc6809::Now());
+		data = bus->Read(address, readOnly);
 	}
-	return(clocksUsed);
-}
-
 
-//*****************************************************************************
-//	DirectDec1Offset			Indexed - Direct - Decrement Offset by 1
-//								Auto Increment/Decrement Register
-//*****************************************************************************
-uint8_t Mc6809::DirectDec1Offset(uint8_t postByte, uint8_t clocksUsed)
-{
-	switch (clocksUsed)
+#ifdef USE_BUS_TRACE
+	if ((trace != nullptr) && !readOnly)
 	{
-	case 100:		//	R	Don't Care
-		IndexedDecRegister(postByte);
-		break;
-	case 101:		//	R	Don't Care
-		IndexedAddToScratchRegister(postByte);
-		break;
-	case 102:		//	R	Don't Care
-		clocksUsed = 9;
-		break;
+		trace->Record(traceCycle, address, data, BusTrace::READ | traceFlags);
+		traceFlags = 0;
 	}
-	return(clocksUsed);
+#endif
+	return (data);
 }
 
 
 //*****************************************************************************
-//	DirectDec2Offset			Indexed - Direct - Decrement Offset by 2
-//								Auto Increment/Decrement Register
+//	Write()
+//*****************************************************************************
+//	Writes a byte of data to the address bus. As with Read(), only unmapped
+// pages go to the MMU itself.
 //*****************************************************************************
-uint8_t Mc6809::DirectDec2Offset(uint8_t postByte, uint8_t clocksUsed)
+void Mc6809::Write(const uint16_t address, const uint8_t byte)
 {
-	switch (clocksUsed)
+	uint8_t* page = bus->WritePage(address);
+
+	if (page != nullptr)
+		page[address & 0xff] = byte;
+	else
 	{
-	case 100:		//	R	Don't Care
-		IndexedDecRegister(postByte);
-		break;
-	case 101:		//	R	Don't Care
-		IndexedDecRegister(postByte);
-		break;
-	case 102:		//	R	Don't Care
-		IndexedAddToScratchRegister(postByte);
-		break;
-	case 103:		//	R	Don't Care
-		clocksUsed = 9;
-		break;
+		bus->CatchUp(address, Mc6809::Now());
+		bus->Write(address, byte);
 	}
-	return(clocksUsed);
+#ifdef USE_BUS_TRACE
+	if (trace != nullptr)
+		trace->Record(traceCycle, address, byte, 0);
+#endif
+#ifdef USE_BLOCK_CACHE
+	// only a byte some block was decoded from, through any alias of the page
+	const uint8_t first = writeAlias[address >> 8];
+	uint8_t alias = first;
+	do
+	{
+		const uint16_t at = (alias << 8) | (address & 0xff);
+		if (codeMap[at >> 3] & (1 << (at & 0x07)))
+			InvalidateCodePage(alias);
+		alias = aliasNext[alias];
+	} while (alias != first);
+#elif defined(USE_DECODE_CACHE)
+	const uint8_t first = writeAlias[address >> 8];
+	uint8_t alias = first;
+	do
+	{
+		pageGeneration[alias]++;
+		alias = aliasNext[alias];
+	} while (alias != first);
+#endif
 }
 
 
 //*****************************************************************************
-//	Direct8BitFromPcOffset		Indexed - Direct - 8-Bit Offset
-//								Constant offset from Program Counter
-//								2s complement
+//	Fetch()
+//*****************************************************************************
+//	Retrieve opcodes, and determine addressing and instruction to execute
 //*****************************************************************************
-uint8_t Mc6809::Direct8BitFromPcOffset(uint8_t postByte, uint8_t clocksUsed)
+uint8_t Mc6809::Fetch(const uint16_t /*address*/)
 {
-	switch (clocksUsed)
-	{
-	case 100:		//	R	Offset
-		scratch_lo = Read(reg_PC++);
-		break;
-	case 101:		//	R	Don't Care
-		scratch_hi = ((scratch_lo & 0x80) == 0x80 ? 0xff : 0);
+	uint8_t opcode;
+#ifdef USE_BUS_TRACE
+	if (opCodePage == 0)
+		traceFlags = BusTrace::INSTRUCTION;
+#endif
+	opcode = Read(reg_PC);
 
-		reg_scratch += reg_PC;
-		clocksUsed = 9;
-		break;
+	if (opcode == 0x10)
+	{
+		opCodePage = 1;
+		clocksUsed = 1;
 	}
-	return(clocksUsed);
-}
-
-
-//*****************************************************************************
-//	Direct16BitFromPcOffset		Indexed - Direct - 16-Bit Offset
-//								Constant offset from Program Counter
-//								2s complement
-//*****************************************************************************
-uint8_t Mc6809::Direct16BitFromPcOffset(uint8_t postByte, uint8_t clocksUsed)
-{
-	switch (clocksUsed)
+	else if (opcode == 0x11)
 	{
-	case 100:		//	R	Offset High
-		scratch_hi = Read(reg_PC++);
-		break;
-	case 101:		//	R	Offset Low
-		scratch_lo = Read(reg_PC++);
-		break;
-	case 102:		//	R	Don't Care
-		break;
-	case 103:		//	R	Don't Care
-		break;
-	case 104:		//	R	Don't Care
-		break;
-	case 105:		//	R	Don't Care
-		reg_scratch += reg_PC;
-		clocksUsed = 9;
-		break;
+		opCodePage = 2;
+		clocksUsed = 1;
+	}
+	else
+	{
+		exec = OpCode[opCodePage][opcode].opcode;
+		++clocksUsed;
+	}
+
+#ifdef USE_OPCODE_PROFILE
+	// the prefix cycle is charged to the opcode after it
+	if (exec == nullptr)
+		profiling = nullptr;
+	else
+	{
+		profiling = &profile[opCodePage][opcode];
+		profiling->executions++;
+		profiling->cycles += (opCodePage != 0) ? 1 : 0;
 	}
+#endif
+
+	// process opcode and set it to execute it.
 	return(clocksUsed);
 }
 
 
+//*********************************************************************************************************************************
+//	Condition Code adjustments. This covers MOST adjustments. 
+//	Sets or Clears are handled in the function doing the setting or clearing
+//	Some other special adjustments are left in the function doing the setting
+// or clearing
+//
+//	The ALU flags (H N Z V C) are set through the SetCC_xxx() functions. They
+// record the operation, operands and result, and the flags themselves are only
+// worked out by ResolveCC() when something reads CC. With USE_LAZY_CC off they
+// are worked out straight away. Any function reading or partly writing reg_CC
+// must call ResolveCC() first. I, F and E are never deferred.
+//*********************************************************************************************************************************
+
+
 //*****************************************************************************
-//	Indirect()
+//	RecordCC()
 //*****************************************************************************
-uint8_t Mc6809::Indirect(uint8_t postByte, uint8_t clocksUsed)
+//	Record the last ALU operation. Flags still owed by an older operation that
+// this one does not replace are resolved first.
+//*****************************************************************************
+void Mc6809::RecordCC(uint8_t op, uint8_t flags, uint16_t dataA, uint16_t dataB, uint32_t result)
 {
-	auto idxMode = postByte & 0x9f;
+	if ((ccLazy & ~flags) != 0)
+		ResolveLazyCC();
 
-	if ((postByte & 0x80) == 0)
-		idxMode = 0;
+	ccOp = op;
+	ccLazy = flags;
+	ccA = dataA;
+	ccB = dataB;
+	ccR = result;
 
-	switch (idxMode)
-	{
-	case 0x94:		// no offset
-		clocksUsed = IndirectNoOffset(postByte, clocksUsed);
-		break;
-	case 0x00:		// 5-bit offset - DEFAULTS to 8-bit offset
-	case 0x98:		// 8-bit offset
-		clocksUsed = Indirect8BitOffset(postByte, clocksUsed);
-		break;
-	case 0x99:		// 16-bit offset
-		clocksUsed = Indirect16BitOffset(postByte, clocksUsed);
-		break;
-	case 0x96:		// A Accumulator Offset
-		clocksUsed = IndirectAccAOffset(postByte, clocksUsed);
-		break;
-	case 0x95:		// B Accumulator Offset
-		clocksUsed = IndirectAccBOffset(postByte, clocksUsed);
-		break;
-	case 0x9b:		// D Accumulator Offset
-		clocksUsed = IndirectAccDOffset(postByte, clocksUsed);
-		break;
-	case 0x91:		// Increment by 2
-		clocksUsed = IndirectInc2Offset(postByte, clocksUsed);
-		break;
-	case 0x93:		// Decrement by 2
-		clocksUsed = IndirectDec2Offset(postByte, clocksUsed);
-		break;
-	case 0x9c:		// 8-bit offset from PC
-		clocksUsed = Indirect8BitFromPcOffset(postByte, clocksUsed);
-		break;
-	case 0x9d:		// 16-bit offset from PC
-		clocksUsed = Indirect16BitFromPcOffset(postByte, clocksUsed);
-		break;
-	case 0x9f:		// 16-bit address
-		clocksUsed = Indirect16BitExtendedOffset(postByte, clocksUsed);
-		break;
-	case 0x90:		// Increment by 1 - NOT ALLOWED
-	case 0x92:		// Decrement by 1 - NOT ALLOWED
-	default:		// Invalid/Undefined values
-		clocksUsed = 0xff;
-		break;
-	}
-	return(clocksUsed);
+#ifndef USE_LAZY_CC
+	ResolveLazyCC();
+#endif
 }
 
 
 //*****************************************************************************
-//	IndirectNoOffset			Indexed - Indirect - No Offset
-//								Constant offset from Regester   2s complement
+//	ResolveCC()
+//*****************************************************************************
+//	Bring reg_CC up to date. Cheap when nothing is deferred.
 //*****************************************************************************
-uint8_t Mc6809::IndirectNoOffset(uint8_t postByte, uint8_t clocksUsed)
+inline void Mc6809::ResolveCC()
 {
-	switch (clocksUsed)
-	{
-	case 100:		//	R	Don't Care
-		break;
-	case 101:		//	R	Indirect High
-		scratch_hi = IndexedReadByteFromIndex(postByte, HIGH_BYTE);
-		break;
-	case 102:		//	R	Indirect Low
-		scratch_lo = IndexedReadByteFromIndex(postByte, LOW_BYTE);
-		break;
-	case 103:		//	Don't Care
-		clocksUsed = 9;
-		break;
-	}
-	return(clocksUsed);
+	if (ccLazy != 0)
+		ResolveLazyCC();
 }
 
 
 //*****************************************************************************
-//	Indirect8BitOffset			Indexed - Indirect - (5-bit ->) 8-bit Offset
-//								Constant offset from Regester   2s complement
+//	ResolveLazyCC()
+//*****************************************************************************
+//	Work out the deferred flags from the recorded operation.
 //*****************************************************************************
-uint8_t Mc6809::Indirect8BitOffset(uint8_t postByte, uint8_t clocksUsed)
+void Mc6809::ResolveLazyCC()
 {
-	static uint16_t offset;
+	uint8_t flags = 0;
 
-	switch (clocksUsed)
+	switch (ccOp)
 	{
-	case 100:		//	R	Offset
-		offset = IndexedReadByteFromIndex(postByte, SINGLE_BYTE);
+	case CCOP::ADD8:		// carry in = result - reg - data
+		flags = FlagsAdd8((uint8_t)ccA, (uint8_t)ccB, (uint8_t)(ccR - ccA - ccB));
 		break;
-	case 101:		//	Don't Care
-		if ((offset & 0x80) == 0x80)
-			offset |= 0xff00;
-		else
-			offset &= 0x00ff;
+	case CCOP::SUB8:		// borrow in = reg - data - result
+		flags = FlagsSub8((uint8_t)ccA, (uint8_t)ccB, (uint8_t)(ccA - ccB - ccR));
 		break;
-	case 102:		//	R	Indirect High
-		scratch_hi = Read(offset);
+	case CCOP::NZ8:
+		flags |= ((ccR & 0x80) != 0) ? CC::N : 0;
+		flags |= ((ccR & 0xff) == 0) ? CC::Z : 0;
 		break;
-	case 103:		//	R	Indirect Low
-		scratch_lo = Read(++offset);
+	case CCOP::ADD16:
+		flags |= (((ccA ^ ccR) & (ccB ^ ccR) & 0x8000) != 0) ? CC::V : 0;
+		flags |= ((ccR & 0x10000) != 0) ? CC::C : 0;
+		flags |= ((ccR & 0x8000) != 0) ? CC::N : 0;
+		flags |= ((ccR & 0xffff) == 0) ? CC::Z : 0;
 		break;
-	case 104:		//	R	Don't Care
-		clocksUsed = 9;
+	case CCOP::SUB16:
+		flags |= (((ccA ^ ccB) & (ccA ^ ccR) & 0x8000) != 0) ? CC::V : 0;
+		flags |= ((ccR & 0x10000) != 0) ? CC::C : 0;
+		// fall through
+	case CCOP::NZ16:
+		flags |= ((ccR & 0x8000) != 0) ? CC::N : 0;
+		flags |= ((ccR & 0xffff) == 0) ? CC::Z : 0;
 		break;
 	}
-	return(clocksUsed);
+
+	reg_CC = (reg_CC & ~ccLazy) | (flags & ccLazy);
+	ccLazy = 0;
 }
 
 
 //*****************************************************************************
-//	Indirect16BitOffset			Indexed - Indirect - 16-Bit Offset
-//								Constant offset from Regester   2s complement
+//	SetCC_NZ()
+//*****************************************************************************
+//	N and Z from result, V C H untouched
 //*****************************************************************************
-uint8_t Mc6809::Indirect16BitOffset(uint8_t postByte, uint8_t clocksUsed)
+void Mc6809::SetCC_NZ(uint8_t result)
 {
-	static uint16_t offset;
+	RecordCC(CCOP::NZ8, CC::N | CC::Z, 0, 0, result);
+}
 
-	switch (clocksUsed)
-	{
-	case 100:		//	R		Offset High
-		scratch_hi = IndexedReadByteFromIndex(postByte, HIGH_BYTE);
-		break;
-	case 101:		//	R		Offset Low
-		scratch_lo = IndexedReadByteFromIndex(postByte, LOW_BYTE);
-		break;
-	case 102:		//	R		Don't Care
-		offset = reg_scratch;
-		break;
-	case 103:		//	R		Don't Care
-		break;
-	case 104:		//	R		Don't Care
-		break;
-	case 105:		//	R		Indirect High
-		scratch_hi = Read(offset);
-		break;
-	case 106:		//	R		Indirect Low
-		scratch_lo = Read(++offset);
-		break;
-	case 107:		//	R		Don't Care
-		clocksUsed = 9;
-		break;
-	}
-	return(clocksUsed);
+void Mc6809::SetCC_NZ(uint16_t result)
+{
+	RecordCC(CCOP::NZ16, CC::N | CC::Z, 0, 0, result);
 }
 
 
 //*****************************************************************************
-//	IndirectAccAOffset			Indexed - Indirect - A Accumulator Offset
-//								Accumulator Offset from register 2s complement
+//	SetCC_NZ0()
+//*****************************************************************************
+//	N and Z from result, V cleared. Loads, stores, logic ops and TST
 //*****************************************************************************
-uint8_t Mc6809::IndirectAccAOffset(uint8_t postByte, uint8_t clocksUsed)
+void Mc6809::SetCC_NZ0(uint8_t result)
 {
-	static uint16_t offset;
+	RecordCC(CCOP::NZ8, CC::N | CC::Z | CC::V, 0, 0, result);
+}
 
-	switch (clocksUsed)
-	{
-	case 100:		//	R		Don't Care
-		offset = reg_A;
-		break;
-	case 101:		//	R		Don't Care
-		if ((offset & 0x80) == 0x80)
-			offset |= 0xff00;
-		else
-			offset &= 0x00ff;
-		break;
-	case 102:		//	R		Indirect High
-		scratch_hi = IndexedReadByteFromIndex(postByte, HIGH_BYTE);
-		break;
-	case 103:		//	R		Indirect Low
-		scratch_lo = IndexedReadByteFromIndex(postByte, LOW_BYTE);
-		break;
-	case 104:		//	R		Don't Care
-		reg_scratch += offset;
-		clocksUsed = 9;
-		break;
-	}
-	return(clocksUsed);
+void Mc6809::SetCC_NZ0(uint16_t result)
+{
+	RecordCC(CCOP::NZ16, CC::N | CC::Z | CC::V, 0, 0, result);
 }
 
 
 //*****************************************************************************
-//	IndirectAccBOffset			Indexed - Indirect - B Accumulator Offset
-//								Accumulator Offset from register 2s complement
+//	SetCC_Add()
+//*****************************************************************************
+//	H N Z V C for reg + data (+ carry). result holds the carry out of bit 7.
+//	The 16 bit form leaves H alone.
 //*****************************************************************************
-uint8_t Mc6809::IndirectAccBOffset(uint8_t postByte, uint8_t clocksUsed)
+void Mc6809::SetCC_Add(uint8_t reg, uint8_t data, uint16_t result)
 {
-	static uint16_t offset;
+	RecordCC(CCOP::ADD8, CC::H | CC::N | CC::Z | CC::V | CC::C, reg, data, result);
+}
 
-	switch (clocksUsed)
-	{
-	case 100:		//	R		Don't Care
-		offset = reg_A;
-		break;
-	case 101:		//	R		Don't Care
-		if ((offset & 0x80) == 0x80)
-			offset |= 0xff00;
-		else
-			offset &= 0x00ff;
-		break;
-	case 102:		//	R		Indirect High
-		scratch_hi = IndexedReadByteFromIndex(postByte, HIGH_BYTE);
-		break;
-	case 103:		//	R		Indirect Low
-		scratch_lo = IndexedReadByteFromIndex(postByte, LOW_BYTE);
-		break;
-	case 104:		//	R		Don't Care
-		reg_scratch += offset;
-		clocksUsed = 9;
-		break;
-	}
-	return(clocksUsed);
+void Mc6809::SetCC_Add(uint16_t reg, uint16_t data, uint32_t result)
+{
+	RecordCC(CCOP::ADD16, CC::N | CC::Z | CC::V | CC::C, reg, data, result);
 }
 
 
 //*****************************************************************************
-//	IndirectAccDOffset			Indexed - Indirect - D Accumulator Offset
-//								Accumulator Offset from register 2s complement
+//	SetCC_Sub()
+//*****************************************************************************
+//	N Z V C for reg - data (- borrow). SUB, SBC and CMP. H is left alone
+// (undefined on the 6809 for subtracts)
 //*****************************************************************************
-uint8_t Mc6809::IndirectAccDOffset(uint8_t postByte, uint8_t clocksUsed)
+void Mc6809::SetCC_Sub(uint8_t reg, uint8_t data, uint16_t result)
 {
-	static uint16_t offset;
+	RecordCC(CCOP::SUB8, CC::N | CC::Z | CC::V | CC::C, reg, data, result);
+}
 
-	switch (clocksUsed)
-	{
-	case 100:		//	R		Don't Care
-		offset = reg_D;
-		break;
-	case 101:		//	R		Don't Care
-		break;
-	case 102:		//	R		Don't Care
-		break;
-	case 103:		//	R		Don't Care
-		break;
-	case 104:		//	R		Don't Care
-		break;
-	case 105:		//	R		Indirect High
-		scratch_hi = IndexedReadByteFromIndex(postByte, HIGH_BYTE);
-		break;
-	case 106:		//	R		Indirect Low
-		scratch_lo = IndexedReadByteFromIndex(postByte, LOW_BYTE);
-		break;
-	case 107:		//	R		Don't Care
-		reg_scratch += offset;
-		clocksUsed = 9;
-		break;
-	}
-	return(clocksUsed);
+void Mc6809::SetCC_Sub(uint16_t reg, uint16_t data, uint32_t result)
+{
+	RecordCC(CCOP::SUB16, CC::N | CC::Z | CC::V | CC::C, reg, data, result);
 }
 
 
 //*****************************************************************************
-//	IndirectInc2Offset			Indexed - Indirect - Increment Offset by 2
-//								Auto Increment/Decrement Register
+//	AdjustCC_Z()
+//*****************************************************************************
+//	Set or Clear Zero Condition Code
 //*****************************************************************************
-uint8_t Mc6809::IndirectInc2Offset(uint8_t postByte, uint8_t clocksUsed)
+void Mc6809::AdjustCC_Z(uint8_t data)
 {
-	static uint16_t offset;
-
-	switch (clocksUsed)
-	{
-	case 100:		//	R		Don't Care
-		break;
-	case 101:		//	R		Don't Care
-		break;
-	case 102:		//	R		Don't Care
-		break;
-	case 103:		//	R		Don't Care
-		break;
-	case 104:		//	R		Indirect High
-		scratch_hi = IndexedReadByteFromIndex(postByte, HIGH_BYTE);
-		break;
-	case 105:		//	R		Indirect Low
-		scratch_lo = IndexedReadByteFromIndex(postByte, LOW_BYTE);
-		break;
-	case 106:		//	R		Don't Care
-		IndexedIncRegister(postByte);
-		IndexedIncRegister(postByte);
-		clocksUsed = 9;
-		break;
-	}
-	return(clocksUsed);
+	reg_CC = (data == 0) ? (reg_CC | CC::Z) : (reg_CC & ~CC::Z);
+	ccLazy &= ~CC::Z;
 }
 
 
 //*****************************************************************************
-//	IndirectDec2Offset			Indexed - Indirect - Decrement Offset by 2
-//								Auto Increment/Decrement Register
+//	AdjustCC_V()
+//*****************************************************************************
+//	Set or Clear Overflow Condition Code
 //*****************************************************************************
-uint8_t Mc6809::IndirectDec2Offset(uint8_t postByte, uint8_t clocksUsed)
+void Mc6809::AdjustCC_V(uint8_t reg)
 {
-	static uint16_t offset;
-
-	switch (clocksUsed)
-	{
-	case 100:		//	R		Don't Care
-		IndexedDecRegister(postByte);
-		break;
-	case 101:		//	R		Don't Care
-		IndexedDecRegister(postByte);
-		break;
-	case 102:		//	R		Don't Care
-		break;
-	case 103:		//	R		Don't Care
-		break;
-	case 104:		//	R		Indirect High
-		scratch_hi = IndexedReadByteFromIndex(postByte, HIGH_BYTE);
-		break;
-	case 105:		//	R		Indirect Low
-		scratch_lo = IndexedReadByteFromIndex(postByte, LOW_BYTE);
-		break;
-	case 106:		//	R		Don't Care
-		clocksUsed = 9;
-		break;
-	}
-	return(clocksUsed);
+	reg_CC = (((reg >> 6) & 0x01) != ((reg >> 7) & 0x01)) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
+	ccLazy &= ~CC::V;
 }
 
 
 //*****************************************************************************
-//	Indirect8BitFromPcOffset	Indexed - Indirect - 8-Bit Offset
-//								Constant offset from Program Counter
-//								2s complement
+//	AdjustCC_C()
+//*****************************************************************************
+//	Set or Clear Carry Condition Code
 //*****************************************************************************
-uint8_t Mc6809::Indirect8BitFromPcOffset(uint8_t postByte, uint8_t clocksUsed)
+void Mc6809::AdjustCC_C(uint16_t data)
 {
-	uint8_t reg_ID = (postByte & 0x60) >> 5;
-	static uint16_t offset;
-
-	switch (clocksUsed)
-	{
-	case 100:		//	R		Offset
-		offset = Read(reg_PC++);
-		break;
-	case 101:		//	R		Don't Care
-		if ((offset & 0x80) == 0x80)
-			offset |= 0xff00;
-		else
-			offset &= 0x00ff;
-		break;
-	case 102:		//	R		Indirect High
-		scratch_hi = PC_hi;
-		break;
-	case 103:		//	R		Indirect Low
-		scratch_lo = PC_lo;
-		break;
-	case 104:		//	R		Don't Care
-		reg_scratch += offset;
-		clocksUsed = 9;
-		break;
-	}
-	return(clocksUsed);
+	reg_CC = ((data & 0x0100) == 0x0100) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
+	ccLazy &= ~CC::C;
 }
 
 
 //*****************************************************************************
-//	Indirect16BitFromPcOffset	Indexed - Indirect - 16-Bit Offset
-//								Constant offset from Program Counter
-//								2s complement
+//	AdjustCC_Z()
+//*****************************************************************************
+//	Set or Clear Zero Condition Code
 //*****************************************************************************
-uint8_t Mc6809::Indirect16BitFromPcOffset(uint8_t postByte, uint8_t clocksUsed)
+void Mc6809::AdjustCC_Z(uint16_t data)
 {
-	uint8_t reg_ID = (postByte & 0x60) >> 5;
-	static uint16_t offset;
-
-	switch (clocksUsed)
-	{
-	case 100:		//	R		Offset High
-		offset = (Read(reg_PC++) << 4);
-		break;
-	case 101:		//	R		Offset Low
-		offset |= Read(reg_PC++);
-		break;
-	case 102:		//	R		Don't Care
-		break;
-	case 103:		//	R		Don't Care
-		break;
-	case 104:		//	R		Don't Care
-		break;
-	case 105:		//	R		Don't Care
-		break;
-	case 106:		//	R		Indirect High
-		scratch_hi = PC_hi;
-		break;
-	case 107:		//	R		Indirect Low
-		scratch_lo = PC_lo;
-		break;
-	case 108:		//	R		Don't Care
-		reg_scratch += offset;
-		clocksUsed = 9;
-		break;
-	}
-	return(clocksUsed);
+	reg_CC = (data == 0) ? (reg_CC | CC::Z) : (reg_CC & ~CC::Z);
+	ccLazy &= ~CC::Z;
 }
 
 
+//*********************************************************************************************************************************
+// Index mode determinations - to help process index modes
+//*********************************************************************************************************************************
+
+
+//*****************************************************************************
+//	Indexed()
+//*****************************************************************************
+//	Works out the effective address of an indexed instruction into
+// reg_scratch, from the post byte's entry in IndexedModes.
+//
+//	The _idx opcodes park clocksUsed at 100 once they have the post byte, and
+// call Indexed() with 101, 102, ... on the cycles after it. Offset bytes are
+// read from the first of those cycles, the register is adjusted and the
+// address worked out once the offset is in, and indirect modes read the
+// pointer on their last two cycles.
 //*****************************************************************************
-//	Indirect16BitExtendedOffset		Indexed - Extended Indirect - 16-Bit Address
-//									Constant offset from Program Counter
-//									2s complement
+//	Returns:
+//	uint8_t - 9 on the last cycle, so the opcode carries on at its case 10,
+//				255 for an illegal post byte, otherwise clocksUsed.
 //*****************************************************************************
-uint8_t Mc6809::Indirect16BitExtendedOffset(uint8_t postByte, uint8_t clocksUsed)
+uint8_t Mc6809::Indexed(uint8_t postByte, uint8_t clocksUsed)
 {
-	uint8_t reg_ID = (postByte & 0x60) >> 5;
-	static uint16_t address;
+	const IDXMODE& mode = IndexedModes[postByte];
+	uint8_t cycle = clocksUsed - 101;
+	uint16_t offset = 0;
 
-	switch (clocksUsed)
+#ifdef USE_OPCODE_PROFILE
+	if (cycle == 0)
+		postByteCount[postByte]++;
+#endif
+	if (mode.offset == IDX::ILLEGAL)
+		return(255);
+
+	// offset or address bytes following the post byte
+	if (cycle < mode.pgmBytes)
 	{
-	case 100:		//	R		Address High
-		address = (Read(reg_PC++) << 4);
-		break;
-	case 101:		//	R		Address Low
-		address |= Read(reg_PC++);
-		break;
-	case 102:		//	R		Don't Care
-		break;
-	case 103:		//	R		Indirect High
-		scratch_hi = Read(address);
-		break;
-	case 104:		//	R		Indirect Low
-		scratch_lo = Read(address + 1);
-		break;
-	case 105:		//	R		Don't Care
-		reg_scratch += address;
-		clocksUsed = 9;
-		break;
+		if (cycle + 1 < mode.pgmBytes)
+			scratch_hi = Read(reg_PC++);
+		else
+			scratch_lo = Read(reg_PC++);
+	}
+
+	// effective address, once the last offset byte is in
+	if (cycle == ((mode.pgmBytes > 1) ? 1 : 0))
+	{
+		switch (mode.offset)
+		{
+		case IDX::NO_OFFSET:
+			break;
+		case IDX::OFFSET_5BIT:
+			offset = (uint16_t)mode.offset5;
+			break;
+		case IDX::OFFSET_8BIT:
+			offset = (uint16_t)(int8_t)scratch_lo;
+			break;
+		case IDX::OFFSET_16BIT:
+			offset = reg_scratch;
+			break;
+		case IDX::OFFSET_A:
+			offset = (uint16_t)(int8_t)reg_A;
+			break;
+		case IDX::OFFSET_B:
+			offset = (uint16_t)(int8_t)reg_B;
+			break;
+		case IDX::OFFSET_D:
+			offset = reg_D;
+			break;
+		}
+
+		if (mode.reg == nullptr)					// [n16] extended indirect
+			reg_scratch = offset;
+		else
+		{
+			if (mode.step < 0)						// ,-R ,--R
+				this->*mode.reg += mode.step;
+			reg_scratch = (this->*mode.reg) + offset;
+			if (mode.step > 0)						// ,R+ ,R++
+				this->*mode.reg += mode.step;
+		}
+	}
+
+	// indirect, fetch the address stored at the effective address
+	if (mode.indirect)
+	{
+		if (cycle + 1 == mode.cycles)
+		{
+			indexedAddress = reg_scratch;
+			scratch_hi = Read(indexedAddress);
+		}
+		else if (cycle == mode.cycles)
+			scratch_lo = Read(indexedAddress + 1);
 	}
+
+	// cycle 0 is the base cost's own cycle, one more for each extra
+	if (cycle >= mode.cycles)
+		clocksUsed = 9;
 	return(clocksUsed);
 }
 
@@ -1307,7 +1144,8 @@ uint8_t Mc6809::Indirect16BitExtendedOffset(uint8_t postByte, uint8_t clocksUsed
 //*****************************************************************************
 uint8_t Mc6809::HALT()
 {
-	clocksUsed = Halt ? 1 : 255;
+	waitState = (Pending() & LINE::HALT) != 0;
+	clocksUsed = waitState ? 1 : 255;
 	return(clocksUsed);
 }
 
@@ -1320,9 +1158,10 @@ uint8_t Mc6809::RESET()
 	switch (++clocksUsed)
 	{
 	case 1:		//	R	Don't care			$fffe
-		Reset == false;
+		lines.fetch_and((uint8_t)~LINE::RESET);
 		break;
 	case 2:		//	R	Don't care			$fffe
+		ResolveCC();
 		reg_CC = (CC::I | CC::F);
 		break;
 	case 3:		//	R	Don't care			$fffe
@@ -1336,7 +1175,6 @@ uint8_t Mc6809::RESET()
 		PC_lo = Read(0xffff);
 		break;
 	case 7:		//	R	Don't care			$ffff
-		reg_CC = 0x00;
 		clocksUsed = 255;
 		break;
 	}
@@ -1354,45 +1192,47 @@ uint8_t Mc6809::NMI()
 	case 1:		//	R	?					PC
 		break;
 	case 2:		//	R	?					PC
+		lines.fetch_and((uint8_t)~LINE::NMI);		// taken, drop the edge latch
 		break;
 	case 3:		//	R	Don't care			$ffff
+		ResolveCC();
 		reg_CC |= CC::E;
 		break;
 	case 4:		// W	PC Low				SP-1	--SP
-		Write(reg_S--, PC_lo);
+		Write(--reg_S, PC_lo);
 		break;
 	case 5:		// W	PC High				SP-2	--SP
-		Write(reg_S--, PC_hi);
+		Write(--reg_S, PC_hi);
 		break;
 	case 6:		// W	User Stack Low		SP-3	--SP
-		Write(reg_S--, U_lo);
+		Write(--reg_S, U_lo);
 		break;
 	case 7:		// W	User Stack High		SP-4	--SP
-		Write(reg_S--, U_hi);
+		Write(--reg_S, U_hi);
 		break;
 	case 8:		// W	Y  Register Low		SP-5	--SP
-		Write(reg_S--, Y_lo);
+		Write(--reg_S, Y_lo);
 		break;
 	case 9:		// W	Y  Register High	SP-6	--SP
-		Write(reg_S--, Y_hi);
+		Write(--reg_S, Y_hi);
 		break;
 	case 10:	// W	X  Register Low		SP-7	--SP
-		Write(reg_S--, X_lo);
+		Write(--reg_S, X_lo);
 		break;
 	case 11:	// W	X  Register High	SP-8	--SP
-		Write(reg_S--, X_hi);
+		Write(--reg_S, X_hi);
 		break;
 	case 12:	// W	DP Register			SP-9	--SP
-		Write(reg_S--, reg_DP);
+		Write(--reg_S, reg_DP);
 		break;
 	case 13:	// W	B  Register			SP-10	--SP
-		Write(reg_S--, reg_B);
+		Write(--reg_S, reg_B);
 		break;
 	case 14:	// W	A  Register			SP-11	--SP
-		Write(reg_S--, reg_A);
+		Write(--reg_S, reg_A);
 		break;
 	case 15:	// W	CC Register			SP-12	--SP
-		Write(reg_S--, reg_CC);
+		Write(--reg_S, reg_CC);
 		break;
 	case 16:	//	R	Don't Care			$ffff
 		reg_CC |= (CC::I | CC::F);
@@ -1423,16 +1263,17 @@ uint8_t Mc6809::FIRQ()
 	case 2:		//	R	?					PC
 		break;
 	case 3:		//	R	Don't care			$ffff
+		ResolveCC();
 		reg_CC &= ~CC::E;
 		break;
 	case 4:		// W	PC Low				SP-1	--SP
-		Write(reg_S--, PC_lo);
+		Write(--reg_S, PC_lo);
 		break;
 	case 5:		// W	PC High				SP-2	--SP
-		Write(reg_S--, PC_hi);
+		Write(--reg_S, PC_hi);
 		break;
 	case 6:		// W	CC Register			SP-12	--SP
-		Write(reg_S--, reg_CC);
+		Write(--reg_S, reg_CC);
 		break;
 	case 7:		//	R	Don't Care			$ffff
 		reg_CC |= (CC::I | CC::F);
@@ -1463,43 +1304,44 @@ uint8_t Mc6809::IRQ()
 	case 2:		//	R	?					PC
 		break;
 	case 3:		//	R	Don't care			$ffff
+		ResolveCC();
 		reg_CC |= CC::E;
 		break;
 	case 4:		// W	PC Low				SP-1	--SP
-		Write(reg_S--, PC_lo);
+		Write(--reg_S, PC_lo);
 		break;
 	case 5:		// W	PC High				SP-2	--SP
-		Write(reg_S--, PC_hi);
+		Write(--reg_S, PC_hi);
 		break;
 	case 6:		// W	User Stack Low		SP-3	--SP
-		Write(reg_S--, U_lo);
+		Write(--reg_S, U_lo);
 		break;
 	case 7:		// W	User Stack High		SP-4	--SP
-		Write(reg_S--, U_hi);
+		Write(--reg_S, U_hi);
 		break;
 	case 8:		// W	Y  Register Low		SP-5	--SP
-		Write(reg_S--, Y_lo);
+		Write(--reg_S, Y_lo);
 		break;
 	case 9:		// W	Y  Register High	SP-6	--SP
-		Write(reg_S--, Y_hi);
+		Write(--reg_S, Y_hi);
 		break;
 	case 10:	// W	X  Register Low		SP-7	--SP
-		Write(reg_S--, X_lo);
+		Write(--reg_S, X_lo);
 		break;
 	case 11:	// W	X  Register High	SP-8	--SP
-		Write(reg_S--, X_hi);
+		Write(--reg_S, X_hi);
 		break;
 	case 12:	// W	DP Register			SP-9	--SP
-		Write(reg_S--, reg_DP);
+		Write(--reg_S, reg_DP);
 		break;
 	case 13:	// W	B  Register			SP-10	--SP
-		Write(reg_S--, reg_B);
+		Write(--reg_S, reg_B);
 		break;
 	case 14:	// W	A  Register			SP-11	--SP
-		Write(reg_S--, reg_A);
+		Write(--reg_S, reg_A);
 		break;
 	case 15:	// W	CC Register			SP-12	--SP
-		Write(reg_S--, reg_CC);
+		Write(--reg_S, reg_CC);
 		break;
 	case 16:	//	R	Don't Care			$ffff
 		reg_CC |= (CC::I | CC::F);
@@ -1565,13 +1407,10 @@ uint8_t Mc6809::ADCA_dir()
 		break;
 	case 4:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
+		ResolveCC();
 		data = reg_A + scratch_lo + ((reg_CC & CC::C) == CC::C ? 1 : 0);
-		AdjustCC_V(scratch_lo, reg_A, (data & 0xff));
+		SetCC_Add(reg_A, scratch_lo, data);
 		reg_A = (data & 0xff);
-		AdjustCC_H(reg_A);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -1601,13 +1440,10 @@ uint8_t Mc6809::ADCA_ext()	// H N Z V C all modified. reg_A modified
 		break;
 	case 5:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
+		ResolveCC();
 		data = reg_A + scratch_lo + ((reg_CC & CC::C) == CC::C ? 1 : 0);
-		AdjustCC_V(scratch_lo, reg_A, (data & 0xff));
+		SetCC_Add(reg_A, scratch_lo, data);
 		reg_A = (data & 0xff);
-		AdjustCC_H(reg_A);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -1629,13 +1465,10 @@ uint8_t Mc6809::ADCA_imm()	// H N Z V C all modified. reg_A modified
 		break;
 	case 2:		//	R	Data				PC+1
 		scratch_lo = Read(reg_PC++);
+		ResolveCC();
 		data = reg_A + scratch_lo + ((reg_CC & CC::C) == CC::C ? 1 : 0);
-		AdjustCC_V(scratch_lo, reg_A, (data & 0xff));
+		SetCC_Add(reg_A, scratch_lo, data);
 		reg_A = (data & 0xff);
-		AdjustCC_H(reg_A);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -1663,13 +1496,10 @@ uint8_t Mc6809::ADCB_dir()
 		break;
 	case 4:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
+		ResolveCC();
 		data = reg_B + scratch_lo + ((reg_CC & CC::C) == CC::C ? 1 : 0);
-		AdjustCC_V(scratch_lo, reg_B, (data & 0xff));
+		SetCC_Add(reg_B, scratch_lo, data);
 		reg_B = (data & 0xff);
-		AdjustCC_H(reg_B);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -1699,13 +1529,10 @@ uint8_t Mc6809::ADCB_ext()
 		break;
 	case 5:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
+		ResolveCC();
 		data = reg_B + scratch_lo + ((reg_CC & CC::C) == CC::C ? 1 : 0);
-		AdjustCC_V(scratch_lo, reg_B, (data & 0xff));
+		SetCC_Add(reg_B, scratch_lo, data);
 		reg_B = (data & 0xff);
-		AdjustCC_H(reg_B);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -1727,13 +1554,10 @@ uint8_t Mc6809::ADCB_imm()
 		break;
 	case 2:		//	R	Data				PC+1
 		scratch_lo = Read(reg_PC++);
+		ResolveCC();
 		data = reg_B + scratch_lo + ((reg_CC & CC::C) == CC::C ? 1 : 0);
-		AdjustCC_V(scratch_lo, reg_B, (data & 0xff));
+		SetCC_Add(reg_B, scratch_lo, data);
 		reg_B = (data & 0xff);
-		AdjustCC_H(reg_B);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -1762,12 +1586,8 @@ uint8_t Mc6809::ADDA_dir()
 	case 4:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
 		data = reg_A + scratch_lo;
-		AdjustCC_V(scratch_lo, reg_A, (data & 0xff));
+		SetCC_Add(reg_A, scratch_lo, data);
 		reg_A = (data & 0xff);
-		AdjustCC_H(reg_A);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -1798,12 +1618,8 @@ uint8_t Mc6809::ADDA_ext()
 	case 5:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
 		data = reg_A + scratch_lo;
-		AdjustCC_V(scratch_lo, reg_A, (data & 0xff));
+		SetCC_Add(reg_A, scratch_lo, data);
 		reg_A = (data & 0xff);
-		AdjustCC_H(reg_A);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -1826,12 +1642,8 @@ uint8_t Mc6809::ADDA_imm()
 	case 2:		//	R	Data				PC+1
 		scratch_lo = Read(reg_PC++);
 		data = reg_A + scratch_lo;
-		AdjustCC_V(scratch_lo, reg_A, (data & 0xff));
+		SetCC_Add(reg_A, scratch_lo, data);
 		reg_A = (data & 0xff);
-		AdjustCC_H(reg_A);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -1860,12 +1672,8 @@ uint8_t Mc6809::ADDB_dir()
 	case 4:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
 		data = reg_B + scratch_lo;
-		AdjustCC_V(scratch_lo, reg_B, (data & 0xff));
+		SetCC_Add(reg_B, scratch_lo, data);
 		reg_B = (data & 0xff);
-		AdjustCC_H(reg_B);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -1896,12 +1704,8 @@ uint8_t Mc6809::ADDB_ext()
 	case 5:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
 		data = reg_B + scratch_lo;
-		AdjustCC_V(scratch_lo, reg_B, (data & 0xff));
+		SetCC_Add(reg_B, scratch_lo, data);
 		reg_B = (data & 0xff);
-		AdjustCC_H(reg_B);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -1924,12 +1728,8 @@ uint8_t Mc6809::ADDB_imm()
 	case 2:		//	R	Data				PC+1
 		scratch_lo = Read(reg_PC++);
 		data = reg_B + scratch_lo;
-		AdjustCC_V(scratch_lo, reg_B, (data & 0xff));
+		SetCC_Add(reg_B, scratch_lo, data);
 		reg_B = (data & 0xff);
-		AdjustCC_H(reg_B);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -1942,33 +1742,28 @@ uint8_t Mc6809::ADDB_imm()
 //*****************************************************************************
 uint8_t Mc6809::ADDD_dir()
 {
-	static uint16_t address;
-	static uint32_t data;
+	uint32_t data;
 	switch (++clocksUsed)
 	{
 	case 1:		//	R	Opcode Fetch		PC
 		reg_PC++;
 		break;
 	case 2:		//	R	Address Low			PC+1
-		address = Read(reg_PC++);
+		reg_operand = Read(reg_PC++);
 		break;
 	case 3:		//	R	Don't Care			$ffff
-		address |= (reg_DP << 8);
+		reg_operand |= (reg_DP << 8);
 		break;
 	case 4:		//	R	Data High			$ffff
-		scratch_hi = Read(address);
+		scratch_hi = Read(reg_operand);
 		break;
 	case 5:		//	R	Data Low			EA+1
-		scratch_lo = Read(++address);
+		scratch_lo = Read(++reg_operand);
 		break;
 	case 6:		//	R	Don't Care			$ffff
 		data = reg_D + reg_scratch;
-		AdjustCC_V(reg_scratch, reg_D, (data & 0xffff));
+		SetCC_Add(reg_D, reg_scratch, data);
 		reg_D = data & 0xffff;
-		AdjustCC_H(reg_B);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -1981,7 +1776,6 @@ uint8_t Mc6809::ADDD_dir()
 //*****************************************************************************
 uint8_t Mc6809::ADDD_ext()
 {
-	static uint16_t address;
 	uint32_t data;
 
 	switch (++clocksUsed)
@@ -1990,27 +1784,23 @@ uint8_t Mc6809::ADDD_ext()
 		reg_PC++;
 		break;
 	case 2:		//	R	Address High		PC+1
-		address = Read(reg_PC++) << 8;
+		reg_operand = Read(reg_PC++) << 8;
 		break;
 	case 3:		//	R	Address Low			PC+2
-		address |= Read(reg_PC++);
+		reg_operand |= Read(reg_PC++);
 		break;
 	case 4:		//	R	Don't Care			$ffff
 		break;
 	case 5:		//	R	address High			$ffff
-		scratch_hi = Read(address) << 8;
+		scratch_hi = Read(reg_operand) << 8;
 		break;
 	case 6:		//	R	address Low			EA+1
-		scratch_lo |= Read(++address);
+		scratch_lo |= Read(++reg_operand);
 		break;
 	case 7:		//	R	Don't Care			$ffff
 		data = reg_D + reg_scratch;
-		AdjustCC_V(reg_scratch, reg_D, (data & 0xffff));
+		SetCC_Add(reg_D, reg_scratch, data);
 		reg_D = data & 0xffff;
-		AdjustCC_H(reg_B);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -2038,12 +1828,8 @@ uint8_t Mc6809::ADDD_imm()
 		break;
 	case 4:		//	R	Don't Care			$ffff
 		data = reg_D + reg_scratch;
-		AdjustCC_V(reg_scratch, reg_D, (data & 0xffff));
+		SetCC_Add(reg_D, reg_scratch, data);
 		reg_D = data & 0xffff;
-		AdjustCC_H(reg_B);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -2070,9 +1856,7 @@ uint8_t Mc6809::ANDA_dir()
 	case 4:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
 		reg_A &= scratch_lo;
-		reg_CC &= ~CC::V;
-		AdjustCC_Z(reg_A);
-		AdjustCC_N(reg_A);
+		SetCC_NZ0(reg_A);
 		clocksUsed = 255;
 		break;
 	}
@@ -2101,9 +1885,7 @@ uint8_t Mc6809::ANDA_ext()
 	case 5:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
 		reg_A &= scratch_lo;
-		reg_CC &= ~CC::V;
-		AdjustCC_Z(reg_A);
-		AdjustCC_N(reg_A);
+		SetCC_NZ0(reg_A);
 		clocksUsed = 255;
 		break;
 	}
@@ -2124,9 +1906,7 @@ uint8_t Mc6809::ANDA_imm()
 	case 2:		//	R	Data				PC+1
 		scratch_lo = Read(reg_PC++);
 		reg_A &= scratch_lo;
-		reg_CC &= ~CC::V;
-		AdjustCC_Z(reg_A);
-		AdjustCC_N(reg_A);
+		SetCC_NZ0(reg_A);
 		clocksUsed = 255;
 		break;
 	}
@@ -2153,9 +1933,7 @@ uint8_t Mc6809::ANDB_dir()
 	case 4:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
 		reg_B &= scratch_lo;
-		reg_CC &= ~CC::V;
-		AdjustCC_Z(reg_B);
-		AdjustCC_N(reg_B);
+		SetCC_NZ0(reg_B);
 		clocksUsed = 255;
 		break;
 	}
@@ -2184,9 +1962,7 @@ uint8_t Mc6809::ANDB_ext()
 	case 5:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
 		reg_B &= scratch_lo;
-		reg_CC &= ~CC::V;
-		AdjustCC_Z(reg_B);
-		AdjustCC_N(reg_B);
+		SetCC_NZ0(reg_B);
 		clocksUsed = 255;
 		break;
 	}
@@ -2207,9 +1983,7 @@ uint8_t Mc6809::ANDB_imm()
 	case 2:		//	R	Data				PC+1
 		scratch_lo = Read(reg_PC++);
 		reg_B &= scratch_lo;
-		reg_CC &= ~CC::V;
-		AdjustCC_Z(reg_B);
-		AdjustCC_N(reg_B);
+		SetCC_NZ0(reg_B);
 		clocksUsed = 255;
 		break;
 	}
@@ -2231,6 +2005,7 @@ uint8_t Mc6809::ANDCC_imm()
 		scratch_lo = Read(reg_PC++);
 		break;
 	case 3:		//	R	Don't Care			$ffff
+		ResolveCC();
 		reg_CC &= scratch_lo;
 		clocksUsed = 255;
 		break;
@@ -2254,8 +2029,7 @@ uint8_t Mc6809::ASLA_LSLA_inh()
 		AdjustCC_C((uint16_t)(reg_A << 1));
 		AdjustCC_V(reg_A);
 		reg_A = (reg_A << 1) & 0xfe;
-		AdjustCC_Z(reg_A);
-		AdjustCC_N(reg_A);
+		SetCC_NZ(reg_A);
 		//reg_PC++;
 		clocksUsed = 255;
 		break;
@@ -2279,8 +2053,7 @@ uint8_t Mc6809::ASLB_LSLB_inh()
 		AdjustCC_C((uint16_t)(reg_B << 1));
 		AdjustCC_V(reg_B);
 		reg_B = (reg_B << 1) & 0xfe;
-		AdjustCC_Z(reg_B);
-		AdjustCC_N(reg_B);
+		SetCC_NZ(reg_B);
 		//reg_PC++;
 		clocksUsed = 255;
 		break;
@@ -2295,7 +2068,6 @@ uint8_t Mc6809::ASLB_LSLB_inh()
 //*****************************************************************************
 uint8_t Mc6809::ASL_LSL_dir()
 {
-	static uint8_t data_lo;
 	switch (++clocksUsed)
 	{
 	case 1:		//	R	Opcode Fetch		PC
@@ -2308,17 +2080,16 @@ uint8_t Mc6809::ASL_LSL_dir()
 		scratch_hi = reg_DP;
 		break;
 	case 4:		//	R	Data				EA
-		data_lo = Read(reg_scratch);
+		operand_lo = Read(reg_scratch);
 		break;
 	case 5:		//	R	Don't care			$ffff
-		AdjustCC_C((uint16_t)(data_lo << 1));
-		AdjustCC_V(data_lo);
-		data_lo = (data_lo << 1) & 0xfe;
-		AdjustCC_Z(data_lo);
-		AdjustCC_N(data_lo);
+		AdjustCC_C((uint16_t)(operand_lo << 1));
+		AdjustCC_V(operand_lo);
+		operand_lo = (operand_lo << 1) & 0xfe;
+		SetCC_NZ(operand_lo);
 		break;
 	case 6:		//	W	Data				EA
-		Write(reg_scratch, data_lo);
+		Write(reg_scratch, operand_lo);
 		clocksUsed = 255;
 		break;
 	}
@@ -2332,7 +2103,6 @@ uint8_t Mc6809::ASL_LSL_dir()
 //*****************************************************************************
 uint8_t Mc6809::ASL_LSL_ext()
 {
-	static uint8_t data_lo;
 	switch (++clocksUsed)
 	{
 	case 1:		//	R	Opcode Fetch		PC
@@ -2347,17 +2117,16 @@ uint8_t Mc6809::ASL_LSL_ext()
 	case 4:		//	R	Don't care			$ffff
 		break;
 	case 5:		//	R	Data				EA
-		data_lo = Read(reg_scratch);
+		operand_lo = Read(reg_scratch);
 		break;
 	case 6:		//	R	Don't care			$ffff
-		AdjustCC_C((uint16_t)(data_lo << 1));
-		AdjustCC_V(data_lo);
-		data_lo = (data_lo << 1) & 0xfe;
-		AdjustCC_Z(data_lo);
-		AdjustCC_N(data_lo);
+		AdjustCC_C((uint16_t)(operand_lo << 1));
+		AdjustCC_V(operand_lo);
+		operand_lo = (operand_lo << 1) & 0xfe;
+		SetCC_NZ(operand_lo);
 		break;
 	case 7:		//	W	Data				EA
-		Write(reg_scratch, data_lo);
+		Write(reg_scratch, operand_lo);
 		clocksUsed = 255;
 		break;
 	}
@@ -2377,10 +2146,10 @@ uint8_t Mc6809::ASRA_inh()
 		break;
 	case 2:		//	R	Don't Care			PC+1
 		scratch_lo = reg_A & 0x80;
+		ResolveCC();
 		reg_CC = ((reg_A & 0x01) == 1) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
 		reg_A = ((reg_A >> 1) & 0x7f) | scratch_lo;
-		AdjustCC_Z(reg_A);
-		AdjustCC_N(reg_A);
+		SetCC_NZ(reg_A);
 		//reg_PC++;
 		clocksUsed = 255;
 		break;
@@ -2401,10 +2170,10 @@ uint8_t Mc6809::ASRB_inh()
 		break;
 	case 2:		//	R	Don't Care			PC+1
 		scratch_lo = reg_B & 0x80;
+		ResolveCC();
 		reg_CC = ((reg_B & 0x01) == 1) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
 		reg_A = ((reg_B >> 1) & 0x7f) | scratch_lo;
-		AdjustCC_Z(reg_B);
-		AdjustCC_N(reg_B);
+		SetCC_NZ(reg_B);
 		//reg_PC++;
 		clocksUsed = 255;
 		break;
@@ -2418,7 +2187,6 @@ uint8_t Mc6809::ASRB_inh()
 //*****************************************************************************
 uint8_t Mc6809::ASR_dir()
 {
-	static uint8_t data_lo;
 	uint8_t dataSign;
 	switch (++clocksUsed)
 	{
@@ -2432,17 +2200,17 @@ uint8_t Mc6809::ASR_dir()
 		scratch_hi = reg_DP;
 		break;
 	case 4:		//	R	Data				EA
-		data_lo = Read(reg_scratch);
+		operand_lo = Read(reg_scratch);
 		break;
 	case 5:		//	R	Don't care			$ffff
-		dataSign = data_lo & 0x80;
-		reg_CC = ((data_lo & 0x01) == 1) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
-		reg_A = ((data_lo >> 1) & 0x7f) | dataSign;
-		AdjustCC_Z(data_lo);
-		AdjustCC_N(data_lo);
+		dataSign = operand_lo & 0x80;
+		ResolveCC();
+		reg_CC = ((operand_lo & 0x01) == 1) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
+		reg_A = ((operand_lo >> 1) & 0x7f) | dataSign;
+		SetCC_NZ(operand_lo);
 		break;
 	case 6:		//	W	Data				EA
-		Write(reg_scratch, data_lo);
+		Write(reg_scratch, operand_lo);
 		clocksUsed = 255;
 		break;
 	}
@@ -2455,7 +2223,6 @@ uint8_t Mc6809::ASR_dir()
 //*****************************************************************************
 uint8_t Mc6809::ASR_ext()
 {
-	static uint8_t data_lo;
 	uint8_t dataSign;
 
 	switch (++clocksUsed)
@@ -2472,17 +2239,17 @@ uint8_t Mc6809::ASR_ext()
 	case 4:		//	R	Don't care			$ffff
 		break;
 	case 5:		//	R	Data				EA
-		data_lo = Read(reg_scratch);
+		operand_lo = Read(reg_scratch);
 		break;
 	case 6:		//	R	Don't care			$ffff
-		dataSign = data_lo & 0x80;
-		reg_CC = ((data_lo & 0x01) == 1) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
-		reg_A = ((data_lo >> 1) & 0x7f) | dataSign;
-		AdjustCC_Z(data_lo);
-		AdjustCC_N(data_lo);
+		dataSign = operand_lo & 0x80;
+		ResolveCC();
+		reg_CC = ((operand_lo & 0x01) == 1) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
+		reg_A = ((operand_lo >> 1) & 0x7f) | dataSign;
+		SetCC_NZ(operand_lo);
 		break;
 	case 7:		//	W	Data				EA
-		Write(reg_scratch, data_lo);
+		Write(reg_scratch, operand_lo);
 		clocksUsed = 255;
 		break;
 	}
@@ -2505,6 +2272,7 @@ uint8_t Mc6809::BEQ_rel()
 		scratch_hi = (((scratch_lo & 0x80) == 0x80) ? 0xff : 0x00);
 		break;
 	case 3:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if ((reg_CC & CC::Z) == CC::Z)
 			reg_PC += reg_scratch;
 		clocksUsed = 255;
@@ -2529,7 +2297,8 @@ uint8_t Mc6809::BGE_rel()
 		scratch_hi = (((scratch_lo & 0x80) == 0x80) ? 0xff : 0x00);
 		break;
 	case 3:		//	R	Don't Care			$ffff
-		if (((reg_CC & CC::C) == CC::C) == ((reg_CC & CC::V) == CC::V))
+		ResolveCC();
+		if (((reg_CC & CC::N) == CC::N) == ((reg_CC & CC::V) == CC::V))
 			reg_PC += reg_scratch;
 		clocksUsed = 255;
 		break;
@@ -2553,6 +2322,7 @@ uint8_t Mc6809::BGT_rel()
 		scratch_hi = (((scratch_lo & 0x80) == 0x80) ? 0xff : 0x00);
 		break;
 	case 3:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if ((((reg_CC & CC::N) == CC::N) && ((reg_CC & CC::V) == CC::V)) && ((reg_CC & CC::Z) == 0))
 			reg_PC += reg_scratch;
 		clocksUsed = 255;
@@ -2577,6 +2347,7 @@ uint8_t Mc6809::BHI_rel()
 		scratch_hi = (((scratch_lo & 0x80) == 0x80) ? 0xff : 0x00);
 		break;
 	case 3:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if (((reg_CC & CC::C) != CC::C) && ((reg_CC & CC::Z) != CC::Z))
 			reg_PC += reg_scratch;
 		clocksUsed = 255;
@@ -2602,6 +2373,7 @@ uint8_t Mc6809::BHS_BCC_rel()
 		scratch_hi = (((scratch_lo & 0x80) == 0x80) ? 0xff : 0x00);
 		break;
 	case 3:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if ((reg_CC & CC::C) != CC::C)
 			reg_PC += reg_scratch;
 		clocksUsed = 255;
@@ -2630,9 +2402,7 @@ uint8_t Mc6809::BITA_dir()
 	case 4:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
 		reg_A &= scratch_lo;
-		reg_CC &= ~CC::V;
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
+		SetCC_NZ0(reg_A);
 		clocksUsed = 255;
 		break;
 	}
@@ -2661,9 +2431,7 @@ uint8_t Mc6809::BITA_ext()
 	case 5:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
 		reg_A &= scratch_lo;
-		reg_CC &= ~CC::V;
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
+		SetCC_NZ0(reg_A);
 		clocksUsed = 255;
 		break;
 	}
@@ -2684,9 +2452,7 @@ uint8_t Mc6809::BITA_imm()
 	case 2:		//	R	Data				PC+1
 		scratch_lo = Read(reg_PC++);
 		reg_A &= scratch_lo;
-		reg_CC &= ~CC::V;
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
+		SetCC_NZ0(reg_A);
 		clocksUsed = 255;
 		break;
 	}
@@ -2713,9 +2479,7 @@ uint8_t Mc6809::BITB_dir()
 	case 4:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
 		reg_B &= scratch_lo;
-		reg_CC &= ~CC::V;
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
+		SetCC_NZ0(reg_B);
 		clocksUsed = 255;
 		break;
 	}
@@ -2744,9 +2508,7 @@ uint8_t Mc6809::BITB_ext()
 	case 5:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
 		reg_B &= scratch_lo;
-		reg_CC &= ~CC::V;
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
+		SetCC_NZ0(reg_B);
 		clocksUsed = 255;
 		break;
 	}
@@ -2767,9 +2529,7 @@ uint8_t Mc6809::BITB_imm()
 	case 2:		//	R	Data				PC+1
 		scratch_lo = Read(reg_PC++);
 		reg_B &= scratch_lo;
-		reg_CC &= ~CC::V;
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
+		SetCC_NZ0(reg_B);
 		clocksUsed = 255;
 		break;
 	}
@@ -2792,6 +2552,7 @@ uint8_t Mc6809::BLE_rel()
 		scratch_hi = (((scratch_lo & 0x80) == 0x80) ? 0xff : 0x00);
 		break;
 	case 3:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if (((reg_CC & CC::Z) == CC::Z) ||
 			(((reg_CC & CC::N) == CC::N) && (reg_CC & CC::V) != CC::V) ||
 			(((reg_CC & CC::N) != CC::N) && (reg_CC & CC::V) == CC::V))
@@ -2819,6 +2580,7 @@ uint8_t Mc6809::BLO_BCS_rel()
 		scratch_hi = (((scratch_lo & 0x80) == 0x80) ? 0xff : 0x00);
 		break;
 	case 3:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if ((reg_CC & CC::C) == CC::C)
 			reg_PC += reg_scratch;
 		clocksUsed = 255;
@@ -2843,6 +2605,7 @@ uint8_t Mc6809::BLS_rel()
 		scratch_hi = (((scratch_lo & 0x80) == 0x80) ? 0xff : 0x00);
 		break;
 	case 3:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if (((reg_CC & CC::C) == CC::C) || ((reg_CC & CC::Z) == CC::Z))
 			reg_PC += reg_scratch;
 		clocksUsed = 255;
@@ -2867,7 +2630,8 @@ uint8_t Mc6809::BLT_rel()
 		scratch_hi = (((scratch_lo & 0x80) == 0x80) ? 0xff : 0x00);
 		break;
 	case 3:		//	R	Don't Care			$ffff
-		if (((reg_CC & CC::C) == CC::C) != ((reg_CC & CC::N) == CC::N))
+		ResolveCC();
+		if (((reg_CC & CC::N) == CC::N) != ((reg_CC & CC::V) == CC::V))
 			reg_PC += reg_scratch;
 		clocksUsed = 255;
 		break;
@@ -2891,6 +2655,7 @@ uint8_t Mc6809::BMI_rel()
 		scratch_hi = (((scratch_lo & 0x80) == 0x80) ? 0xff : 0x00);
 		break;
 	case 3:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if ((reg_CC & CC::N) == CC::N)
 			reg_PC += reg_scratch;
 		clocksUsed = 255;
@@ -2915,6 +2680,7 @@ uint8_t Mc6809::BNE_rel()
 		scratch_hi = (((scratch_lo & 0x80) == 0x80) ? 0xff : 0x00);
 		break;
 	case 3:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if ((reg_CC & CC::Z) != CC::Z)
 			reg_PC += reg_scratch;
 		clocksUsed = 255;
@@ -2939,6 +2705,7 @@ uint8_t Mc6809::BPL_rel()
 		scratch_hi = (((scratch_lo & 0x80) == 0x80) ? 0xff : 0x00);
 		break;
 	case 3:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if ((reg_CC & CC::N) != CC::N)
 			reg_PC += reg_scratch;
 		clocksUsed = 255;
@@ -3015,10 +2782,10 @@ uint8_t Mc6809::BSR_rel()
 	case 5:		//	R	Don't Care			$ffff
 		break;
 	case 6:		// W	Retern Address Low	SP-1
-		Write(reg_S--, PC_lo);
+		Write(--reg_S, PC_lo);
 		break;
 	case 7:		// W	Return Address High SP-2
-		Write(reg_S--, PC_hi);
+		Write(--reg_S, PC_hi);
 		reg_PC += reg_scratch;
 		clocksUsed = 255;
 		break;
@@ -3042,6 +2809,7 @@ uint8_t Mc6809::BVC_rel()
 		scratch_hi = (((scratch_lo & 0x80) == 0x80) ? 0xff : 0x00);
 		break;
 	case 3:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if ((reg_CC & CC::V) != CC::V)
 			reg_PC += reg_scratch;
 		clocksUsed = 255;
@@ -3066,6 +2834,7 @@ uint8_t Mc6809::BVS_rel()
 		scratch_hi = (((scratch_lo & 0x80) == 0x80) ? 0xff : 0x00);
 		break;
 	case 3:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if ((reg_CC & CC::V) == CC::V)
 			reg_PC += reg_scratch;
 		clocksUsed = 255;
@@ -3087,7 +2856,8 @@ uint8_t Mc6809::CLRA_inh()
 		break;
 	case 2:		//	R	Don't Care			PC+1
 		reg_A = 0;
-		reg_CC = (reg_CC & CC::H) | CC::Z;
+		ResolveCC();
+		reg_CC = (reg_CC & ~(CC::N | CC::V | CC::C)) | CC::Z;
 		//reg_PC++;
 		clocksUsed = 255;
 		break;
@@ -3108,7 +2878,8 @@ uint8_t Mc6809::CLRB_inh()
 		break;
 	case 2:		//	R	Don't Care			PC+1
 		reg_B = 0;
-		reg_CC = (reg_CC & CC::H) | CC::Z;
+		ResolveCC();
+		reg_CC = (reg_CC & ~(CC::N | CC::V | CC::C)) | CC::Z;
 		//reg_PC++;
 		clocksUsed = 255;
 		break;
@@ -3137,7 +2908,8 @@ uint8_t Mc6809::CLR_dir()
 		Read(reg_scratch);
 		break;
 	case 5:		//	R	Don't Care			$ffff
-		reg_CC = (reg_CC & CC::H) | CC::Z;
+		ResolveCC();
+		reg_CC = (reg_CC & ~(CC::N | CC::V | CC::C)) | CC::Z;
 		break;
 	case 6:		// W	Data				EA
 		Write(reg_scratch, 0);
@@ -3170,7 +2942,8 @@ uint8_t Mc6809::CLR_ext()
 		Read(reg_scratch);
 		break;
 	case 6:		//	R	Don't Care			$ffff
-		reg_CC = (reg_CC & CC::H) | CC::Z;
+		ResolveCC();
+		reg_CC = (reg_CC & ~(CC::N | CC::V | CC::C)) | CC::Z;
 		break;
 	case 7:		// W	Data				EA
 		Write(reg_scratch, 0);
@@ -3202,10 +2975,7 @@ uint8_t Mc6809::CMPA_dir()
 	case 4:		//	R	Data				EA
 		data = Read(reg_scratch);
 		reg_scratch = reg_A - data;
-		AdjustCC_N(scratch_lo);
-		AdjustCC_Z(scratch_lo);
-		AdjustCC_V(reg_A, data, scratch_lo);
-		AdjustCC_C(reg_scratch);
+		SetCC_Sub(reg_A, data, reg_scratch);
 		clocksUsed = 255;
 		break;
 	}
@@ -3236,10 +3006,7 @@ uint8_t Mc6809::CMPA_ext()
 	case 5:		//	R	Data				EA
 		data = Read(reg_scratch);
 		reg_scratch = reg_A - data;
-		AdjustCC_N(scratch_lo);
-		AdjustCC_Z(scratch_lo);
-		AdjustCC_V(reg_A, data, scratch_lo);
-		AdjustCC_C(reg_scratch);
+		SetCC_Sub(reg_A, data, reg_scratch);
 		clocksUsed = 255;
 		break;
 	}
@@ -3262,10 +3029,7 @@ uint8_t Mc6809::CMPA_imm()
 	case 2:		//	R	Data				PC+1
 		data = Read(reg_PC++);
 		reg_scratch = reg_A - data;
-		AdjustCC_N(scratch_lo);
-		AdjustCC_Z(scratch_lo);
-		AdjustCC_V(reg_A, data, scratch_lo);
-		AdjustCC_C(reg_scratch);
+		SetCC_Sub(reg_A, data, reg_scratch);
 		clocksUsed = 255;
 		break;
 	}
@@ -3294,10 +3058,7 @@ uint8_t Mc6809::CMPB_dir()
 	case 4:		//	R	Data				EA
 		data = Read(reg_scratch);
 		reg_scratch = reg_B - data;
-		AdjustCC_N(scratch_lo);
-		AdjustCC_Z(scratch_lo);
-		AdjustCC_V(reg_B, data, scratch_lo);
-		AdjustCC_C(reg_scratch);
+		SetCC_Sub(reg_B, data, reg_scratch);
 		clocksUsed = 255;
 		break;
 	}
@@ -3328,10 +3089,7 @@ uint8_t Mc6809::CMPB_ext()
 	case 5:		//	R	Data				EA
 		data = Read(reg_scratch);
 		reg_scratch = reg_B - data;
-		AdjustCC_N(scratch_lo);
-		AdjustCC_Z(scratch_lo);
-		AdjustCC_V(reg_B, data, scratch_lo);
-		AdjustCC_C(reg_scratch);
+		SetCC_Sub(reg_B, data, reg_scratch);
 		clocksUsed = 255;
 		break;
 	}
@@ -3354,10 +3112,7 @@ uint8_t Mc6809::CMPB_imm()
 	case 2:		//	R	Data				PC+1
 		data = Read(reg_PC++);
 		reg_scratch = reg_B - data;
-		AdjustCC_N(scratch_lo);
-		AdjustCC_Z(scratch_lo);
-		AdjustCC_V(reg_B, data, scratch_lo);
-		AdjustCC_C(reg_scratch);
+		SetCC_Sub(reg_B, data, reg_scratch);
 		clocksUsed = 255;
 		break;
 	}
@@ -3370,7 +3125,6 @@ uint8_t Mc6809::CMPB_imm()
 //*****************************************************************************
 uint8_t Mc6809::CMPD_dir()
 {
-	static uint16_t data;
 	uint32_t tempRegValue;
 
 	switch (++clocksUsed)
@@ -3388,17 +3142,14 @@ uint8_t Mc6809::CMPD_dir()
 		scratch_hi = reg_DP;
 		break;
 	case 5:		//	R	Data High			EA
-		data = Read(reg_scratch);
+		reg_operand = Read(reg_scratch);
 		break;
 	case 6:		//	R	Data Low			EA+1
-		data = (data << 8) | Read(++reg_scratch);
+		reg_operand = (reg_operand << 8) | Read(++reg_scratch);
 		break;
 	case 7:		//	R	Don't Care			$ffff
-		tempRegValue = reg_D - data;
-		AdjustCC_N((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_Z((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_V(reg_D, data, (uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_C(tempRegValue);
+		tempRegValue = reg_D - reg_operand;
+		SetCC_Sub(reg_D, reg_operand, tempRegValue);
 		clocksUsed = 255;
 		break;
 	}
@@ -3411,7 +3162,6 @@ uint8_t Mc6809::CMPD_dir()
 //*****************************************************************************
 uint8_t Mc6809::CMPD_ext()
 {
-	static uint16_t data;
 	uint32_t tempRegValue;
 
 	switch (++clocksUsed)
@@ -3431,17 +3181,14 @@ uint8_t Mc6809::CMPD_ext()
 	case 5:		//	R	Don't Care			$ffff
 		break;
 	case 6:		//	R	Data High			EA
-		data = Read(reg_scratch) << 8;
+		reg_operand = Read(reg_scratch) << 8;
 		break;
 	case 7:		//	R	Data Low			EA+1
-		data |= Read(++reg_scratch);
+		reg_operand |= Read(++reg_scratch);
 		break;
 	case 8:		//	R	Don't Care			$ffff
-		tempRegValue = reg_D - data;
-		AdjustCC_N((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_Z((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_V(reg_D, data, (uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_C(tempRegValue);
+		tempRegValue = reg_D - reg_operand;
+		SetCC_Sub(reg_D, reg_operand, tempRegValue);
 		clocksUsed = 255;
 		break;
 	}
@@ -3454,7 +3201,6 @@ uint8_t Mc6809::CMPD_ext()
 //*****************************************************************************
 uint8_t Mc6809::CMPD_imm()
 {
-	static uint16_t data;
 	uint32_t tempRegValue;
 
 	switch (++clocksUsed)
@@ -3466,17 +3212,14 @@ uint8_t Mc6809::CMPD_imm()
 		reg_PC++;
 		break;
 	case 3:		//	R	Data High			PC+2
-		data = Read(reg_PC++) << 8;
+		reg_operand = Read(reg_PC++) << 8;
 		break;
 	case 4:		//	R	Data Low			PC+3
-		data |= Read((reg_PC++));
+		reg_operand |= Read((reg_PC++));
 		break;
 	case 5:		//	R	Don't Care			$ffff
-		tempRegValue = reg_D - data;
-		AdjustCC_N((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_Z((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_V(reg_D, data, (uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_C(tempRegValue);
+		tempRegValue = reg_D - reg_operand;
+		SetCC_Sub(reg_D, reg_operand, tempRegValue);
 		clocksUsed = 255;
 		break;
 	}
@@ -3489,7 +3232,6 @@ uint8_t Mc6809::CMPD_imm()
 //*****************************************************************************
 uint8_t Mc6809::CMPS_dir()
 {
-	static uint16_t data;
 	uint32_t tempRegValue;
 
 	switch (++clocksUsed)
@@ -3507,17 +3249,14 @@ uint8_t Mc6809::CMPS_dir()
 		scratch_hi = reg_DP;
 		break;
 	case 5:		//	R	Data High			EA
-		data = Read(reg_scratch);
+		reg_operand = Read(reg_scratch);
 		break;
 	case 6:		//	R	Data Low			EA+1
-		data = (data << 8) | Read(++reg_scratch);
+		reg_operand = (reg_operand << 8) | Read(++reg_scratch);
 		break;
 	case 7:		//	R	Don't Care			$ffff
-		tempRegValue = reg_S - data;
-		AdjustCC_N((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_Z((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_V(reg_S, data, (uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_C(tempRegValue);
+		tempRegValue = reg_S - reg_operand;
+		SetCC_Sub(reg_S, reg_operand, tempRegValue);
 		clocksUsed = 255;
 		break;
 	}
@@ -3530,7 +3269,6 @@ uint8_t Mc6809::CMPS_dir()
 //*****************************************************************************
 uint8_t Mc6809::CMPS_ext()
 {
-	static uint16_t data;
 	uint32_t tempRegValue;
 
 	switch (++clocksUsed)
@@ -3550,17 +3288,14 @@ uint8_t Mc6809::CMPS_ext()
 	case 5:		//	R	Don't Care			$ffff
 		break;
 	case 6:		//	R	Data High			EA
-		data = Read(reg_scratch) << 8;
+		reg_operand = Read(reg_scratch) << 8;
 		break;
 	case 7:		//	R	Data Low			EA+1
-		data |= Read(++reg_scratch);
+		reg_operand |= Read(++reg_scratch);
 		break;
 	case 8:		//	R	Don't Care			$ffff
-		tempRegValue = reg_S - data;
-		AdjustCC_N((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_Z((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_V(reg_S, data, (uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_C(tempRegValue);
+		tempRegValue = reg_S - reg_operand;
+		SetCC_Sub(reg_S, reg_operand, tempRegValue);
 		clocksUsed = 255;
 		break;
 	}
@@ -3573,7 +3308,6 @@ uint8_t Mc6809::CMPS_ext()
 //*****************************************************************************
 uint8_t Mc6809::CMPS_imm()
 {
-	static uint16_t data;
 	uint32_t tempRegValue;
 
 	switch (++clocksUsed)
@@ -3585,17 +3319,14 @@ uint8_t Mc6809::CMPS_imm()
 		reg_PC++;
 		break;
 	case 3:		//	R	Data High			PC+2
-		data = Read(reg_PC++) << 8;
+		reg_operand = Read(reg_PC++) << 8;
 		break;
 	case 4:		//	R	Data Low			PC+3
-		data |= Read((reg_PC++));
+		reg_operand |= Read((reg_PC++));
 		break;
 	case 5:		//	R	Don't Care			$ffff
-		tempRegValue = reg_S - data;
-		AdjustCC_N((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_Z((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_V(reg_S, data, (uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_C(tempRegValue);
+		tempRegValue = reg_S - reg_operand;
+		SetCC_Sub(reg_S, reg_operand, tempRegValue);
 		clocksUsed = 255;
 		break;
 	}
@@ -3608,7 +3339,6 @@ uint8_t Mc6809::CMPS_imm()
 //*****************************************************************************
 uint8_t Mc6809::CMPU_dir()
 {
-	static uint16_t data;
 	uint32_t tempRegValue;
 
 	switch (++clocksUsed)
@@ -3626,17 +3356,14 @@ uint8_t Mc6809::CMPU_dir()
 		scratch_hi = reg_DP;
 		break;
 	case 5:		//	R	Data High			EA
-		data = Read(reg_scratch);
+		reg_operand = Read(reg_scratch);
 		break;
 	case 6:		//	R	Data Low			EA+1
-		data = (data << 8) | Read(++reg_scratch);
+		reg_operand = (reg_operand << 8) | Read(++reg_scratch);
 		break;
 	case 7:		//	R	Don't Care			$ffff
-		tempRegValue = reg_U - data;
-		AdjustCC_N((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_Z((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_V(reg_U, data, (uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_C(tempRegValue);
+		tempRegValue = reg_U - reg_operand;
+		SetCC_Sub(reg_U, reg_operand, tempRegValue);
 		clocksUsed = 255;
 		break;
 	}
@@ -3649,7 +3376,6 @@ uint8_t Mc6809::CMPU_dir()
 //*****************************************************************************
 uint8_t Mc6809::CMPU_ext()
 {
-	static uint16_t data;
 	uint32_t tempRegValue;
 
 	switch (++clocksUsed)
@@ -3669,17 +3395,14 @@ uint8_t Mc6809::CMPU_ext()
 	case 5:		//	R	Don't Care			$ffff
 		break;
 	case 6:		//	R	Data High			EA
-		data = Read(reg_scratch) << 8;
+		reg_operand = Read(reg_scratch) << 8;
 		break;
 	case 7:		//	R	Data Low			EA+1
-		data |= Read(++reg_scratch);
+		reg_operand |= Read(++reg_scratch);
 		break;
 	case 8:		//	R	Don't Care			$ffff
-		tempRegValue = reg_U - data;
-		AdjustCC_N((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_Z((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_V(reg_U, data, (uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_C(tempRegValue);
+		tempRegValue = reg_U - reg_operand;
+		SetCC_Sub(reg_U, reg_operand, tempRegValue);
 		clocksUsed = 255;
 		break;
 	}
@@ -3692,7 +3415,6 @@ uint8_t Mc6809::CMPU_ext()
 //*****************************************************************************
 uint8_t Mc6809::CMPU_imm()
 {
-	static uint16_t data;
 	uint32_t tempRegValue;
 
 	switch (++clocksUsed)
@@ -3704,17 +3426,14 @@ uint8_t Mc6809::CMPU_imm()
 		reg_PC++;
 		break;
 	case 3:		//	R	Data High			PC+2
-		data = Read(reg_PC++) << 8;
+		reg_operand = Read(reg_PC++) << 8;
 		break;
 	case 4:		//	R	Data Low			PC+3
-		data |= Read((reg_PC++));
+		reg_operand |= Read((reg_PC++));
 		break;
 	case 5:		//	R	Don't Care			$ffff
-		tempRegValue = reg_U - data;
-		AdjustCC_N((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_Z((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_V(reg_U, data, (uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_C(tempRegValue);
+		tempRegValue = reg_U - reg_operand;
+		SetCC_Sub(reg_U, reg_operand, tempRegValue);
 		clocksUsed = 255;
 		break;
 	}
@@ -3727,7 +3446,6 @@ uint8_t Mc6809::CMPU_imm()
 //*****************************************************************************
 uint8_t Mc6809::CMPX_dir()
 {
-	static uint16_t data;
 	uint32_t tempRegValue;
 
 	switch (++clocksUsed)
@@ -3742,17 +3460,14 @@ uint8_t Mc6809::CMPX_dir()
 		scratch_hi = reg_DP;
 		break;
 	case 5:		//	R	Data High			EA
-		data = Read(reg_scratch);
+		reg_operand = Read(reg_scratch);
 		break;
 	case 6:		//	R	Data Low			EA+1
-		data = (data << 8) | Read(++reg_scratch);
+		reg_operand = (reg_operand << 8) | Read(++reg_scratch);
 		break;
 	case 7:		//	R	Don't Care			$ffff
-		tempRegValue = reg_X - data;
-		AdjustCC_N((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_Z((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_V(reg_X, data, (uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_C(tempRegValue);
+		tempRegValue = reg_X - reg_operand;
+		SetCC_Sub(reg_X, reg_operand, tempRegValue);
 		clocksUsed = 255;
 		break;
 	}
@@ -3765,7 +3480,6 @@ uint8_t Mc6809::CMPX_dir()
 //*****************************************************************************
 uint8_t Mc6809::CMPX_ext()
 {
-	static uint16_t data;
 	uint32_t tempRegValue;
 
 	switch (++clocksUsed)
@@ -3782,17 +3496,14 @@ uint8_t Mc6809::CMPX_ext()
 	case 4:		//	R	Don't Care			$ffff
 		break;
 	case 5:		//	R	Data High			EA
-		data = Read(reg_scratch) << 8;
+		reg_operand = Read(reg_scratch) << 8;
 		break;
 	case 6:		//	R	Data Low			EA+1
-		data |= Read(++reg_scratch);
+		reg_operand |= Read(++reg_scratch);
 		break;
 	case 7:		//	R	Don't Care			$ffff
-		tempRegValue = reg_X - data;
-		AdjustCC_N((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_Z((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_V(reg_X, data, (uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_C(tempRegValue);
+		tempRegValue = reg_X - reg_operand;
+		SetCC_Sub(reg_X, reg_operand, tempRegValue);
 		clocksUsed = 255;
 		break;
 	}
@@ -3805,7 +3516,6 @@ uint8_t Mc6809::CMPX_ext()
 //*****************************************************************************
 uint8_t Mc6809::CMPX_imm()
 {
-	static uint16_t data;
 	uint32_t tempRegValue;
 
 	switch (++clocksUsed)
@@ -3814,17 +3524,14 @@ uint8_t Mc6809::CMPX_imm()
 		reg_PC++;
 		break;
 	case 2:		//	R	Data High			PC+1
-		data = Read(reg_PC++) << 8;
+		reg_operand = Read(reg_PC++) << 8;
 		break;
 	case 3:		//	R	Data Low			PC+2
-		data |= Read((reg_PC++));
+		reg_operand |= Read((reg_PC++));
 		break;
 	case 4:		//	R	Don't Care			$ffff
-		tempRegValue = reg_X - data;
-		AdjustCC_N((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_Z((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_V(reg_X, data, (uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_C(tempRegValue);
+		tempRegValue = reg_X - reg_operand;
+		SetCC_Sub(reg_X, reg_operand, tempRegValue);
 		clocksUsed = 255;
 		break;
 	}
@@ -3837,7 +3544,6 @@ uint8_t Mc6809::CMPX_imm()
 //*****************************************************************************
 uint8_t Mc6809::CMPY_dir()
 {
-	static uint16_t data;
 	uint32_t tempRegValue;
 
 	switch (++clocksUsed)
@@ -3855,17 +3561,14 @@ uint8_t Mc6809::CMPY_dir()
 		scratch_hi = reg_DP;
 		break;
 	case 5:		//	R	Data High			EA
-		data = Read(reg_scratch);
+		reg_operand = Read(reg_scratch);
 		break;
 	case 6:		//	R	Data Low			EA+1
-		data = (data << 8) | Read(++reg_scratch);
+		reg_operand = (reg_operand << 8) | Read(++reg_scratch);
 		break;
 	case 7:		//	R	Don't Care			$ffff
-		tempRegValue = reg_Y - data;
-		AdjustCC_N((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_Z((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_V(reg_Y, data, (uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_C(tempRegValue);
+		tempRegValue = reg_Y - reg_operand;
+		SetCC_Sub(reg_Y, reg_operand, tempRegValue);
 		clocksUsed = 255;
 		break;
 	}
@@ -3878,7 +3581,6 @@ uint8_t Mc6809::CMPY_dir()
 //*****************************************************************************
 uint8_t Mc6809::CMPY_ext()
 {
-	static uint16_t data;
 	uint32_t tempRegValue;
 
 	switch (++clocksUsed)
@@ -3898,17 +3600,14 @@ uint8_t Mc6809::CMPY_ext()
 	case 5:		//	R	Don't Care			$ffff
 		break;
 	case 6:		//	R	Data High			EA
-		data = Read(reg_scratch) << 8;
+		reg_operand = Read(reg_scratch) << 8;
 		break;
 	case 7:		//	R	Data Low			EA+1
-		data |= Read(++reg_scratch);
+		reg_operand |= Read(++reg_scratch);
 		break;
 	case 8:		//	R	Don't Care			$ffff
-		tempRegValue = reg_Y - data;
-		AdjustCC_N((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_Z((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_V(reg_Y, data, (uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_C(tempRegValue);
+		tempRegValue = reg_Y - reg_operand;
+		SetCC_Sub(reg_Y, reg_operand, tempRegValue);
 		clocksUsed = 255;
 		break;
 	}
@@ -3921,7 +3620,6 @@ uint8_t Mc6809::CMPY_ext()
 //*****************************************************************************
 uint8_t Mc6809::CMPY_imm()
 {
-	static uint16_t data;
 	uint32_t tempRegValue;
 
 	switch (++clocksUsed)
@@ -3933,17 +3631,14 @@ uint8_t Mc6809::CMPY_imm()
 		reg_PC++;
 		break;
 	case 3:		//	R	Data High			PC+2
-		data = Read(reg_PC++) << 8;
+		reg_operand = Read(reg_PC++) << 8;
 		break;
 	case 4:		//	R	Data Low			PC+3
-		data |= Read((reg_PC++));
+		reg_operand |= Read((reg_PC++));
 		break;
 	case 5:		//	R	Don't Care			$ffff
-		tempRegValue = reg_Y - data;
-		AdjustCC_N((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_Z((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_V(reg_Y, data, (uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_C(tempRegValue);
+		tempRegValue = reg_Y - reg_operand;
+		SetCC_Sub(reg_Y, reg_operand, tempRegValue);
 		clocksUsed = 255;
 		break;
 	}
@@ -3963,6 +3658,7 @@ uint8_t Mc6809::COMA_inh()
 		break;
 	case 2:		//	R	Don't Care			PC+1
 		reg_A ^= 255;
+		ResolveCC();
 		reg_CC |= (CC::C);
 		reg_CC &= ~(CC::V | CC::N | CC::Z);
 		reg_CC |= (reg_A == 0) ? CC::Z : 0x00;
@@ -3988,9 +3684,7 @@ uint8_t Mc6809::COMB_inh()
 	case 2:		//	R	Don't Care			PC+1
 		reg_B ^= 255;
 		//reg_PC++;
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		reg_CC &= ~(CC::V);
+		SetCC_NZ0(reg_B);
 		reg_CC |= (CC::C);
 		clocksUsed = 255;
 		break;
@@ -4004,7 +3698,6 @@ uint8_t Mc6809::COMB_inh()
 //*****************************************************************************
 uint8_t Mc6809::COM_dir()
 {
-	static uint8_t data_lo;
 
 	switch (++clocksUsed)
 	{
@@ -4018,17 +3711,15 @@ uint8_t Mc6809::COM_dir()
 		scratch_hi = reg_DP;
 		break;
 	case 4:		//	R	Data				EA
-		data_lo = Read(reg_scratch);
+		operand_lo = Read(reg_scratch);
 		break;
 	case 5:		//	R	Don't Care			$ffff
-		data_lo ^= 0xff;
-		AdjustCC_N(data_lo);
-		AdjustCC_Z(data_lo);
-		reg_CC &= ~(CC::V);
+		operand_lo ^= 0xff;
+		SetCC_NZ0(operand_lo);
 		reg_CC |= (CC::C);
 		break;
 	case 6:		// W	Data				EA
-		Write(reg_scratch, data_lo);
+		Write(reg_scratch, operand_lo);
 		clocksUsed = 255;
 		break;
 	}
@@ -4041,7 +3732,6 @@ uint8_t Mc6809::COM_dir()
 //*****************************************************************************
 uint8_t Mc6809::COM_ext()
 {
-	static uint8_t data_lo;
 
 	switch (++clocksUsed)
 	{
@@ -4057,17 +3747,15 @@ uint8_t Mc6809::COM_ext()
 	case 4:		//	R	Don't Care			$ffff
 		break;
 	case 5:		//	R	Data				EA
-		data_lo = Read(reg_scratch);
+		operand_lo = Read(reg_scratch);
 		break;
 	case 6:		//	R	Don't Care			$ffff
-		data_lo ^= 0xff;
-		AdjustCC_N(data_lo);
-		AdjustCC_Z(data_lo);
-		reg_CC &= ~(CC::V);
+		operand_lo ^= 0xff;
+		SetCC_NZ0(operand_lo);
 		reg_CC |= (CC::C);
 		break;
 	case 7:		// W  Data			EA
-		Write(reg_scratch, data_lo);
+		Write(reg_scratch, operand_lo);
 		clocksUsed = 255;
 		break;
 	}
@@ -4089,69 +3777,76 @@ uint8_t Mc6809::CWAI_inh()
 		scratch_lo = Read(reg_PC++);
 		break;
 	case 3:		//	R	Don't Care			PC+2
-		reg_PC++;
+		//reg_PC++;
 		break;
 	case 4:		//	R	Don't care			$ffff
 		break;
 	case 5:		// W	PC Low				SP-1	--SP
-		Write(reg_S--, PC_lo);
+		Write(--reg_S, PC_lo);
 		break;
 	case 6:		// W	PC High				SP-2	--SP
-		Write(reg_S--, PC_hi);
+		Write(--reg_S, PC_hi);
 		break;
 	case 7:		// W	User Stack Low		SP-3	--SP
-		Write(reg_S--, U_lo);
+		Write(--reg_S, U_lo);
 		break;
 	case 8:		// W	User Stack High		SP-4	--SP
-		Write(reg_S--, U_hi);
+		Write(--reg_S, U_hi);
 		break;
 	case 9:		// W	Y  Register Low		SP-5	--SP
-		Write(reg_S--, Y_lo);
+		Write(--reg_S, Y_lo);
 		break;
 	case 10:	// W	Y  Register High	SP-6	--SP
-		Write(reg_S--, Y_hi);
+		Write(--reg_S, Y_hi);
 		break;
 	case 11:	// W	X  Register Low		SP-7	--SP
-		Write(reg_S--, X_lo);
+		Write(--reg_S, X_lo);
 		break;
 	case 12:	// W	X  Register High	SP-8	--SP
-		Write(reg_S--, X_hi);
+		Write(--reg_S, X_hi);
 		break;
 	case 13:	// W	DP Register			SP-9	--SP
-		Write(reg_S--, reg_DP);
+		Write(--reg_S, reg_DP);
 		break;
 	case 14:	// W	B  Register			SP-10	--SP
-		Write(reg_S--, reg_B);
+		Write(--reg_S, reg_B);
 		break;
 	case 15:	// W	A  Register			SP-11	--SP
-		Write(reg_S--, reg_A);
+		Write(--reg_S, reg_A);
 		break;
 	case 16:	// W	CC Register			SP-12	--SP
-		Write(reg_S--, reg_CC);
+		ResolveCC();
+		Write(--reg_S, reg_CC);
 		reg_CC &= scratch_lo;
 		reg_CC |= CC::E;
 		break;
 
 	case 17:	//	R	Don't Care			$ffff
-		// wait for interrupt signal
-		if (!Nmi && !Firq && !Irq)
+		// wait for an interrupt the new CC lets through
+		if ((Unmasked() & (LINE::NMI | LINE::FIRQ | LINE::IRQ)) == 0)
+		{
 			--clocksUsed;
+			waitState = true;
+		}
 		break;
 
 	case 18:	//	R	Int Vector High		$fffx
-		if (Nmi)
+		if (Pending() & LINE::NMI)
 			PC_hi = Read(0xfffc);
-		else if (Firq && (reg_CC & CC::F) != CC::F)
+		else if ((Pending() & LINE::FIRQ) && (reg_CC & CC::F) != CC::F)
 			PC_hi = Read(0xfff6);
-		else if (Irq && (reg_CC & CC::I) != CC::I)
+		else if ((Pending() & LINE::IRQ) && (reg_CC & CC::I) != CC::I)
 			PC_hi = Read(0xfff8);
 		break;
 	case 19:	//	R	Int Vector Low		$fffx
-		if (Nmi)
+		if (Pending() & LINE::NMI)
+		{
 			PC_lo = Read(0xfffd);
-		else if (Firq && (reg_CC & CC::F) != CC::F)
+			lines.fetch_and((uint8_t)~LINE::NMI);		// taken, drop the edge latch
+		}
+		else if ((Pending() & LINE::FIRQ) && (reg_CC & CC::F) != CC::F)
 			PC_lo = Read(0xfff7);
-		else if (Irq && (reg_CC & CC::I) != CC::I)
+		else if ((Pending() & LINE::IRQ) && (reg_CC & CC::I) != CC::I)
 			PC_lo = Read(0xfff9);
 		break;
 	case 20:	//	R	Don't Care			$ffff
@@ -4167,9 +3862,9 @@ uint8_t Mc6809::CWAI_inh()
 //*****************************************************************************
 uint8_t Mc6809::DAA_inh()
 {
-	static uint8_t carry = 0;
-	static uint8_t cfLsn = 0;
-	static uint8_t cfMsn = 0;
+	uint8_t carry = 0;
+	uint8_t cfLsn = 0;
+	uint8_t cfMsn = 0;
 
 	switch (++clocksUsed)
 	{
@@ -4179,6 +3874,7 @@ uint8_t Mc6809::DAA_inh()
 	case 2:		//	R	Don't Care			PC+1
 		scratch_lo = reg_A & 0x0f;
 		scratch_hi = (reg_A & 0xf0) >> 4;
+		ResolveCC();
 		carry = reg_CC & CC::C;
 		if (((reg_CC & CC::H) == CC::H) || (scratch_lo > 9))
 			cfLsn = 6;
@@ -4188,8 +3884,7 @@ uint8_t Mc6809::DAA_inh()
 		reg_A += cfLsn;			// fixes lsn
 		reg_A += (cfMsn << 4);	// fixes msn
 		reg_CC = (cfMsn == 6 || carry) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
+		SetCC_NZ(reg_A);
 
 		//reg_PC++;
 		clocksUsed = 255;
@@ -4210,10 +3905,10 @@ uint8_t Mc6809::DECA_inh()
 		reg_PC++;
 		break;
 	case 2:		//	R	Don't Care			PC+1
+		ResolveCC();
 		reg_CC = ((reg_A & 0x80) == 0x80) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
 		--reg_A;
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
+		SetCC_NZ(reg_A);
 		//reg_PC++;
 		clocksUsed = 255;
 		break;
@@ -4233,10 +3928,10 @@ uint8_t Mc6809::DECB_inh()
 		reg_PC++;
 		break;
 	case 2:		//	R	Don't Care			PC+1
+		ResolveCC();
 		reg_CC = ((reg_B & 0x80) == 0x80) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
 		--reg_B;
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
+		SetCC_NZ(reg_B);
 		//reg_PC++;
 		clocksUsed = 255;
 		break;
@@ -4250,7 +3945,6 @@ uint8_t Mc6809::DECB_inh()
 //*****************************************************************************
 uint8_t Mc6809::DEC_dir()
 {
-	static uint8_t data_lo;
 
 	switch (++clocksUsed)
 	{
@@ -4264,16 +3958,16 @@ uint8_t Mc6809::DEC_dir()
 		scratch_hi = reg_DP;
 		break;
 	case 4:		//	R	Data				EA
-		data_lo = Read(reg_scratch);
+		operand_lo = Read(reg_scratch);
 		break;
 	case 5:		//	R	Don't Care			$ffff
-		reg_CC = ((data_lo & 0x80) == 0x80) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
-		--data_lo;
-		AdjustCC_N(data_lo);
-		AdjustCC_Z(data_lo);
+		ResolveCC();
+		reg_CC = ((operand_lo & 0x80) == 0x80) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
+		--operand_lo;
+		SetCC_NZ(operand_lo);
 		break;
 	case 6:		//	W	Data				EA
-		Write(reg_scratch, data_lo);
+		Write(reg_scratch, operand_lo);
 		clocksUsed = 255;
 		break;
 	}
@@ -4286,7 +3980,6 @@ uint8_t Mc6809::DEC_dir()
 //*****************************************************************************
 uint8_t Mc6809::DEC_ext()
 {
-	static uint8_t data_lo;
 
 	switch (++clocksUsed)
 	{
@@ -4302,16 +3995,16 @@ uint8_t Mc6809::DEC_ext()
 	case 4:		//	R	Don't Care			$ffff
 		break;
 	case 5:		//	R	Data				EA
-		data_lo = Read(reg_scratch);
+		operand_lo = Read(reg_scratch);
 		break;
 	case 6:		//	R	Don't Care			$ffff
-		reg_CC = ((data_lo & 0x80) == 0x80) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
-		--data_lo;
-		AdjustCC_N(data_lo);
-		AdjustCC_Z(data_lo);
+		ResolveCC();
+		reg_CC = ((operand_lo & 0x80) == 0x80) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
+		--operand_lo;
+		SetCC_NZ(operand_lo);
 		break;
 	case 7:		//	W	Data				EA
-		Write(reg_scratch, data_lo);
+		Write(reg_scratch, operand_lo);
 		clocksUsed = 255;
 		break;
 	}
@@ -4337,9 +4030,7 @@ uint8_t Mc6809::EORA_dir()
 		break;
 	case 4:		//	R	Data				EA
 		reg_A ^= Read(reg_scratch);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_A);
 		clocksUsed = 255;
 		break;
 	}
@@ -4367,9 +4058,7 @@ uint8_t Mc6809::EORA_ext()
 		break;
 	case 5:		//	R	Data				EA
 		reg_A ^= Read(reg_scratch);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_A);
 		clocksUsed = 255;
 		break;
 	}
@@ -4389,9 +4078,7 @@ uint8_t Mc6809::EORA_imm()
 		break;
 	case 2:		//	R	Data				EA
 		reg_A ^= Read(reg_PC++);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_A);
 		clocksUsed = 255;
 		break;
 	}
@@ -4417,9 +4104,7 @@ uint8_t Mc6809::EORB_dir()
 		break;
 	case 4:		//	R	Data				EA
 		reg_B ^= Read(reg_scratch);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_B);
 		clocksUsed = 255;
 		break;
 	}
@@ -4447,9 +4132,7 @@ uint8_t Mc6809::EORB_ext()
 		break;
 	case 5:		//	R	Data				EA
 		reg_B ^= Read(reg_scratch);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_B);
 		clocksUsed = 255;
 		break;
 	}
@@ -4469,9 +4152,7 @@ uint8_t Mc6809::EORB_imm()
 		break;
 	case 2:		//	R	Data				EA
 		reg_B ^= Read(reg_PC++);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_B);
 		clocksUsed = 255;
 		break;
 	}
@@ -4484,8 +4165,6 @@ uint8_t Mc6809::EORB_imm()
 //*****************************************************************************
 uint8_t Mc6809::EXG_imm()
 {
-	static uint8_t data_hi = 0;
-	static uint8_t data_lo = 0;
 	switch (++clocksUsed)
 	{
 	case 1:		//	R	Opcode Fetch		PC
@@ -4495,15 +4174,16 @@ uint8_t Mc6809::EXG_imm()
 		scratch_lo = Read(reg_PC++);
 		break;
 	case 3:		//	R	Don't Care			$ffff
-		data_hi = scratch_lo & 0xf0;
-		data_lo = scratch_lo & 0x0f;
+		operand_hi = (scratch_lo & 0xf0) >> 4;
+		operand_lo = scratch_lo & 0x0f;
+		ResolveCC();		// CC may be swapped below
 		break;
 	case 4:
-		switch (data_hi)
+		switch (operand_hi)
 		{
 		case REG::A:
 			scratch_lo = reg_A;
-			switch (data_lo)
+			switch (operand_lo)
 			{
 			case REG::B:
 				reg_A = reg_B;
@@ -4520,8 +4200,8 @@ uint8_t Mc6809::EXG_imm()
 			}
 			break;
 		case REG::B:
-			scratch_lo = reg_A;
-			switch (data_lo)
+			scratch_lo = reg_B;
+			switch (operand_lo)
 			{
 			case REG::A:
 				reg_B = reg_A;
@@ -4540,11 +4220,11 @@ uint8_t Mc6809::EXG_imm()
 		}
 		break;
 	case 5:
-		switch (data_hi)
+		switch (operand_hi)
 		{
 		case REG::CC:
 			scratch_lo = reg_CC;
-			switch (data_lo)
+			switch (operand_lo)
 			{
 			case REG::A:
 				reg_CC = reg_A;
@@ -4562,7 +4242,7 @@ uint8_t Mc6809::EXG_imm()
 			break;
 		case REG::DP:
 			scratch_lo = reg_DP;
-			switch (data_lo)
+			switch (operand_lo)
 			{
 			case REG::A:
 				reg_DP = reg_A;
@@ -4581,11 +4261,11 @@ uint8_t Mc6809::EXG_imm()
 		}
 		break;
 	case 6:
-		switch (data_hi)
+		switch (operand_hi)
 		{
 		case REG::X:
 			reg_scratch = reg_X;
-			switch (data_lo)
+			switch (operand_lo)
 			{
 			case REG::Y:
 				reg_X = reg_Y;
@@ -4611,7 +4291,7 @@ uint8_t Mc6809::EXG_imm()
 			break;
 		case REG::Y:
 			reg_scratch = reg_Y;
-			switch (data_lo)
+			switch (operand_lo)
 			{
 			case REG::X:
 				reg_Y = reg_X;
@@ -4638,11 +4318,11 @@ uint8_t Mc6809::EXG_imm()
 		}
 		break;
 	case 7:
-		switch (data_hi)
+		switch (operand_hi)
 		{
 		case REG::U:
 			reg_scratch = reg_U;
-			switch (data_lo)
+			switch (operand_lo)
 			{
 			case REG::X:
 				reg_U = reg_X;
@@ -4668,7 +4348,7 @@ uint8_t Mc6809::EXG_imm()
 			break;
 		case REG::S:
 			reg_scratch = reg_S;
-			switch (data_lo)
+			switch (operand_lo)
 			{
 			case REG::X:
 				reg_S = reg_X;
@@ -4695,11 +4375,11 @@ uint8_t Mc6809::EXG_imm()
 		}
 		break;
 	case 8:
-		switch (data_hi)
+		switch (operand_hi)
 		{
 		case REG::D:
 			reg_scratch = reg_D;
-			switch (data_lo)
+			switch (operand_lo)
 			{
 			case REG::X:
 				reg_D = reg_PC;
@@ -4725,7 +4405,7 @@ uint8_t Mc6809::EXG_imm()
 			break;
 		case REG::PC:
 			reg_scratch = reg_PC;
-			switch (data_lo)
+			switch (operand_lo)
 			{
 			case REG::X:
 				reg_PC = reg_X;
@@ -4768,10 +4448,10 @@ uint8_t Mc6809::INCA_inh()
 		reg_PC++;
 		break;
 	case 2:		//	R	Don't Care			PC+1
+		ResolveCC();
 		reg_CC = ((reg_A & 0x7f) == 0x7f) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
 		++reg_A;
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
+		SetCC_NZ(reg_A);
 		//reg_PC++;
 		clocksUsed = 255;
 		break;
@@ -4791,10 +4471,10 @@ uint8_t Mc6809::INCB_inh()
 		reg_PC++;
 		break;
 	case 2:		//	R	Don't Care			PC+1
+		ResolveCC();
 		reg_CC = ((reg_B & 0x7f) == 0x7f) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
 		++reg_B;
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
+		SetCC_NZ(reg_B);
 		//reg_PC++;
 		clocksUsed = 255;
 		break;
@@ -4808,7 +4488,6 @@ uint8_t Mc6809::INCB_inh()
 //*****************************************************************************
 uint8_t Mc6809::INC_dir()
 {
-	static uint8_t data_lo;
 
 	switch (++clocksUsed)
 	{
@@ -4822,16 +4501,16 @@ uint8_t Mc6809::INC_dir()
 		scratch_hi = reg_DP;
 		break;
 	case 4:		//	R	Data				EA
-		data_lo = Read(reg_scratch);
+		operand_lo = Read(reg_scratch);
 		break;
 	case 5:		//	R	Don't Care			$ffff
-		reg_CC = ((data_lo & 0x7f) == 0x7f) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
-		++data_lo;
-		AdjustCC_N(data_lo);
-		AdjustCC_Z(data_lo);
+		ResolveCC();
+		reg_CC = ((operand_lo & 0x7f) == 0x7f) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
+		++operand_lo;
+		SetCC_NZ(operand_lo);
 		break;
 	case 6:		// W  Data			EA
-		Write(reg_scratch, data_lo);
+		Write(reg_scratch, operand_lo);
 		clocksUsed = 255;
 		break;
 	}
@@ -4844,7 +4523,6 @@ uint8_t Mc6809::INC_dir()
 //*****************************************************************************
 uint8_t Mc6809::INC_ext()
 {
-	static uint8_t data_lo;
 
 	switch (++clocksUsed)
 	{
@@ -4860,16 +4538,16 @@ uint8_t Mc6809::INC_ext()
 	case 4:		//	R	Don't Care			$ffff
 		break;
 	case 5:		//	R	Data				EA
-		data_lo = Read(reg_scratch);
+		operand_lo = Read(reg_scratch);
 		break;
 	case 6:		//	R	Don't Care			$ffff
-		reg_CC = ((data_lo & 0x7f) == 0x7f) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
-		++data_lo;
-		AdjustCC_N(data_lo);
-		AdjustCC_Z(data_lo);
+		ResolveCC();
+		reg_CC = ((operand_lo & 0x7f) == 0x7f) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
+		++operand_lo;
+		SetCC_NZ(operand_lo);
 		break;
 	case 7:		// W	Data				EA
-		Write(reg_scratch, data_lo);
+		Write(reg_scratch, operand_lo);
 		clocksUsed = 255;
 		break;
 	}
@@ -4945,10 +4623,10 @@ uint8_t Mc6809::JSR_dir()
 	case 5:		//	R	Don't Care			$ffff
 		break;
 	case 6:		//	W	PC Low				SP-1
-		Write(reg_S--, PC_lo);
+		Write(--reg_S, PC_lo);
 		break;
 	case 7:		//	W	PC High				SP-2
-		Write(reg_S--, PC_hi);
+		Write(--reg_S, PC_hi);
 		reg_PC = reg_scratch;
 		clocksUsed = 255;
 		break;
@@ -4980,10 +4658,10 @@ uint8_t Mc6809::JSR_ext()
 	case 6:		//	R	Don't Care			$ffff
 		break;
 	case 7:		//	W	PC Low				SP-1
-		Write(reg_S--, PC_lo);
+		Write(--reg_S, PC_lo);
 		break;
 	case 8:		//	W	PC High				SP-2
-		Write(reg_S--, PC_hi);
+		Write(--reg_S, PC_hi);
 		reg_PC = reg_scratch;
 		clocksUsed = 255;
 		break;
@@ -5013,6 +4691,7 @@ uint8_t Mc6809::LBCS_LBLO_rel()
 		scratch_lo = Read(reg_PC++);
 		break;
 	case 5:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if ((reg_CC & CC::C) != CC::C)
 			clocksUsed = 255;
 		break;
@@ -5040,12 +4719,12 @@ uint8_t Mc6809::LBEQ_rel()
 		break;
 	case 3:		//	R	Offset High			PC+2
 		scratch_hi = Read(reg_PC++);
-		reg_PC++;
 		break;
 	case 4:		//	R	Offset Low			PC+3
 		scratch_lo = Read(reg_PC++);
 		break;
 	case 5:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if ((reg_CC & CC::Z) != CC::Z)
 			clocksUsed = 255;
 		break;
@@ -5073,13 +4752,13 @@ uint8_t Mc6809::LBGE_rel()
 		break;
 	case 3:		//	R	Offset High			PC+2
 		scratch_hi = Read(reg_PC++);
-		reg_PC++;
 		break;
 	case 4:		//	R	Offset Low			PC+3
 		scratch_lo = Read(reg_PC++);
 		break;
 	case 5:		//	R	Don't Care			$ffff
-		if (!(((reg_CC & CC::C) == CC::C) == ((reg_CC & CC::V) == CC::V)))
+		ResolveCC();
+		if (!(((reg_CC & CC::N) == CC::N) == ((reg_CC & CC::V) == CC::V)))
 			clocksUsed = 255;
 		break;
 	case 6:
@@ -5106,12 +4785,12 @@ uint8_t Mc6809::LBGT_rel()
 		break;
 	case 3:		//	R	Offset High			PC+2
 		scratch_hi = Read(reg_PC++);
-		reg_PC++;
 		break;
 	case 4:		//	R	Offset Low			PC+3
 		scratch_lo = Read(reg_PC++);
 		break;
 	case 5:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if (!((((reg_CC & CC::N) == CC::N) && ((reg_CC & CC::V) == CC::V)) && ((reg_CC & CC::Z) == 0)))
 			clocksUsed = 255;
 		break;
@@ -5139,12 +4818,12 @@ uint8_t Mc6809::LBHI_rel()
 		break;
 	case 3:		//	R	Offset High			PC+2
 		scratch_hi = Read(reg_PC++);
-		reg_PC++;
 		break;
 	case 4:		//	R	Offset Low			PC+3
 		scratch_lo = Read(reg_PC++);
 		break;
 	case 5:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if (!(((reg_CC & CC::C) != CC::C) && ((reg_CC & CC::Z) != CC::Z)))
 			clocksUsed = 255;
 		break;
@@ -5173,12 +4852,12 @@ uint8_t Mc6809::LBHS_LBCC_rel()
 		break;
 	case 3:		//	R	Offset High			PC+2
 		scratch_hi = Read(reg_PC++);
-		reg_PC++;
 		break;
 	case 4:		//	R	Offset Low			PC+3
 		scratch_lo = Read(reg_PC++);
 		break;
 	case 5:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if ((reg_CC & CC::C) == CC::C)
 			clocksUsed = 255;
 		break;
@@ -5206,12 +4885,12 @@ uint8_t Mc6809::LBLE_rel()
 		break;
 	case 3:		//	R	Offset High			PC+2
 		scratch_hi = Read(reg_PC++);
-		reg_PC++;
 		break;
 	case 4:		//	R	Offset Low			PC+3
 		scratch_lo = Read(reg_PC++);
 		break;
 	case 5:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if (!(((reg_CC & CC::Z) == CC::Z) ||
 			(((reg_CC & CC::N) == CC::N) && (reg_CC & CC::V) != CC::V) ||
 			(((reg_CC & CC::N) != CC::N) && (reg_CC & CC::V) == CC::V)))
@@ -5241,12 +4920,12 @@ uint8_t Mc6809::LBLS_rel()
 		break;
 	case 3:		//	R	Offset High			PC+2
 		scratch_hi = Read(reg_PC++);
-		reg_PC++;
 		break;
 	case 4:		//	R	Offset Low			PC+3
 		scratch_lo = Read(reg_PC++);
 		break;
 	case 5:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if (!(((reg_CC & CC::C) == CC::C) || ((reg_CC & CC::Z) == CC::Z)))
 			clocksUsed = 255;
 		break;
@@ -5274,13 +4953,13 @@ uint8_t Mc6809::LBLT_rel()
 		break;
 	case 3:		//	R	Offset High			PC+2
 		scratch_hi = Read(reg_PC++);
-		reg_PC++;
 		break;
 	case 4:		//	R	Offset Low			PC+3
 		scratch_lo = Read(reg_PC++);
 		break;
 	case 5:		//	R	Don't Care			$ffff
-		if (!(((reg_CC & CC::C) == CC::C) != ((reg_CC & CC::N) == CC::N)))
+		ResolveCC();
+		if (!(((reg_CC & CC::N) == CC::N) != ((reg_CC & CC::V) == CC::V)))
 			clocksUsed = 255;
 		break;
 	case 6:
@@ -5307,12 +4986,12 @@ uint8_t Mc6809::LBMI_rel()
 		break;
 	case 3:		//	R	Offset High			PC+2
 		scratch_hi = Read(reg_PC++);
-		reg_PC++;
 		break;
 	case 4:		//	R	Offset Low			PC+3
 		scratch_lo = Read(reg_PC++);
 		break;
 	case 5:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if ((reg_CC & CC::N) != CC::N)
 			clocksUsed = 255;
 		break;
@@ -5340,12 +5019,12 @@ uint8_t Mc6809::LBNE_rel()
 		break;
 	case 3:		//	R	Offset High			PC+2
 		scratch_hi = Read(reg_PC++);
-		reg_PC++;
 		break;
 	case 4:		//	R	Offset Low			PC+3
 		scratch_lo = Read(reg_PC++);
 		break;
 	case 5:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if ((reg_CC & CC::Z) == CC::Z)
 			clocksUsed = 255;
 		break;
@@ -5373,12 +5052,12 @@ uint8_t Mc6809::LBPL_rel()
 		break;
 	case 3:		//	R	Offset High			PC+2
 		scratch_hi = Read(reg_PC++);
-		reg_PC++;
 		break;
 	case 4:		//	R	Offset Low			PC+3
 		scratch_lo = Read(reg_PC++);
 		break;
 	case 5:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if ((reg_CC & CC::N) == CC::N)
 			clocksUsed = 255;
 		break;
@@ -5401,16 +5080,14 @@ uint8_t Mc6809::LBRA_rel()
 	case 1:		//	R	Opcode Fetch		PC
 		reg_PC++;
 		break;
-	case 2:		//	R	Opcode 2nd Byte		PC+1
-		reg_PC++;
-		break;
-	case 3:		//	R	Offset High			PC+2
+	case 2:		//	R	Offset High			PC+1
 		scratch_hi = Read(reg_PC++);
-		reg_PC++;
 		break;
-	case 4:		//	R	Offset Low			PC+3
+	case 3:		//	R	Offset Low			PC+2
 		scratch_lo = Read(reg_PC++);
 		break;
+	case 4:		//	R	Don't Care			$ffff
+		break;
 	case 5:		//	R	Don't Care			$ffff
 		reg_PC += reg_scratch;
 		clocksUsed = 255;
@@ -5435,7 +5112,6 @@ uint8_t Mc6809::LBRN_rel()
 		break;
 	case 3:		//	R	Offset High			PC+2
 		scratch_hi = Read(reg_PC++);
-		reg_PC++;
 		break;
 	case 4:		//	R	Offset Low			PC+3
 		scratch_lo = Read(reg_PC++);
@@ -5477,10 +5153,10 @@ uint8_t Mc6809::LBSR_rel()
 	case 7:		//	R	Don't Care			$ffff
 		break;
 	case 8:		// W	Retern Address Low	SP-1
-		Write(reg_S--, PC_lo);
+		Write(--reg_S, PC_lo);
 		break;
 	case 9:		// W	Return Address High SP-2
-		Write(reg_S--, PC_hi);
+		Write(--reg_S, PC_hi);
 		reg_PC = reg_scratch;
 		clocksUsed = 255;
 		break;
@@ -5504,12 +5180,12 @@ uint8_t Mc6809::LBVC_rel()
 		break;
 	case 3:		//	R	Offset High			PC+2
 		scratch_hi = Read(reg_PC++);
-		reg_PC++;
 		break;
 	case 4:		//	R	Offset Low			PC+3
 		scratch_lo = Read(reg_PC++);
 		break;
 	case 5:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if ((reg_CC & CC::V) == CC::V)
 			clocksUsed = 255;
 		break;
@@ -5537,12 +5213,12 @@ uint8_t Mc6809::LBVS_rel()
 		break;
 	case 3:		//	R	Offset High			PC+2
 		scratch_hi = Read(reg_PC++);
-		reg_PC++;
 		break;
 	case 4:		//	R	Offset Low			PC+3
 		scratch_lo = Read(reg_PC++);
 		break;
 	case 5:		//	R	Don't Care			$ffff
+		ResolveCC();
 		if ((reg_CC & CC::V) != CC::V)
 			clocksUsed = 255;
 		break;
@@ -5573,9 +5249,7 @@ uint8_t Mc6809::LDA_dir()
 		break;
 	case 4:		//	R	Data				EA
 		reg_A = Read(reg_scratch);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_A);
 		clocksUsed = 255;
 		break;
 	}
@@ -5603,9 +5277,7 @@ uint8_t Mc6809::LDA_ext()
 		break;
 	case 5:		//	R	Data				EA
 		reg_A = Read(reg_scratch);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_A);
 		clocksUsed = 255;
 		break;
 	}
@@ -5625,9 +5297,7 @@ uint8_t Mc6809::LDA_imm()
 		break;
 	case 2:		//	R	Data				EA
 		reg_A = Read(reg_PC++);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_A);
 		clocksUsed = 255;
 		break;
 	}
@@ -5653,9 +5323,7 @@ uint8_t Mc6809::LDB_dir()
 		break;
 	case 4:		//	R	Data				EA
 		reg_B = Read(reg_scratch);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_B);
 		clocksUsed = 255;
 		break;
 	}
@@ -5683,9 +5351,7 @@ uint8_t Mc6809::LDB_ext()
 		break;
 	case 5:		//	R	Data				EA
 		reg_B = Read(reg_scratch);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_B);
 		clocksUsed = 255;
 		break;
 	}
@@ -5705,9 +5371,7 @@ uint8_t Mc6809::LDB_imm()
 		break;
 	case 2:		//	R	Data				EA
 		reg_B = Read(reg_PC++);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_B);
 		clocksUsed = 255;
 		break;
 	}
@@ -5736,9 +5400,7 @@ uint8_t Mc6809::LDD_dir()
 		break;
 	case 5:		//	R	Register Low		EA+1
 		reg_B = Read(reg_scratch);
-		AdjustCC_N(reg_D);
-		AdjustCC_Z(reg_D);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_D);
 		clocksUsed = 255;
 		break;
 	}
@@ -5769,9 +5431,7 @@ uint8_t Mc6809::LDD_ext()
 		break;
 	case 6:		//	R	Register Low		EA+1
 		reg_B = Read(reg_scratch);
-		AdjustCC_N(reg_D);
-		AdjustCC_Z(reg_D);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_D);
 		clocksUsed = 255;
 		break;
 	}
@@ -5794,9 +5454,7 @@ uint8_t Mc6809::LDD_imm()
 		break;
 	case 3:		//	R	Register Low		PC+2
 		reg_B = Read(reg_PC++);
-		AdjustCC_N(reg_D);
-		AdjustCC_Z(reg_D);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_D);
 		clocksUsed = 255;
 		break;
 	}
@@ -5828,9 +5486,7 @@ uint8_t Mc6809::LDS_dir()
 		break;
 	case 6:		//	R	Register Low		EA+1
 		S_lo = Read(reg_scratch);
-		AdjustCC_N(reg_S);
-		AdjustCC_Z(reg_S);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_S);
 		clocksUsed = 255;
 		break;
 	}
@@ -5864,9 +5520,7 @@ uint8_t Mc6809::LDS_ext()
 		break;
 	case 7:		//	R	Register Low		EA+1
 		S_lo = Read(reg_scratch);
-		AdjustCC_N(reg_S);
-		AdjustCC_Z(reg_S);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_S);
 		clocksUsed = 255;
 		break;
 	}
@@ -5892,9 +5546,7 @@ uint8_t Mc6809::LDS_imm()
 		break;
 	case 4:		//	R	Register Low		PC+2
 		S_lo = Read(reg_PC++);
-		AdjustCC_N(reg_S);
-		AdjustCC_Z(reg_S);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_S);
 		clocksUsed = 255;
 		break;
 	}
@@ -5923,9 +5575,7 @@ uint8_t Mc6809::LDU_dir()
 		break;
 	case 5:		//	R	Register Low		EA+1
 		U_lo = Read(reg_scratch);
-		AdjustCC_N(reg_U);
-		AdjustCC_Z(reg_U);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_U);
 		clocksUsed = 255;
 		break;
 	}
@@ -5956,9 +5606,7 @@ uint8_t Mc6809::LDU_ext()
 		break;
 	case 6:		//	R	Register Low		EA+1
 		U_lo = Read(reg_scratch);
-		AdjustCC_N(reg_U);
-		AdjustCC_Z(reg_U);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_U);
 		clocksUsed = 255;
 		break;
 	}
@@ -5981,9 +5629,7 @@ uint8_t Mc6809::LDU_imm()
 		break;
 	case 3:		//	R	Register Low		PC+2
 		U_lo = Read(reg_PC++);
-		AdjustCC_N(reg_U);
-		AdjustCC_Z(reg_U);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_U);
 		clocksUsed = 255;
 		break;
 	}
@@ -6012,9 +5658,7 @@ uint8_t Mc6809::LDX_dir()
 		break;
 	case 5:		//	R	Register Low		EA+1
 		X_lo = Read(reg_scratch);
-		AdjustCC_N(reg_X);
-		AdjustCC_Z(reg_X);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_X);
 		clocksUsed = 255;
 		break;
 	}
@@ -6045,9 +5689,7 @@ uint8_t Mc6809::LDX_ext()
 		break;
 	case 6:		//	R	Register Low		EA+1
 		X_lo = Read(reg_scratch);
-		AdjustCC_N(reg_X);
-		AdjustCC_Z(reg_X);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_X);
 		clocksUsed = 255;
 		break;
 	}
@@ -6070,9 +5712,7 @@ uint8_t Mc6809::LDX_imm()
 		break;
 	case 3:		//	R	Register Low		PC+2
 		X_lo = Read(reg_PC++);
-		AdjustCC_N(reg_X);
-		AdjustCC_Z(reg_X);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_X);
 		clocksUsed = 255;
 		break;
 	}
@@ -6104,9 +5744,7 @@ uint8_t Mc6809::LDY_dir()
 		break;
 	case 6:		//	R	Register Low		EA+1
 		Y_lo = Read(reg_scratch);
-		AdjustCC_N(reg_Y);
-		AdjustCC_Z(reg_Y);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_Y);
 		clocksUsed = 255;
 		break;
 	}
@@ -6140,9 +5778,7 @@ uint8_t Mc6809::LDY_ext()
 		break;
 	case 7:		//	R	Register Low		EA+1
 		Y_lo = Read(reg_scratch);
-		AdjustCC_N(reg_Y);
-		AdjustCC_Z(reg_Y);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_Y);
 		clocksUsed = 255;
 		break;
 	}
@@ -6168,9 +5804,7 @@ uint8_t Mc6809::LDY_imm()
 		break;
 	case 4:		//	R	Register Low		PC+2
 		Y_lo = Read(reg_PC++);
-		AdjustCC_N(reg_Y);
-		AdjustCC_Z(reg_Y);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_Y);
 		clocksUsed = 255;
 		break;
 	}
@@ -6189,10 +5823,10 @@ uint8_t Mc6809::LSRA_inh()
 		reg_PC++;
 		break;
 	case 2:		//	R	Don't Care			PC+1
+		ResolveCC();
 		reg_CC = ((reg_A & 0x01) == 1) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
 		reg_A = ((reg_A >> 1) & 0x7f);
-		AdjustCC_Z(reg_A);
-		reg_CC &= ~CC::N;
+		SetCC_NZ(reg_A);
 		//reg_PC++;
 		clocksUsed = 255;
 		break;
@@ -6212,10 +5846,10 @@ uint8_t Mc6809::LSRB_inh()
 		reg_PC++;
 		break;
 	case 2:		//	R	Don't Care			PC+1
+		ResolveCC();
 		reg_CC = ((reg_B & 0x01) == 1) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
 		reg_B = ((reg_B >> 1) & 0x7f);
-		AdjustCC_Z(reg_B);
-		reg_CC &= ~CC::N;
+		SetCC_NZ(reg_B);
 		//reg_PC++;
 		clocksUsed = 255;
 		break;
@@ -6229,7 +5863,6 @@ uint8_t Mc6809::LSRB_inh()
 //*****************************************************************************
 uint8_t Mc6809::LSR_dir()
 {
-	static uint8_t data_lo;
 
 	switch (++clocksUsed)
 	{
@@ -6243,16 +5876,16 @@ uint8_t Mc6809::LSR_dir()
 		scratch_hi = reg_DP;
 		break;
 	case 4:		//	R	Data				EA
-		data_lo = Read(reg_scratch);
+		operand_lo = Read(reg_scratch);
 		break;
 	case 5:		//	R	Don't Care			$ffff
-		reg_CC = ((data_lo & 0x01) == 1) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
-		data_lo = ((data_lo >> 1) & 0x7f);
-		AdjustCC_Z(data_lo);
-		reg_CC &= ~CC::N;
+		ResolveCC();
+		reg_CC = ((operand_lo & 0x01) == 1) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
+		operand_lo = ((operand_lo >> 1) & 0x7f);
+		SetCC_NZ(operand_lo);
 		break;
 	case 6:		//	W	Data				EA
-		Write(reg_scratch, data_lo);
+		Write(reg_scratch, operand_lo);
 		clocksUsed = 255;
 		break;
 	}
@@ -6265,7 +5898,6 @@ uint8_t Mc6809::LSR_dir()
 //*****************************************************************************
 uint8_t Mc6809::LSR_ext()
 {
-	static uint8_t data_lo;
 
 	switch (++clocksUsed)
 	{
@@ -6281,16 +5913,16 @@ uint8_t Mc6809::LSR_ext()
 	case 4:		//	R	Don't Care			$ffff
 		break;
 	case 5:		//	R	Data				EA
-		data_lo = Read(reg_scratch);
+		operand_lo = Read(reg_scratch);
 		break;
 	case 6:		//	R	Don't Care			$ffff
-		reg_CC = ((data_lo & 0x01) == 1) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
-		data_lo = ((data_lo >> 1) & 0x7f);
-		AdjustCC_Z(data_lo);
-		reg_CC &= ~CC::N;
+		ResolveCC();
+		reg_CC = ((operand_lo & 0x01) == 1) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
+		operand_lo = ((operand_lo >> 1) & 0x7f);
+		SetCC_NZ(operand_lo);
 		break;
 	case 7:		//	W	Data				EA
-		Write(reg_scratch, data_lo);
+		Write(reg_scratch, operand_lo);
 		clocksUsed = 255;
 		break;
 	}
@@ -6318,7 +5950,7 @@ uint8_t Mc6809::MUL_inh()
 		AdjustCC_Z(reg_D);
 		break;
 	case 5:		//	R	Don't Care			$ffff
-		reg_CC = ((reg_B & 0x80) != 0) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
+		AdjustCC_C((uint16_t)(reg_B << 1));
 		break;
 	case 6:		//	R	Don't Care			$ffff
 		break;
@@ -6343,18 +5975,17 @@ uint8_t Mc6809::MUL_inh()
 //*****************************************************************************
 uint8_t Mc6809::NEGA_inh()
 {
-	xyz;
 	switch (++clocksUsed)
 	{
 	case 1:		//	R	Opcode Fetch		PC
 		reg_PC++;
 		break;
 	case 2:		//	R	Don't Care			PC+1
+		ResolveCC();
 		reg_CC = (reg_A == 0x80) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
 		reg_CC = (reg_A != 0) ? (reg_CC & ~CC::C) : (reg_CC | CC::C);
 		reg_A = 0 - reg_A;
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
+		SetCC_NZ(reg_A);
 		//reg_PC++;
 		clocksUsed = 255;
 		break;
@@ -6374,11 +6005,11 @@ uint8_t Mc6809::NEGB_inh()
 		reg_PC++;
 		break;
 	case 2:		//	R	Don't Care			PC+1
+		ResolveCC();
 		reg_CC = (reg_B == 0x80) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
 		reg_CC = (reg_B != 0) ? (reg_CC & ~CC::C) : (reg_CC | CC::C);
 		reg_B = 0 - reg_B;
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
+		SetCC_NZ(reg_B);
 		//reg_PC++;
 		clocksUsed = 255;
 		break;
@@ -6392,7 +6023,6 @@ uint8_t Mc6809::NEGB_inh()
 //*****************************************************************************
 uint8_t Mc6809::NEG_dir()
 {
-	static uint8_t data_lo;
 
 	switch (++clocksUsed)
 	{
@@ -6406,17 +6036,17 @@ uint8_t Mc6809::NEG_dir()
 		scratch_hi = reg_DP;
 		break;
 	case 4:		//	R	Data				EA
-		data_lo = Read(reg_scratch);
+		operand_lo = Read(reg_scratch);
 		break;
 	case 5:		//	R	Don't Care			$ffff
-		reg_CC = (data_lo == 0x80) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
-		reg_CC = (data_lo != 0) ? (reg_CC & ~CC::C) : (reg_CC | CC::C);
-		data_lo = 0 - data_lo;
-		AdjustCC_N(data_lo);
-		AdjustCC_Z(data_lo);
+		ResolveCC();
+		reg_CC = (operand_lo == 0x80) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
+		reg_CC = (operand_lo != 0) ? (reg_CC & ~CC::C) : (reg_CC | CC::C);
+		operand_lo = 0 - operand_lo;
+		SetCC_NZ(operand_lo);
 		break;
 	case 6:		//	W	Data				EA
-		Write(reg_scratch, data_lo);
+		Write(reg_scratch, operand_lo);
 		clocksUsed = 255;
 		break;
 	}
@@ -6429,7 +6059,6 @@ uint8_t Mc6809::NEG_dir()
 //*****************************************************************************
 uint8_t Mc6809::NEG_ext()
 {
-	static uint8_t data_lo;
 
 	switch (++clocksUsed)
 	{
@@ -6445,17 +6074,17 @@ uint8_t Mc6809::NEG_ext()
 	case 4:		//	R	Don't Care			$ffff
 		break;
 	case 5:		//	R	Data				EA
-		data_lo = Read(reg_scratch);
+		operand_lo = Read(reg_scratch);
 		break;
 	case 6:		//	R	Don't Care			$ffff
-		reg_CC = (data_lo == 0x80) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
-		reg_CC = (data_lo != 0) ? (reg_CC & ~CC::C) : (reg_CC | CC::C);
-		data_lo = 0 - data_lo;
-		AdjustCC_N(data_lo);
-		AdjustCC_Z(data_lo);
+		ResolveCC();
+		reg_CC = (operand_lo == 0x80) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
+		reg_CC = (operand_lo != 0) ? (reg_CC & ~CC::C) : (reg_CC | CC::C);
+		operand_lo = 0 - operand_lo;
+		SetCC_NZ(operand_lo);
 		break;
 	case 7:		//	W	Data				EA
-		Write(reg_scratch, data_lo);
+		Write(reg_scratch, operand_lo);
 		clocksUsed = 255;
 		break;
 	}
@@ -6501,9 +6130,7 @@ uint8_t Mc6809::ORA_dir()
 	case 4:		//	R	Data					EA
 		scratch_lo = Read(reg_scratch);
 		reg_A |= scratch_lo;
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_A);
 		clocksUsed = 255;
 		break;
 	}
@@ -6532,9 +6159,7 @@ uint8_t Mc6809::ORA_ext()
 	case 5:		//	R	Data					EA
 		scratch_lo = Read(reg_scratch);
 		reg_A |= scratch_lo;
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_A);
 		clocksUsed = 255;
 		break;
 	}
@@ -6555,9 +6180,7 @@ uint8_t Mc6809::ORA_imm()
 	case 2:		//	R	Data					PC+1
 		scratch_lo = Read(reg_PC++);
 		reg_A |= scratch_lo;
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_A);
 		clocksUsed = 255;
 		break;
 	}
@@ -6586,9 +6209,7 @@ uint8_t Mc6809::ORB_dir()
 	case 5:		//	R	Data					EA
 		scratch_lo = Read(reg_scratch);
 		reg_B |= scratch_lo;
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_B);
 		clocksUsed = 255;
 		break;
 	}
@@ -6617,9 +6238,7 @@ uint8_t Mc6809::ORB_ext()
 	case 5:		//	R	Data					EA
 		scratch_lo = Read(reg_scratch);
 		reg_B |= scratch_lo;
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_B);
 		clocksUsed = 255;
 		break;
 	}
@@ -6640,9 +6259,7 @@ uint8_t Mc6809::ORB_imm()
 	case 2:		//	R	Data					PC+1
 		scratch_lo = Read(reg_PC++);
 		reg_B |= scratch_lo;
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_B);
 		clocksUsed = 255;
 		break;
 	}
@@ -6664,6 +6281,7 @@ uint8_t Mc6809::ORCC_imm()
 		scratch_lo = Read(reg_PC++);
 		break;
 	case 3:		//	R	Don't Care			$ffff
+		ResolveCC();
 		reg_CC |= scratch_lo;
 		break;
 	}
@@ -6676,7 +6294,6 @@ uint8_t Mc6809::ORCC_imm()
 //*****************************************************************************
 uint8_t Mc6809::PSHS_imm()
 {
-	static int8_t bitNumber;
 
 	switch (++clocksUsed)
 	{
@@ -6687,68 +6304,69 @@ uint8_t Mc6809::PSHS_imm()
 		scratch_lo = Read(reg_PC++);
 		break;
 	case 3:		//	R	Don't Care			$ffff
-		bitNumber = 7;
+		bitNumber = 8;
 		break;
 	case 4:		//	R	Don't Care			$ffff
 		break;
 	case 5:		//	R	Don't Care			SP
+		// PC first, CC last, one byte a cycle from here on
+		while (--bitNumber >= 0 && !((scratch_lo >> bitNumber) & 0x01))
+			;
+		if (bitNumber < 0)
+			clocksUsed = 255;
 		break;
 	case 6:		//	W	Register ?
-		while (bitNumber >= 0 && !((scratch_lo >> bitNumber) & 0x01))
-			--bitNumber;
-
-		if (bitNumber > 0)
-			return(255);
-
 		switch (bitNumber)
 		{
 		case 7:
-			Write(reg_S--, PC_lo);
+			Write(--reg_S, PC_lo);
 			break;
 		case 6:
-			Write(reg_S--, U_lo);
+			Write(--reg_S, U_lo);
 			break;
 		case 5:
-			Write(reg_S--, Y_lo);
+			Write(--reg_S, Y_lo);
 			break;
 		case 4:
-			Write(reg_S--, X_lo);
+			Write(--reg_S, X_lo);
 			break;
 		case 3:
-			Write(reg_S--, reg_DP);
-			--clocksUsed;
+			Write(--reg_S, reg_DP);
 			break;
 		case 2:
-			Write(reg_S--, reg_B);
-			--clocksUsed;
+			Write(--reg_S, reg_B);
 			break;
 		case 1:
-			Write(reg_S--, reg_A);
-			--clocksUsed;
+			Write(--reg_S, reg_A);
 			break;
 		case 0:
-			Write(reg_S--, reg_CC);
-			--clocksUsed;
+			ResolveCC();
+			Write(--reg_S, reg_CC);
 			break;
 		}
-		break;
+		if (bitNumber >= 4)
+			break;								// high byte on the next cycle
+		// fall through
 	case 7:		//	W	Register ?
 		switch (bitNumber)
 		{
 		case 7:
-			Write(reg_S--, PC_hi);
+			Write(--reg_S, PC_hi);
 			break;
 		case 6:
-			Write(reg_S--, U_hi);
+			Write(--reg_S, U_hi);
 			break;
 		case 5:
-			Write(reg_S--, Y_hi);
+			Write(--reg_S, Y_hi);
 			break;
 		case 4:
-			Write(reg_S--, X_hi);
+			Write(--reg_S, X_hi);
 			break;
 		}
-		clocksUsed -= 2;
+
+		while (--bitNumber >= 0 && !((scratch_lo >> bitNumber) & 0x01))
+			;
+		clocksUsed = (bitNumber < 0) ? 255 : 5;
 		break;
 	}
 	return(clocksUsed);
@@ -6760,7 +6378,6 @@ uint8_t Mc6809::PSHS_imm()
 //*****************************************************************************
 uint8_t Mc6809::PSHU_imm()
 {
-	static int8_t bitNumber;
 
 	switch (++clocksUsed)
 	{
@@ -6771,68 +6388,69 @@ uint8_t Mc6809::PSHU_imm()
 		scratch_lo = Read(reg_PC++);
 		break;
 	case 3:		//	R	Don't Care			$ffff
-		bitNumber = 7;
+		bitNumber = 8;
 		break;
 	case 4:		//	R	Don't Care			$ffff
 		break;
 	case 5:		//	R	Don't Care			SP
+		// PC first, CC last, one byte a cycle from here on
+		while (--bitNumber >= 0 && !((scratch_lo >> bitNumber) & 0x01))
+			;
+		if (bitNumber < 0)
+			clocksUsed = 255;
 		break;
 	case 6:		//	W	Register ?
-		while (bitNumber >= 0 && !((scratch_lo >> bitNumber) & 0x01))
-			--bitNumber;
-
-		if (bitNumber > 0)
-			return(255);
-
 		switch (bitNumber)
 		{
 		case 7:
-			Write(reg_U--, PC_lo);
+			Write(--reg_U, PC_lo);
 			break;
 		case 6:
-			Write(reg_U--, S_lo);
+			Write(--reg_U, S_lo);
 			break;
 		case 5:
-			Write(reg_U--, Y_lo);
+			Write(--reg_U, Y_lo);
 			break;
 		case 4:
-			Write(reg_U--, X_lo);
+			Write(--reg_U, X_lo);
 			break;
 		case 3:
-			Write(reg_U--, reg_DP);
-			--clocksUsed;
+			Write(--reg_U, reg_DP);
 			break;
 		case 2:
-			Write(reg_U--, reg_B);
-			--clocksUsed;
+			Write(--reg_U, reg_B);
 			break;
 		case 1:
-			Write(reg_U--, reg_A);
-			--clocksUsed;
+			Write(--reg_U, reg_A);
 			break;
 		case 0:
-			Write(reg_U--, reg_CC);
-			--clocksUsed;
+			ResolveCC();
+			Write(--reg_U, reg_CC);
 			break;
 		}
-		break;
+		if (bitNumber >= 4)
+			break;								// high byte on the next cycle
+		// fall through
 	case 7:		//	W	Register ?
 		switch (bitNumber)
 		{
 		case 7:
-			Write(reg_U--, PC_hi);
+			Write(--reg_U, PC_hi);
 			break;
 		case 6:
-			Write(reg_U--, S_hi);
+			Write(--reg_U, S_hi);
 			break;
 		case 5:
-			Write(reg_U--, Y_hi);
+			Write(--reg_U, Y_hi);
 			break;
 		case 4:
-			Write(reg_U--, X_hi);
+			Write(--reg_U, X_hi);
 			break;
 		}
-		clocksUsed -= 2;
+
+		while (--bitNumber >= 0 && !((scratch_lo >> bitNumber) & 0x01))
+			;
+		clocksUsed = (bitNumber < 0) ? 255 : 5;
 		break;
 	}
 	return(clocksUsed);
@@ -6844,7 +6462,6 @@ uint8_t Mc6809::PSHU_imm()
 //*****************************************************************************
 uint8_t Mc6809::PULS_imm()
 {
-	static int8_t bitNumber;
 
 	switch (++clocksUsed)
 	{
@@ -6855,68 +6472,69 @@ uint8_t Mc6809::PULS_imm()
 		scratch_lo = Read(reg_PC++);
 		break;
 	case 3:		//	R	Don't Care			$ffff
-		bitNumber = 0;
+		bitNumber = -1;
 		break;
 	case 4:		//	R	Don't Care			$ffff
 		break;
 	case 5:		//	R	Don't Care			SP
+		// CC first, PC last, one byte a cycle from here on
+		while (++bitNumber < 8 && !((scratch_lo >> bitNumber) & 0x01))
+			;
+		if (bitNumber >= 8)
+			clocksUsed = 255;
 		break;
 	case 6:		//	R	Register ?
-		while (bitNumber > 8 && !((scratch_lo >> bitNumber) & 0x01))
-			++bitNumber;
-
-		if (bitNumber >= 8)
-			return(255);
-
 		switch (bitNumber)
 		{
 		case 7:
-			Write(++reg_S, PC_hi);
+			PC_hi = Read(reg_S++);
 			break;
 		case 6:
-			Write(++reg_S, U_hi);
+			U_hi = Read(reg_S++);
 			break;
 		case 5:
-			Write(++reg_S, Y_hi);
+			Y_hi = Read(reg_S++);
 			break;
 		case 4:
-			Write(++reg_S, X_hi);
+			X_hi = Read(reg_S++);
 			break;
 		case 3:
-			Write(++reg_S, reg_DP);
-			--clocksUsed;
+			reg_DP = Read(reg_S++);
 			break;
 		case 2:
-			Write(++reg_S, reg_B);
-			--clocksUsed;
+			reg_B = Read(reg_S++);
 			break;
 		case 1:
-			Write(++reg_S, reg_A);
-			--clocksUsed;
+			reg_A = Read(reg_S++);
 			break;
 		case 0:
-			Write(++reg_S, reg_CC);
-			--clocksUsed;
+			ResolveCC();
+			reg_CC = Read(reg_S++);
 			break;
 		}
-		break;
+		if (bitNumber >= 4)
+			break;								// low byte on the next cycle
+		// fall through
 	case 7:		//	R	Register ?
 		switch (bitNumber)
 		{
 		case 7:
-			Write(++reg_S, PC_lo);
+			PC_lo = Read(reg_S++);
 			break;
 		case 6:
-			Write(++reg_S, U_lo);
+			U_lo = Read(reg_S++);
 			break;
 		case 5:
-			Write(++reg_S, Y_lo);
+			Y_lo = Read(reg_S++);
 			break;
 		case 4:
-			Write(++reg_S, X_lo);
+			X_lo = Read(reg_S++);
 			break;
 		}
-		clocksUsed -= 2;
+
+		while (++bitNumber < 8 && !((scratch_lo >> bitNumber) & 0x01))
+			;
+		clocksUsed = (bitNumber >= 8) ? 255 : 5;
 		break;
 	}
 	return(clocksUsed);
@@ -6928,7 +6546,6 @@ uint8_t Mc6809::PULS_imm()
 //*****************************************************************************
 uint8_t Mc6809::PULU_imm()
 {
-	static int8_t bitNumber;
 
 	switch (++clocksUsed)
 	{
@@ -6939,68 +6556,69 @@ uint8_t Mc6809::PULU_imm()
 		scratch_lo = Read(reg_PC++);
 		break;
 	case 3:		//	R	Don't Care			$ffff
-		bitNumber = 0;
+		bitNumber = -1;
 		break;
 	case 4:		//	R	Don't Care			$ffff
 		break;
 	case 5:		//	R	Don't Care			SP
-		break;
-	case 6:		//	W	Register ?
-		while (bitNumber > 8 && !((scratch_lo >> bitNumber) & 0x01))
-			++bitNumber;
-
+		// CC first, PC last, one byte a cycle from here on
+		while (++bitNumber < 8 && !((scratch_lo >> bitNumber) & 0x01))
+			;
 		if (bitNumber >= 8)
-			return(255);
-
+			clocksUsed = 255;
+		break;
+	case 6:		//	R	Register ?
 		switch (bitNumber)
 		{
 		case 7:
-			Write(++reg_U, PC_hi);
+			PC_hi = Read(reg_U++);
 			break;
 		case 6:
-			Write(++reg_U, S_hi);
+			S_hi = Read(reg_U++);
 			break;
 		case 5:
-			Write(++reg_U, Y_hi);
+			Y_hi = Read(reg_U++);
 			break;
 		case 4:
-			Write(++reg_U, X_hi);
+			X_hi = Read(reg_U++);
 			break;
 		case 3:
-			Write(++reg_U, reg_DP);
-			--clocksUsed;
+			reg_DP = Read(reg_U++);
 			break;
 		case 2:
-			Write(++reg_U, reg_B);
-			--clocksUsed;
+			reg_B = Read(reg_U++);
 			break;
 		case 1:
-			Write(++reg_U, reg_A);
-			--clocksUsed;
+			reg_A = Read(reg_U++);
 			break;
 		case 0:
-			Write(++reg_U, reg_CC);
-			--clocksUsed;
+			ResolveCC();
+			reg_CC = Read(reg_U++);
 			break;
 		}
-		break;
-	case 7:		//	W	Register ?
+		if (bitNumber >= 4)
+			break;								// low byte on the next cycle
+		// fall through
+	case 7:		//	R	Register ?
 		switch (bitNumber)
 		{
 		case 7:
-			Write(++reg_U, PC_lo);
+			PC_lo = Read(reg_U++);
 			break;
 		case 6:
-			Write(++reg_U, S_lo);
+			S_lo = Read(reg_U++);
 			break;
 		case 5:
-			Write(++reg_U, Y_lo);
+			Y_lo = Read(reg_U++);
 			break;
 		case 4:
-			Write(++reg_U, X_lo);
+			X_lo = Read(reg_U++);
 			break;
 		}
-		clocksUsed -= 2;
+
+		while (++bitNumber < 8 && !((scratch_lo >> bitNumber) & 0x01))
+			;
+		clocksUsed = (bitNumber >= 8) ? 255 : 5;
 		break;
 	}
 	return(clocksUsed);
@@ -7018,12 +6636,12 @@ uint8_t Mc6809::ROLA_inh()
 		reg_PC++;
 		break;
 	case 2:		//	R	Don't Care			PC+1
+		ResolveCC();
 		scratch_lo = ((reg_CC & CC::C) != 0) ? 1 : 0;
 		AdjustCC_V(scratch_lo);
 		reg_CC = ((reg_A & 0x80) != 0) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
 		reg_A = (reg_A << 1) | scratch_lo;
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
+		SetCC_NZ(reg_A);
 		//reg_PC++;
 		clocksUsed = 255;
 		break;
@@ -7043,12 +6661,12 @@ uint8_t Mc6809::ROLB_inh()
 		reg_PC++;
 		break;
 	case 2:		//	R	Don't Care			PC+1
+		ResolveCC();
 		scratch_lo = ((reg_CC & CC::C) != 0) ? 1 : 0;
 		AdjustCC_V(scratch_lo);
 		reg_CC = ((reg_B & 0x80) != 0) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
 		reg_B = (reg_B << 1) | scratch_lo;
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
+		SetCC_NZ(reg_B);
 		//reg_PC++;
 		clocksUsed = 255;
 		break;
@@ -7062,8 +6680,7 @@ uint8_t Mc6809::ROLB_inh()
 //*****************************************************************************
 uint8_t Mc6809::ROL_dir()
 {
-	static uint8_t data_lo;
-	static uint8_t carry;
+	uint8_t carry;
 
 	switch (++clocksUsed)
 	{
@@ -7077,18 +6694,18 @@ uint8_t Mc6809::ROL_dir()
 		scratch_hi = DP;
 		break;
 	case 4:		//	R	Data					EA
-		data_lo = Read(reg_scratch);
+		operand_lo = Read(reg_scratch);
 		break;
 	case 5:		//	R	Don't Care				$ffff
+		ResolveCC();
 		carry = ((reg_CC & CC::C) != 0) ? 1 : 0;
-		AdjustCC_V(data_lo);
-		reg_CC = ((data_lo & 0x80) != 0) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
-		data_lo = (data_lo << 1) | carry;
-		AdjustCC_N(data_lo);
-		AdjustCC_Z(data_lo);
+		AdjustCC_V(operand_lo);
+		reg_CC = ((operand_lo & 0x80) != 0) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
+		operand_lo = (operand_lo << 1) | carry;
+		SetCC_NZ(operand_lo);
 		break;
 	case 6:		//	W	Data					EA
-		Write(reg_scratch, data_lo);
+		Write(reg_scratch, operand_lo);
 		clocksUsed = 255;
 		break;
 	}
@@ -7101,8 +6718,7 @@ uint8_t Mc6809::ROL_dir()
 //*****************************************************************************
 uint8_t Mc6809::ROL_ext()
 {
-	static uint8_t data_lo;
-	static uint8_t carry;
+	uint8_t carry;
 
 	switch (++clocksUsed)
 	{
@@ -7118,18 +6734,18 @@ uint8_t Mc6809::ROL_ext()
 	case 4:		//	R	Don't Care				$ffff
 		break;
 	case 5:		//	R	Data					EA
-		data_lo = Read(reg_scratch);
+		operand_lo = Read(reg_scratch);
 		break;
 	case 6:		//	R	Don't Care				$ffff
+		ResolveCC();
 		carry = ((reg_CC & CC::C) != 0) ? 1 : 0;
-		AdjustCC_V(data_lo);
-		reg_CC = ((data_lo & 0x80) != 0) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
-		data_lo = (data_lo << 1) | carry;
-		AdjustCC_N(data_lo);
-		AdjustCC_Z(data_lo);
+		AdjustCC_V(operand_lo);
+		reg_CC = ((operand_lo & 0x80) != 0) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
+		operand_lo = (operand_lo << 1) | carry;
+		SetCC_NZ(operand_lo);
 		break;
 	case 7:		//	W	Data					EA
-		Write(reg_scratch, data_lo);
+		Write(reg_scratch, operand_lo);
 		clocksUsed = 255;
 		break;
 	}
@@ -7148,11 +6764,11 @@ uint8_t Mc6809::RORA_inh()
 		reg_PC++;
 		break;
 	case 2:		//	R	Don't Care			PC+1
+		ResolveCC();
 		scratch_hi = ((reg_CC & CC::C) != 0) ? 0x80 : 0;
 		reg_CC = ((reg_A & 0x01) != 0) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
 		reg_A = (reg_A >> 1) | scratch_hi;
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
+		SetCC_NZ(reg_A);
 		//reg_PC++;
 		clocksUsed = 255;
 		break;
@@ -7172,11 +6788,11 @@ uint8_t Mc6809::RORB_inh()
 		reg_PC++;
 		break;
 	case 2:		//	R	Don't Care			PC+1
+		ResolveCC();
 		scratch_lo = ((reg_CC & CC::C) != 0) ? 0x80 : 0;
 		reg_CC = ((reg_B & 0x01) != 0) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
 		reg_B = (reg_B >> 1) | scratch_lo;
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
+		SetCC_NZ(reg_B);
 		//reg_PC++;
 		clocksUsed = 255;
 		break;
@@ -7190,8 +6806,7 @@ uint8_t Mc6809::RORB_inh()
 //*****************************************************************************
 uint8_t Mc6809::ROR_dir()
 {
-	static uint8_t data_lo;
-	static uint8_t carry;
+	uint8_t carry;
 
 	switch (++clocksUsed)
 	{
@@ -7205,17 +6820,17 @@ uint8_t Mc6809::ROR_dir()
 		scratch_hi = DP;
 		break;
 	case 4:		//	R	Data					EA
-		data_lo = Read(reg_scratch);
+		operand_lo = Read(reg_scratch);
 		break;
 	case 5:		//	R	Don't Care				$ffff
+		ResolveCC();
 		carry = ((reg_CC & CC::C) != 0) ? 0x80 : 0;
-		reg_CC = ((data_lo & 0x01) != 0) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
-		data_lo = (data_lo >> 1) | carry;
-		AdjustCC_N(data_lo);
-		AdjustCC_Z(data_lo);
+		reg_CC = ((operand_lo & 0x01) != 0) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
+		operand_lo = (operand_lo >> 1) | carry;
+		SetCC_NZ(operand_lo);
 		break;
 	case 6:		//	W	Data					EA
-		Write(reg_scratch, data_lo);
+		Write(reg_scratch, operand_lo);
 		clocksUsed = 255;
 		break;
 	}
@@ -7228,8 +6843,7 @@ uint8_t Mc6809::ROR_dir()
 //*****************************************************************************
 uint8_t Mc6809::ROR_ext()
 {
-	static uint8_t data_lo;
-	static uint8_t carry;
+	uint8_t carry;
 
 	switch (++clocksUsed)
 	{
@@ -7245,17 +6859,17 @@ uint8_t Mc6809::ROR_ext()
 	case 4:		//	R	Don't Care				$ffff
 		break;
 	case 5:		//	R	Data					EA
-		data_lo = Read(reg_scratch);
+		operand_lo = Read(reg_scratch);
 		break;
 	case 6:		//	R	Don't Care				$ffff
+		ResolveCC();
 		carry = ((reg_CC & CC::C) != 0) ? 0x80 : 0;
-		reg_CC = ((data_lo & 0x01) != 0) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
-		data_lo = (data_lo >> 1) | carry;
-		AdjustCC_N(data_lo);
-		AdjustCC_Z(data_lo);
+		reg_CC = ((operand_lo & 0x01) != 0) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
+		operand_lo = (operand_lo >> 1) | carry;
+		SetCC_NZ(operand_lo);
 		break;
 	case 7:		//	W	Data					EA
-		Write(reg_scratch, data_lo);
+		Write(reg_scratch, operand_lo);
 		clocksUsed = 255;
 		break;
 	}
@@ -7276,7 +6890,8 @@ uint8_t Mc6809::RTI_inh()
 	case 2:		//	R	Don't Care			PC+1
 		break;
 	case 3:		//	R	CCR					SP
-		reg_CC = Read(++reg_S);
+		ResolveCC();
+		reg_CC = Read(reg_S++);
 		break;
 	}
 
@@ -7286,10 +6901,10 @@ uint8_t Mc6809::RTI_inh()
 		switch (clocksUsed)
 		{
 		case 4: //	R	PC High				SP+1
-			PC_hi = Read(++reg_S);
+			PC_hi = Read(reg_S++);
 			break;
 		case 5: //	R	PC low				SP+2
-			PC_lo = Read(++reg_S);
+			PC_lo = Read(reg_S++);
 			break;
 		case 6: //	R	Don't Care			$ffff
 			clocksUsed = 255;
@@ -7303,37 +6918,37 @@ uint8_t Mc6809::RTI_inh()
 	switch (clocksUsed)
 	{
 	case 4:		//	R	A Register			SP+1
-		reg_A = Read(++reg_S);
+		reg_A = Read(reg_S++);
 		break;
 	case 5:		//	R	B Register			SP+2
-		reg_B = Read(++reg_S);
+		reg_B = Read(reg_S++);
 		break;
 	case 6:		//	R	DP Register			SP+3
-		reg_DP = Read(++reg_S);
+		reg_DP = Read(reg_S++);
 		break;
 	case 7:		//	R	X Register High		SP+4
-		X_hi = Read(++reg_S);
+		X_hi = Read(reg_S++);
 		break;
 	case 8:		//	R	X Register Low		SP+5
-		X_lo = Read(++reg_S);
+		X_lo = Read(reg_S++);
 		break;
 	case 9:		//	R	Y Register High		SP+6
-		Y_hi = Read(++reg_S);
+		Y_hi = Read(reg_S++);
 		break;
 	case 10:	//	R	Y Register Low		SP+7
-		Y_lo = Read(++reg_S);
+		Y_lo = Read(reg_S++);
 		break;
 	case 11:	//	R	User Stack High		SP+8
-		U_hi = Read(++reg_S);
+		U_hi = Read(reg_S++);
 		break;
 	case 12:	//	R	User Stack Low		SP+9
-		U_lo = Read(++reg_S);
+		U_lo = Read(reg_S++);
 		break;
 	case 13:	//	R	PC High				SP+10
-		PC_hi = Read(++reg_S);
+		PC_hi = Read(reg_S++);
 		break;
 	case 14:	//	R	PC Low				SP+11
-		PC_lo = Read(++reg_S);
+		PC_lo = Read(reg_S++);
 		break;
 	case 15:	//	R	Don't Care			$ffff
 		clocksUsed = 255;
@@ -7357,10 +6972,10 @@ uint8_t Mc6809::RTS_inh()
 		//reg_PC++;
 		break;
 	case 3:		//	R	PC High				SP
-		PC_lo = Read(++reg_S);
+		PC_hi = Read(reg_S++);
 		break;
 	case 4:		//	R	PC Low				SP+1
-		PC_hi = Read(++reg_S);
+		PC_lo = Read(reg_S++);
 		break;
 	case 5:		//	R	Don't Care			$ffff
 		clocksUsed = 255;
@@ -7390,13 +7005,10 @@ uint8_t Mc6809::SBCA_dir()
 		break;
 	case 4:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
+		ResolveCC();
 		data = reg_A - scratch_lo - ((reg_CC & CC::C) == CC::C ? 1 : 0);
-		AdjustCC_V(scratch_lo, reg_A, (data & 0xff));
+		SetCC_Sub(reg_A, scratch_lo, data);
 		reg_A = (data & 0xff);
-		AdjustCC_H(reg_A);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -7426,13 +7038,10 @@ uint8_t Mc6809::SBCA_ext()
 		break;
 	case 5:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
+		ResolveCC();
 		data = reg_A - scratch_lo - ((reg_CC & CC::C) == CC::C ? 1 : 0);
-		AdjustCC_V(scratch_lo, reg_A, (data & 0xff));
+		SetCC_Sub(reg_A, scratch_lo, data);
 		reg_A = (data & 0xff);
-		AdjustCC_H(reg_A);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -7454,13 +7063,10 @@ uint8_t Mc6809::SBCA_imm()
 		break;
 	case 2:		//	R	Data				PC+1
 		scratch_lo = Read(reg_PC++);
+		ResolveCC();
 		data = reg_A - scratch_lo - ((reg_CC & CC::C) == CC::C ? 1 : 0);
-		AdjustCC_V(scratch_lo, reg_A, (data & 0xff));
+		SetCC_Sub(reg_A, scratch_lo, data);
 		reg_A = (data & 0xff);
-		AdjustCC_H(reg_A);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -7488,13 +7094,10 @@ uint8_t Mc6809::SBCB_dir()
 		break;
 	case 4:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
+		ResolveCC();
 		data = reg_B - scratch_lo - ((reg_CC & CC::C) == CC::C ? 1 : 0);
-		AdjustCC_V(scratch_lo, reg_B, (data & 0xff));
+		SetCC_Sub(reg_B, scratch_lo, data);
 		reg_A = (data & 0xff);
-		AdjustCC_H(reg_B);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -7524,13 +7127,10 @@ uint8_t Mc6809::SBCB_ext()
 		break;
 	case 5:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
+		ResolveCC();
 		data = reg_B - scratch_lo - ((reg_CC & CC::C) == CC::C ? 1 : 0);
-		AdjustCC_V(scratch_lo, reg_B, (data & 0xff));
+		SetCC_Sub(reg_B, scratch_lo, data);
 		reg_A = (data & 0xff);
-		AdjustCC_H(reg_B);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -7552,13 +7152,10 @@ uint8_t Mc6809::SBCB_imm()
 		break;
 	case 2:		//	R	Data				PC+1
 		scratch_lo = Read(reg_PC++);
+		ResolveCC();
 		data = reg_B - scratch_lo - ((reg_CC & CC::C) == CC::C ? 1 : 0);
-		AdjustCC_V(scratch_lo, reg_B, (data & 0xff));
+		SetCC_Sub(reg_B, scratch_lo, data);
 		reg_A = (data & 0xff);
-		AdjustCC_H(reg_B);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -7579,6 +7176,7 @@ uint8_t Mc6809::SEX_inh()
 		if ((reg_B & 0x80) == 0x80)
 		{
 			reg_A = 255;
+			ResolveCC();
 			reg_CC |= CC::N;
 			reg_CC &= ~CC::Z;
 		}
@@ -8024,11 +7622,8 @@ uint8_t Mc6809::SUBA_dir()
 	case 4:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
 		data = reg_A - scratch_lo;
-		AdjustCC_V(reg_A, scratch_lo, (uint8_t)(data & 0xff));
+		SetCC_Sub(reg_A, scratch_lo, data);
 		reg_A = (uint8_t)(data & 0xff);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -8059,11 +7654,8 @@ uint8_t Mc6809::SUBA_ext()
 	case 5:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
 		data = reg_A - scratch_lo;
-		AdjustCC_V(reg_A, scratch_lo, (uint8_t)(data & 0xff));
+		SetCC_Sub(reg_A, scratch_lo, data);
 		reg_A = (uint8_t)(data & 0xff);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -8086,11 +7678,8 @@ uint8_t Mc6809::SUBA_imm()
 	case 2:		//	R	Data				PC+1
 		scratch_lo = Read(reg_PC++);
 		data = reg_A - scratch_lo;
-		AdjustCC_V(reg_A, scratch_lo, (uint8_t)(data & 0xff));
+		SetCC_Sub(reg_A, scratch_lo, data);
 		reg_A = (uint8_t)(data & 0xff);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -8119,11 +7708,8 @@ uint8_t Mc6809::SUBB_dir()
 	case 4:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
 		data = reg_B - scratch_lo;
-		AdjustCC_V(reg_B, scratch_lo, (uint8_t)(data & 0xff));
+		SetCC_Sub(reg_B, scratch_lo, data);
 		reg_B = (uint8_t)(data & 0xff);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -8154,11 +7740,8 @@ uint8_t Mc6809::SUBB_ext()
 	case 5:		//	R	Data				EA
 		scratch_lo = Read(reg_scratch);
 		data = reg_B - scratch_lo;
-		AdjustCC_V(reg_B, scratch_lo, (uint8_t)(data & 0xff));
+		SetCC_Sub(reg_B, scratch_lo, data);
 		reg_B = (uint8_t)(data & 0xff);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -8181,11 +7764,8 @@ uint8_t Mc6809::SUBB_imm()
 	case 2:		//	R	Data				PC+1
 		scratch_lo = Read(reg_PC++);
 		data = reg_B - scratch_lo;
-		AdjustCC_V(reg_B, scratch_lo, (uint8_t)(data & 0xff));
+		SetCC_Sub(reg_B, scratch_lo, data);
 		reg_B = (uint8_t)(data & 0xff);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -8199,7 +7779,6 @@ uint8_t Mc6809::SUBB_imm()
 uint8_t Mc6809::SUBD_dir()
 {
 	uint32_t data;
-	static uint16_t tempRegValue;
 
 	switch (++clocksUsed)
 	{
@@ -8216,16 +7795,13 @@ uint8_t Mc6809::SUBD_dir()
 		scratch_hi = reg_DP;
 		break;
 	case 5:		//	R	Data				EA
-		tempRegValue = Read(reg_scratch) << 8;
+		reg_operand = Read(reg_scratch) << 8;
 		break;
 	case 6:		//	R	Data Low			EA+1
-		tempRegValue |= Read(++reg_scratch);
-		data = reg_D - tempRegValue;
-		AdjustCC_V(reg_D, tempRegValue, (uint16_t)(data & 0xffff));
+		reg_operand |= Read(++reg_scratch);
+		data = reg_D - reg_operand;
+		SetCC_Sub(reg_D, (uint16_t)reg_operand, (uint32_t)(reg_D - reg_operand));
 		reg_D = (uint16_t)(data & 0xffff);
-		AdjustCC_N(reg_D);
-		AdjustCC_Z(reg_D);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -8239,7 +7815,6 @@ uint8_t Mc6809::SUBD_dir()
 uint8_t Mc6809::SUBD_ext()
 {
 	uint32_t data;
-	static uint16_t tempRegValue;
 
 	switch (++clocksUsed)
 	{
@@ -8258,16 +7833,13 @@ uint8_t Mc6809::SUBD_ext()
 	case 5:		//	R	Don't Care			$ffff
 		break;
 	case 6:		//	R	Data				EA
-		tempRegValue = Read(reg_scratch) << 8;
+		reg_operand = Read(reg_scratch) << 8;
 		break;
 	case 7:		//	R	Data Low			EA+1
-		tempRegValue |= Read(++reg_scratch);
-		data = reg_D - tempRegValue;
-		AdjustCC_V(reg_D, tempRegValue, (uint16_t)(data & 0xffff));
+		reg_operand |= Read(++reg_scratch);
+		data = reg_D - reg_operand;
+		SetCC_Sub(reg_D, (uint16_t)reg_operand, (uint32_t)(reg_D - reg_operand));
 		reg_D = (uint16_t)(data & 0xffff);
-		AdjustCC_N(reg_D);
-		AdjustCC_Z(reg_D);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -8281,7 +7853,6 @@ uint8_t Mc6809::SUBD_ext()
 uint8_t Mc6809::SUBD_imm()
 {
 	uint32_t data;
-	static uint16_t tempRegValue;
 
 	switch (++clocksUsed)
 	{
@@ -8292,15 +7863,12 @@ uint8_t Mc6809::SUBD_imm()
 		reg_PC++;
 		break;
 	case 3:		//	R	Data High			PC+2
-		tempRegValue = Read(reg_PC++) << 8;
+		reg_operand = Read(reg_PC++) << 8;
 	case 4:		//	R	Data Low			PC+3
-		tempRegValue = Read(reg_PC++);
-		data = reg_D - tempRegValue;
-		AdjustCC_V(reg_D, tempRegValue, (uint16_t)(data & 0xffff));
+		reg_operand = Read(reg_PC++);
+		data = reg_D - reg_operand;
+		SetCC_Sub(reg_D, (uint16_t)reg_operand, (uint32_t)(reg_D - reg_operand));
 		reg_D = (uint16_t)(data & 0xffff);
-		AdjustCC_N(reg_D);
-		AdjustCC_Z(reg_D);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	}
@@ -8322,43 +7890,44 @@ uint8_t Mc6809::SWI_inh()
 		//reg_PC++;
 		break;
 	case 3:		//	R	Don't care			$ffff
+		ResolveCC();
 		reg_CC |= CC::E;
 		break;
 	case 4:		// W	PC Low				SP-1	--SP
-		Write(reg_S--, PC_lo);
+		Write(--reg_S, PC_lo);
 		break;
 	case 5:		// W	PC High				SP-2	--SP
-		Write(reg_S--, PC_hi);
+		Write(--reg_S, PC_hi);
 		break;
 	case 6:		// W	User Stack Low		SP-3	--SP
-		Write(reg_S--, U_lo);
+		Write(--reg_S, U_lo);
 		break;
 	case 7:		// W	User Stack High		SP-4	--SP
-		Write(reg_S--, U_hi);
+		Write(--reg_S, U_hi);
 		break;
 	case 8:		// W	Y  Register Low		SP-5	--SP
-		Write(reg_S--, Y_lo);
+		Write(--reg_S, Y_lo);
 		break;
 	case 9:		// W	Y  Register High	SP-6	--SP
-		Write(reg_S--, Y_hi);
+		Write(--reg_S, Y_hi);
 		break;
 	case 10:	// W	X  Register Low		SP-7	--SP
-		Write(reg_S--, X_lo);
+		Write(--reg_S, X_lo);
 		break;
 	case 11:	// W	X  Register High	SP-8	--SP
-		Write(reg_S--, X_hi);
+		Write(--reg_S, X_hi);
 		break;
 	case 12:	// W	DP Register			SP-9	--SP
-		Write(reg_S--, reg_DP);
+		Write(--reg_S, reg_DP);
 		break;
 	case 13:	// W	B  Register			SP-10	--SP
-		Write(reg_S--, reg_B);
+		Write(--reg_S, reg_B);
 		break;
 	case 14:	// W	A  Register			SP-11	--SP
-		Write(reg_S--, reg_A);
+		Write(--reg_S, reg_A);
 		break;
 	case 15:	// W	CC Register			SP-12	--SP
-		Write(reg_S--, reg_CC);
+		Write(--reg_S, reg_CC);
 		break;
 	case 16:	//	R	Don't Care			$ffff
 		reg_CC |= (CC::I | CC::F);
@@ -8394,43 +7963,44 @@ uint8_t Mc6809::SWI2_inh()
 		reg_PC++;
 		break;
 	case 4:		//	R	Don't care			$ffff
+		ResolveCC();
 		reg_CC |= CC::E;
 		break;
 	case 5:		// W	PC Low				SP-1	--SP
-		Write(reg_S--, PC_lo);
+		Write(--reg_S, PC_lo);
 		break;
 	case 6:		// W	PC High				SP-2	--SP
-		Write(reg_S--, PC_hi);
+		Write(--reg_S, PC_hi);
 		break;
 	case 7:		// W	User Stack Low		SP-3	--SP
-		Write(reg_S--, U_lo);
+		Write(--reg_S, U_lo);
 		break;
 	case 8:		// W	User Stack High		SP-4	--SP
-		Write(reg_S--, U_hi);
+		Write(--reg_S, U_hi);
 		break;
 	case 9:		// W	Y  Register Low		SP-5	--SP
-		Write(reg_S--, Y_lo);
+		Write(--reg_S, Y_lo);
 		break;
 	case 10:	// W	Y  Register High	SP-6	--SP
-		Write(reg_S--, Y_hi);
+		Write(--reg_S, Y_hi);
 		break;
 	case 11:	// W	X  Register Low		SP-7	--SP
-		Write(reg_S--, X_lo);
+		Write(--reg_S, X_lo);
 		break;
 	case 12:	// W	X  Register High	SP-8	--SP
-		Write(reg_S--, X_hi);
+		Write(--reg_S, X_hi);
 		break;
 	case 13:	// W	DP Register			SP-9	--SP
-		Write(reg_S--, reg_DP);
+		Write(--reg_S, reg_DP);
 		break;
 	case 14:	// W	B  Register			SP-10	--SP
-		Write(reg_S--, reg_B);
+		Write(--reg_S, reg_B);
 		break;
 	case 15:	// W	A  Register			SP-11	--SP
-		Write(reg_S--, reg_A);
+		Write(--reg_S, reg_A);
 		break;
 	case 16:	// W	CC Register			SP-12	--SP
-		Write(reg_S--, reg_CC);
+		Write(--reg_S, reg_CC);
 		break;
 	case 17:	//	R	Don't Care			$ffff
 		break;
@@ -8465,43 +8035,44 @@ uint8_t Mc6809::SWI3_inh()
 		reg_PC++;
 		break;
 	case 4:		//	R	Don't care			$ffff
+		ResolveCC();
 		reg_CC |= CC::E;
 		break;
 	case 5:		// W	PC Low				SP-1	--SP
-		Write(reg_S--, PC_lo);
+		Write(--reg_S, PC_lo);
 		break;
 	case 6:		// W	PC High				SP-2	--SP
-		Write(reg_S--, PC_hi);
+		Write(--reg_S, PC_hi);
 		break;
 	case 7:		// W	User Stack Low		SP-3	--SP
-		Write(reg_S--, U_lo);
+		Write(--reg_S, U_lo);
 		break;
 	case 8:		// W	User Stack High		SP-4	--SP
-		Write(reg_S--, U_hi);
+		Write(--reg_S, U_hi);
 		break;
 	case 9:		// W	Y  Register Low		SP-5	--SP
-		Write(reg_S--, Y_lo);
+		Write(--reg_S, Y_lo);
 		break;
 	case 10:	// W	Y  Register High	SP-6	--SP
-		Write(reg_S--, Y_hi);
+		Write(--reg_S, Y_hi);
 		break;
 	case 11:	// W	X  Register Low		SP-7	--SP
-		Write(reg_S--, X_lo);
+		Write(--reg_S, X_lo);
 		break;
 	case 12:	// W	X  Register High	SP-8	--SP
-		Write(reg_S--, X_hi);
+		Write(--reg_S, X_hi);
 		break;
 	case 13:	// W	DP Register			SP-9	--SP
-		Write(reg_S--, reg_DP);
+		Write(--reg_S, reg_DP);
 		break;
 	case 14:	// W	B  Register			SP-10	--SP
-		Write(reg_S--, reg_B);
+		Write(--reg_S, reg_B);
 		break;
 	case 15:	// W	A  Register			SP-11	--SP
-		Write(reg_S--, reg_A);
+		Write(--reg_S, reg_A);
 		break;
 	case 16:	// W	CC Register			SP-12	--SP
-		Write(reg_S--, reg_CC);
+		Write(--reg_S, reg_CC);
 		break;
 	case 17:	//	R	Don't Care			$ffff
 		break;
@@ -8524,7 +8095,8 @@ uint8_t Mc6809::SWI3_inh()
 //*****************************************************************************
 uint8_t Mc6809::SYNC_inh()
 {
-	static int8_t intCount = 0;
+
+	uint8_t pending = Pending() & (LINE::NMI | LINE::FIRQ | LINE::IRQ);
 
 	switch (++clocksUsed)
 	{
@@ -8535,44 +8107,44 @@ uint8_t Mc6809::SYNC_inh()
 		//reg_PC++;
 		break;
 	case 3:		//	R	Don't Care			Z
-		if ((reg_CC & CC::I) || (reg_CC & CC::F))
-			clocksUsed = 255;
-		else if (!Nmi || !Firq || !Irq)
+		// waits for any interrupt line, masked or not
+		if (pending == 0)
+		{
 			--clocksUsed;
+			waitState = true;
+		}
 		break;
 	case 4:		//	R	Don't Care			Z
-		if (Nmi || Firq || Irq)
+		// a line held 3 cycles and let through by CC is taken, a masked one
+		// (or one dropped early) just carries on with the next instruction
+		if ((pending != 0) && (++syncCount < 3))
 		{
-			++intCount;
-			if (intCount >= 3)
-			{
-				if (Nmi)
-				{
-					clocksUsed = 1;
-					intCount = 0;
-					exec = &Mc6809::NMI;
-				}
-				else if (Firq)
-				{
-					clocksUsed = 1;
-					intCount = 0;
-					exec = &Mc6809::FIRQ;
-				}
-				else if (Irq)
-				{
-					clocksUsed = 1;
-					intCount = 0;
-					exec = &Mc6809::IRQ;
-				}
-			}
+			--clocksUsed;
+			break;
 		}
-		else if (intCount < 3)
+		syncCount = 0;
+		pending = Unmasked() & pending;
+		// handing over to an interrupt sequence parks for this cycle, so
+		// Resume() or a threaded dispatch returns and the next call runs the
+		// new exec
+		waitState = (pending != 0);
+		if (pending & LINE::NMI)
 		{
-			intCount = 0;
-			clocksUsed = 255;
+			clocksUsed = 1;
+			exec = &Mc6809::NMI;
+		}
+		else if (pending & LINE::FIRQ)
+		{
+			clocksUsed = 1;
+			exec = &Mc6809::FIRQ;
+		}
+		else if (pending & LINE::IRQ)
+		{
+			clocksUsed = 1;
+			exec = &Mc6809::IRQ;
 		}
 		else
-			--clocksUsed;
+			clocksUsed = 255;
 		break;
 	}
 	return(clocksUsed);
@@ -8596,6 +8168,7 @@ uint8_t Mc6809::TFR_imm()
 	case 3:		//	R	Don't Care			$ffff
 		scratch_hi = (scratch_lo & 0xf0) >> 4;
 		scratch_lo &= 0x0f;
+		ResolveCC();		// CC may be read or written below
 		break;
 	case 4:		//	R	Don't Care			$ffff
 		switch (scratch_hi)
@@ -8632,13 +8205,13 @@ uint8_t Mc6809::TFR_imm()
 			switch (scratch_lo)
 			{
 			case REG::A:
-				reg_DP = reg_A;
+				reg_A = reg_DP;
 				break;
 			case REG::B:
-				reg_DP = reg_B;
+				reg_B = reg_DP;
 				break;
 			case REG::CC:
-				reg_DP = reg_CC;
+				reg_CC = reg_DP;
 				break;
 			}
 			break;
@@ -8646,13 +8219,13 @@ uint8_t Mc6809::TFR_imm()
 			switch (scratch_lo)
 			{
 			case REG::A:
-				reg_CC = reg_A;
+				reg_A = reg_CC;
 				break;
 			case REG::B:
-				reg_CC = reg_B;
+				reg_B = reg_CC;
 				break;
 			case REG::DP:
-				reg_CC = reg_DP;
+				reg_DP = reg_CC;
 				break;
 			}
 			break;
@@ -8805,9 +8378,7 @@ uint8_t Mc6809::TSTA_inh()
 		reg_PC++;
 		break;
 	case 2:		//	R	Don't Care			PC+1
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_A);
 		//reg_PC++;
 		clocksUsed = 255;
 		break;
@@ -8827,9 +8398,7 @@ uint8_t Mc6809::TSTB_inh()
 		reg_PC++;
 		break;
 	case 2:		//	R	Don't Care			PC+1
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_B);
 		//reg_PC++;
 		clocksUsed = 255;
 		break;
@@ -8858,9 +8427,7 @@ uint8_t Mc6809::TST_dir()
 		scratch_lo = Read(reg_scratch);
 		break;
 	case 5:		//	R	Don't Care			$ffff
-		AdjustCC_N(scratch_lo);
-		AdjustCC_Z(scratch_lo);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(scratch_lo);
 		break;
 	case 6:		//	R	Don't Care			$ffff
 		clocksUsed = 255;
@@ -8892,9 +8459,7 @@ uint8_t Mc6809::TST_ext()
 		scratch_lo = Read(reg_scratch);
 		break;
 	case 6:		//	R	Don't Care			$ffff
-		AdjustCC_N(scratch_lo);
-		AdjustCC_Z(scratch_lo);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(scratch_lo);
 		break;
 	case 7:		//	R	Don't Care			$ffff
 		clocksUsed = 255;
@@ -8949,44 +8514,45 @@ uint8_t Mc6809::RESET_inh()
 		//reg_PC++;
 		break;
 	case 3:		//	R	Don't care			$ffff
+		ResolveCC();
 		// apparently does not set the E flag, this will throw a RTI from this off.
 		//reg_CC |= CC::E;
 		break;
 	case 4:		// W	PC Low				SP-1	--SP
-		Write(reg_S--, PC_lo);
+		Write(--reg_S, PC_lo);
 		break;
 	case 5:		// W	PC High				SP-2	--SP
-		Write(reg_S--, PC_hi);
+		Write(--reg_S, PC_hi);
 		break;
 	case 6:		// W	User Stack Low		SP-3	--SP
-		Write(reg_S--, U_lo);
+		Write(--reg_S, U_lo);
 		break;
 	case 7:		// W	User Stack High		SP-4	--SP
-		Write(reg_S--, U_hi);
+		Write(--reg_S, U_hi);
 		break;
 	case 8:		// W	Y  Register Low		SP-5	--SP
-		Write(reg_S--, Y_lo);
+		Write(--reg_S, Y_lo);
 		break;
 	case 9:		// W	Y  Register High	SP-6	--SP
-		Write(reg_S--, Y_hi);
+		Write(--reg_S, Y_hi);
 		break;
 	case 10:	// W	X  Register Low		SP-7	--SP
-		Write(reg_S--, X_lo);
+		Write(--reg_S, X_lo);
 		break;
 	case 11:	// W	X  Register High	SP-8	--SP
-		Write(reg_S--, X_hi);
+		Write(--reg_S, X_hi);
 		break;
 	case 12:	// W	DP Register			SP-9	--SP
-		Write(reg_S--, reg_DP);
+		Write(--reg_S, reg_DP);
 		break;
 	case 13:	// W	B  Register			SP-10	--SP
-		Write(reg_S--, reg_B);
+		Write(--reg_S, reg_B);
 		break;
 	case 14:	// W	A  Register			SP-11	--SP
-		Write(reg_S--, reg_A);
+		Write(--reg_S, reg_A);
 		break;
 	case 15:	// W	CC Register			SP-12	--SP
-		Write(reg_S--, reg_CC);
+		Write(--reg_S, reg_CC);
 		break;
 	case 16:	//	R	Don't Care			$ffff
 		reg_CC |= (CC::I | CC::F);
@@ -9015,8 +8581,6 @@ uint8_t Mc6809::RESET_inh()
 //*****************************************************************************
 uint8_t Mc6809::ADCA_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint16_t data;
 
 	switch (++clocksUsed)
@@ -9030,21 +8594,14 @@ uint8_t Mc6809::ADCA_idx()
 		break;
 	case 10:
 		scratch_lo = Read(reg_scratch);
+		ResolveCC();
 		data = reg_A + scratch_lo + ((reg_CC & CC::C) == CC::C ? 1 : 0);
-		AdjustCC_V(scratch_lo, reg_A, (data & 0xff));
+		SetCC_Add(reg_A, scratch_lo, data);
 		reg_A = (data & 0xff);
-		AdjustCC_H(reg_A);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9056,8 +8613,6 @@ uint8_t Mc6809::ADCA_idx()
 //*****************************************************************************
 uint8_t Mc6809::ADCB_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint16_t data;
 
 	switch (++clocksUsed)
@@ -9071,21 +8626,14 @@ uint8_t Mc6809::ADCB_idx()
 		break;
 	case 10:
 		scratch_lo = Read(reg_scratch);
+		ResolveCC();
 		data = reg_B + scratch_lo + ((reg_CC & CC::C) == CC::C ? 1 : 0);
-		AdjustCC_V(scratch_lo, reg_B, (data & 0xff));
+		SetCC_Add(reg_B, scratch_lo, data);
 		reg_B = (data & 0xff);
-		AdjustCC_H(reg_B);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9097,8 +8645,6 @@ uint8_t Mc6809::ADCB_idx()
 //*****************************************************************************
 uint8_t Mc6809::ADDA_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint16_t data;
 
 	switch (++clocksUsed)
@@ -9113,20 +8659,12 @@ uint8_t Mc6809::ADDA_idx()
 	case 10:
 		scratch_lo = Read(reg_scratch);
 		data = reg_A + scratch_lo;
-		AdjustCC_V(scratch_lo, reg_A, (data & 0xff));
+		SetCC_Add(reg_A, scratch_lo, data);
 		reg_A = (data & 0xff);
-		AdjustCC_H(reg_A);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9138,8 +8676,6 @@ uint8_t Mc6809::ADDA_idx()
 //*****************************************************************************
 uint8_t Mc6809::ADDB_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint16_t data;
 
 	switch (++clocksUsed)
@@ -9154,20 +8690,12 @@ uint8_t Mc6809::ADDB_idx()
 	case 10:
 		scratch_lo = Read(reg_scratch);
 		data = reg_B + scratch_lo;
-		AdjustCC_V(scratch_lo, reg_B, (data & 0xff));
+		SetCC_Add(reg_B, scratch_lo, data);
 		reg_B = (data & 0xff);
-		AdjustCC_H(reg_B);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9179,10 +8707,7 @@ uint8_t Mc6809::ADDB_idx()
 //*****************************************************************************
 uint8_t Mc6809::ADDD_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint32_t data;
-	static uint16_t address;
 
 	switch (++clocksUsed)
 	{
@@ -9194,28 +8719,20 @@ uint8_t Mc6809::ADDD_idx()
 		clocksUsed = 100;
 		break;
 	case 10:		//	R	Data High			$ffff
-		address = reg_scratch;
-		scratch_hi = Read(address);
+		reg_operand = reg_scratch;
+		scratch_hi = Read(reg_operand);
 		break;
 	case 11:		//	R	Data Low			EA+1
-		scratch_lo = Read(++address);
+		scratch_lo = Read(++reg_operand);
 		break;
 	case 12:		//	R	Don't Care			$ffff
 		data = reg_D + reg_scratch;
-		AdjustCC_V(reg_scratch, reg_D, (data & 0xffff));
+		SetCC_Add(reg_D, reg_scratch, data);
 		reg_D = data & 0xffff;
-		AdjustCC_H(reg_B);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9227,8 +8744,6 @@ uint8_t Mc6809::ADDD_idx()
 //*****************************************************************************
 uint8_t Mc6809::ANDA_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -9242,17 +8757,11 @@ uint8_t Mc6809::ANDA_idx()
 	case 10:
 		scratch_lo = Read(reg_scratch);
 		reg_A &= scratch_lo;
-		reg_CC &= ~CC::V;
-		AdjustCC_Z(reg_A);
-		AdjustCC_N(reg_A);
+		SetCC_NZ0(reg_A);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9264,8 +8773,6 @@ uint8_t Mc6809::ANDA_idx()
 //*****************************************************************************
 uint8_t Mc6809::ANDB_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -9279,17 +8786,11 @@ uint8_t Mc6809::ANDB_idx()
 	case 10:
 		scratch_lo = Read(reg_scratch);
 		reg_B &= scratch_lo;
-		reg_CC &= ~CC::V;
-		AdjustCC_Z(reg_B);
-		AdjustCC_N(reg_B);
+		SetCC_NZ0(reg_B);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9302,8 +8803,6 @@ uint8_t Mc6809::ANDB_idx()
 //*****************************************************************************
 uint8_t Mc6809::ASL_LSL_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint8_t data_lo = 0;
 
 	switch (++clocksUsed)
@@ -9322,19 +8821,14 @@ uint8_t Mc6809::ASL_LSL_idx()
 		AdjustCC_C((uint16_t)(data_lo << 1));
 		AdjustCC_V(data_lo);
 		data_lo = (data_lo << 1) & 0xfe;
-		AdjustCC_Z(data_lo);
-		AdjustCC_N(data_lo);
+		SetCC_NZ(data_lo);
 		break;
 	case 12:		//	W	Data				EA
 		Write(reg_scratch, data_lo);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9346,8 +8840,6 @@ uint8_t Mc6809::ASL_LSL_idx()
 //*****************************************************************************
 uint8_t Mc6809::ASR_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint8_t data_lo = 0;
 
 	switch (++clocksUsed)
@@ -9364,21 +8856,17 @@ uint8_t Mc6809::ASR_idx()
 		break;
 	case 11:		//	R	Don't care			$ffff
 		data_lo = data_lo & 0x80;
+		ResolveCC();
 		reg_CC = ((data_lo & 0x01) == 1) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
 		reg_A = ((data_lo >> 1) & 0x7f) | scratch_lo;
-		AdjustCC_Z(data_lo);
-		AdjustCC_N(data_lo);
+		SetCC_NZ(data_lo);
 		break;
 	case 12:		//	W	Data				EA
 		Write(reg_scratch, data_lo);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9390,8 +8878,6 @@ uint8_t Mc6809::ASR_idx()
 //*****************************************************************************
 uint8_t Mc6809::BITA_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -9405,17 +8891,11 @@ uint8_t Mc6809::BITA_idx()
 	case 10:
 		scratch_lo = Read(reg_scratch);
 		reg_A &= scratch_lo;
-		reg_CC &= ~CC::V;
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
+		SetCC_NZ0(reg_A);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9427,8 +8907,6 @@ uint8_t Mc6809::BITA_idx()
 //*****************************************************************************
 uint8_t Mc6809::BITB_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -9442,17 +8920,11 @@ uint8_t Mc6809::BITB_idx()
 	case 10:
 		scratch_lo = Read(reg_scratch);
 		reg_B &= scratch_lo;
-		reg_CC &= ~CC::V;
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
+		SetCC_NZ0(reg_B);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9464,8 +8936,6 @@ uint8_t Mc6809::BITB_idx()
 //*****************************************************************************
 uint8_t Mc6809::CLR_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -9480,18 +8950,15 @@ uint8_t Mc6809::CLR_idx()
 		Read(reg_scratch);
 		break;
 	case 11:		//	R	Don't Care			$ffff
-		reg_CC = (reg_CC & CC::H) | CC::Z;
+		ResolveCC();
+		reg_CC = (reg_CC & ~(CC::N | CC::V | CC::C)) | CC::Z;
 		break;
 	case 12:		// W	Data				EA
 		Write(reg_scratch, 0);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9503,8 +8970,6 @@ uint8_t Mc6809::CLR_idx()
 //*****************************************************************************
 uint8_t Mc6809::CMPA_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint8_t data;
 
 	switch (++clocksUsed)
@@ -9519,18 +8984,11 @@ uint8_t Mc6809::CMPA_idx()
 	case 10:
 		data = Read(reg_scratch);
 		reg_scratch = reg_A - data;
-		AdjustCC_N(scratch_lo);
-		AdjustCC_Z(scratch_lo);
-		AdjustCC_V(reg_A, data, scratch_lo);
-		AdjustCC_C(reg_scratch);
+		SetCC_Sub(reg_A, data, reg_scratch);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9542,8 +9000,6 @@ uint8_t Mc6809::CMPA_idx()
 //*****************************************************************************
 uint8_t Mc6809::CMPB_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint8_t data;
 
 	switch (++clocksUsed)
@@ -9558,18 +9014,11 @@ uint8_t Mc6809::CMPB_idx()
 	case 10:
 		data = Read(reg_scratch);
 		reg_scratch = reg_B - data;
-		AdjustCC_N(scratch_lo);
-		AdjustCC_Z(scratch_lo);
-		AdjustCC_V(reg_B, data, scratch_lo);
-		AdjustCC_C(reg_scratch);
+		SetCC_Sub(reg_B, data, reg_scratch);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9581,8 +9030,6 @@ uint8_t Mc6809::CMPB_idx()
 //*****************************************************************************
 uint8_t Mc6809::CMPD_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint16_t data = 0;
 	uint32_t tempRegValue;
 
@@ -9606,18 +9053,11 @@ uint8_t Mc6809::CMPD_idx()
 		break;
 	case 12:		//	R	Don't Care			$ffff
 		tempRegValue = reg_D - data;
-		AdjustCC_N((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_Z((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_V(reg_D, data, (uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_C(tempRegValue);
+		SetCC_Sub(reg_D, data, tempRegValue);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9629,8 +9069,6 @@ uint8_t Mc6809::CMPD_idx()
 //*****************************************************************************
 uint8_t Mc6809::CMPS_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint16_t data = 0;
 	uint32_t tempRegValue;
 
@@ -9654,18 +9092,11 @@ uint8_t Mc6809::CMPS_idx()
 		break;
 	case 12:		//	R	Don't Care			$ffff
 		tempRegValue = reg_S - data;
-		AdjustCC_N((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_Z((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_V(reg_S, data, (uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_C(tempRegValue);
+		SetCC_Sub(reg_S, data, tempRegValue);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9677,8 +9108,6 @@ uint8_t Mc6809::CMPS_idx()
 //*****************************************************************************
 uint8_t Mc6809::CMPU_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint16_t data = 0;
 	uint32_t tempRegValue;
 
@@ -9702,18 +9131,11 @@ uint8_t Mc6809::CMPU_idx()
 		break;
 	case 12:		//	R	Don't Care			$ffff
 		tempRegValue = reg_U - data;
-		AdjustCC_N((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_Z((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_V(reg_U, data, (uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_C(tempRegValue);
+		SetCC_Sub(reg_U, data, tempRegValue);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9725,8 +9147,6 @@ uint8_t Mc6809::CMPU_idx()
 //*****************************************************************************
 uint8_t Mc6809::CMPX_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint16_t data = 0;
 	uint32_t tempRegValue;
 
@@ -9747,18 +9167,11 @@ uint8_t Mc6809::CMPX_idx()
 		break;
 	case 12:		//	R	Don't Care			$ffff
 		tempRegValue = reg_X - data;
-		AdjustCC_N((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_Z((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_V(reg_X, data, (uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_C(tempRegValue);
+		SetCC_Sub(reg_X, data, tempRegValue);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9770,8 +9183,6 @@ uint8_t Mc6809::CMPX_idx()
 //*****************************************************************************
 uint8_t Mc6809::CMPY_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint16_t data = 0;
 	uint32_t tempRegValue;
 
@@ -9795,18 +9206,11 @@ uint8_t Mc6809::CMPY_idx()
 		break;
 	case 12:		//	R	Don't Care			$ffff
 		tempRegValue = reg_Y - data;
-		AdjustCC_N((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_Z((uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_V(reg_Y, data, (uint16_t)(tempRegValue & 0xffff));
-		AdjustCC_C(tempRegValue);
+		SetCC_Sub(reg_Y, data, tempRegValue);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9818,8 +9222,6 @@ uint8_t Mc6809::CMPY_idx()
 //*****************************************************************************
 uint8_t Mc6809::COM_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint8_t data_lo = 0;
 
 	switch (++clocksUsed)
@@ -9836,9 +9238,7 @@ uint8_t Mc6809::COM_idx()
 		break;
 	case 11:		//	R	Don't Care			$ffff
 		data_lo ^= 0xff;
-		AdjustCC_N(data_lo);
-		AdjustCC_Z(data_lo);
-		reg_CC &= ~(CC::V);
+		SetCC_NZ0(data_lo);
 		reg_CC |= (CC::C);
 		break;
 	case 12:		// W  Data			EA
@@ -9846,11 +9246,7 @@ uint8_t Mc6809::COM_idx()
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9862,8 +9258,6 @@ uint8_t Mc6809::COM_idx()
 //*****************************************************************************
 uint8_t Mc6809::DEC_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint8_t data_lo = 0;
 
 	switch (++clocksUsed)
@@ -9879,21 +9273,17 @@ uint8_t Mc6809::DEC_idx()
 		data_lo = Read(reg_scratch);
 		break;
 	case 11:		//	R	Don't Care			$ffff
+		ResolveCC();
 		reg_CC = ((data_lo & 0x80) == 0x80) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
 		--data_lo;
-		AdjustCC_N(data_lo);
-		AdjustCC_Z(data_lo);
+		SetCC_NZ(data_lo);
 		break;
 	case 12:		//	W	Data				EA
 		Write(reg_scratch, data_lo);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9905,8 +9295,6 @@ uint8_t Mc6809::DEC_idx()
 //*****************************************************************************
 uint8_t Mc6809::EORA_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -9919,17 +9307,11 @@ uint8_t Mc6809::EORA_idx()
 		break;
 	case 10:
 		reg_A ^= Read(reg_scratch);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_A);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9941,8 +9323,6 @@ uint8_t Mc6809::EORA_idx()
 //*****************************************************************************
 uint8_t Mc6809::EORB_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -9955,17 +9335,11 @@ uint8_t Mc6809::EORB_idx()
 		break;
 	case 10:
 		reg_B ^= Read(reg_scratch);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_B);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -9977,8 +9351,6 @@ uint8_t Mc6809::EORB_idx()
 //*****************************************************************************
 uint8_t Mc6809::INC_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint8_t data_lo = 0;
 
 	switch (++clocksUsed)
@@ -9994,21 +9366,17 @@ uint8_t Mc6809::INC_idx()
 		data_lo = Read(reg_scratch);
 		break;
 	case 11:		//	R	Don't Care			$ffff
+		ResolveCC();
 		reg_CC = ((data_lo & 0x7f) == 0x7f) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
 		++data_lo;
-		AdjustCC_N(data_lo);
-		AdjustCC_Z(data_lo);
+		SetCC_NZ(data_lo);
 		break;
 	case 12:		// W	Data				EA
 		Write(reg_scratch, data_lo);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10020,8 +9388,6 @@ uint8_t Mc6809::INC_idx()
 //*****************************************************************************
 uint8_t Mc6809::JMP_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -10033,13 +9399,12 @@ uint8_t Mc6809::JMP_idx()
 		clocksUsed = 100;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
-		if(clocksUsed == 10)
+		clocksUsed = Indexed(postByte, clocksUsed);
+		if (clocksUsed == 9)
+		{
 			reg_PC = reg_scratch;
+			clocksUsed = 255;
+		}
 		break;
 	}
 	return(clocksUsed);
@@ -10051,8 +9416,6 @@ uint8_t Mc6809::JMP_idx()
 //*****************************************************************************
 uint8_t Mc6809::JSR_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -10068,19 +9431,15 @@ uint8_t Mc6809::JSR_idx()
 	case 11:		//	R	Don't Care			$ffff
 		break;
 	case 12:		// W	PC High				SP-1
-		Write(reg_S--,PC_hi);
+		Write(--reg_S,PC_hi);
 		break;
 	case 13:		//	W	PC Low				SP-2
-		Write(reg_S--, PC_lo);
+		Write(--reg_S, PC_lo);
 		clocksUsed = 255;
 		reg_PC = reg_scratch;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10092,8 +9451,6 @@ uint8_t Mc6809::JSR_idx()
 //*****************************************************************************
 uint8_t Mc6809::LDA_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -10106,17 +9463,11 @@ uint8_t Mc6809::LDA_idx()
 		break;
 	case 10:
 		reg_A = Read(reg_scratch);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_A);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10128,8 +9479,6 @@ uint8_t Mc6809::LDA_idx()
 //*****************************************************************************
 uint8_t Mc6809::LDB_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -10142,17 +9491,11 @@ uint8_t Mc6809::LDB_idx()
 		break;
 	case 10:
 		reg_B = Read(reg_scratch);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_B);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10164,8 +9507,6 @@ uint8_t Mc6809::LDB_idx()
 //*****************************************************************************
 uint8_t Mc6809::LDD_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -10181,17 +9522,11 @@ uint8_t Mc6809::LDD_idx()
 		break;
 	case 11:		//	R	Register Low		EA+1
 		reg_B = Read(reg_scratch);
-		AdjustCC_N(reg_D);
-		AdjustCC_Z(reg_D);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_D);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10203,8 +9538,6 @@ uint8_t Mc6809::LDD_idx()
 //*****************************************************************************
 uint8_t Mc6809::LDS_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -10223,17 +9556,11 @@ uint8_t Mc6809::LDS_idx()
 		break;
 	case 11:		//	R	Register Low		EA+1
 		S_lo = Read(reg_scratch);
-		AdjustCC_N(reg_S);
-		AdjustCC_Z(reg_S);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_S);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10245,8 +9572,6 @@ uint8_t Mc6809::LDS_idx()
 //*****************************************************************************
 uint8_t Mc6809::LDU_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -10262,17 +9587,11 @@ uint8_t Mc6809::LDU_idx()
 		break;
 	case 11:		//	R	Register Low		EA+1
 		U_lo = Read(reg_scratch);
-		AdjustCC_N(reg_U);
-		AdjustCC_Z(reg_U);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_U);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10284,8 +9603,6 @@ uint8_t Mc6809::LDU_idx()
 //*****************************************************************************
 uint8_t Mc6809::LDX_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -10301,17 +9618,11 @@ uint8_t Mc6809::LDX_idx()
 		break;
 	case 11:		//	R	Register Low		EA+1
 		X_lo = Read(reg_scratch);
-		AdjustCC_N(reg_X);
-		AdjustCC_Z(reg_X);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_X);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10323,8 +9634,6 @@ uint8_t Mc6809::LDX_idx()
 //*****************************************************************************
 uint8_t Mc6809::LDY_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -10343,17 +9652,11 @@ uint8_t Mc6809::LDY_idx()
 		break;
 	case 11:		//	R	Register Low		EA+1
 		Y_lo = Read(reg_scratch);
-		AdjustCC_N(reg_Y);
-		AdjustCC_Z(reg_Y);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_Y);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10365,8 +9668,6 @@ uint8_t Mc6809::LDY_idx()
 //*****************************************************************************
 uint8_t Mc6809::LEAS_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -10383,11 +9684,7 @@ uint8_t Mc6809::LEAS_idx()
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10399,8 +9696,6 @@ uint8_t Mc6809::LEAS_idx()
 //*****************************************************************************
 uint8_t Mc6809::LEAU_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -10417,11 +9712,7 @@ uint8_t Mc6809::LEAU_idx()
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10433,8 +9724,6 @@ uint8_t Mc6809::LEAU_idx()
 //*****************************************************************************
 uint8_t Mc6809::LEAX_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -10454,11 +9743,7 @@ uint8_t Mc6809::LEAX_idx()
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10470,8 +9755,6 @@ uint8_t Mc6809::LEAX_idx()
 //*****************************************************************************
 uint8_t Mc6809::LEAY_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -10491,11 +9774,7 @@ uint8_t Mc6809::LEAY_idx()
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10507,8 +9786,6 @@ uint8_t Mc6809::LEAY_idx()
 //*****************************************************************************
 uint8_t Mc6809::LSR_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint8_t data_lo = 0;
 
 	switch (++clocksUsed)
@@ -10524,21 +9801,17 @@ uint8_t Mc6809::LSR_idx()
 		data_lo = Read(reg_scratch);
 		break;
 	case 11:		//	R	Don't Care			$ffff
+		ResolveCC();
 		reg_CC = ((data_lo & 0x01) == 1) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
 		data_lo = ((data_lo >> 1) & 0x7f);
-		AdjustCC_Z(data_lo);
-		reg_CC &= ~CC::N;
+		SetCC_NZ(data_lo);
 		break;
 	case 12:		//	W	Data				EA
 		Write(reg_scratch, data_lo);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10550,8 +9823,6 @@ uint8_t Mc6809::LSR_idx()
 //*****************************************************************************
 uint8_t Mc6809::NEG_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint8_t data_lo = 0;
 
 	switch (++clocksUsed)
@@ -10567,22 +9838,18 @@ uint8_t Mc6809::NEG_idx()
 		data_lo = Read(reg_scratch);
 		break;
 	case 11:		//	R	Don't Care			$ffff
+		ResolveCC();
 		reg_CC = (data_lo == 0x80) ? (reg_CC | CC::V) : (reg_CC & ~CC::V);
 		reg_CC = (data_lo != 0) ? (reg_CC & ~CC::C) : (reg_CC | CC::C);
 		data_lo = 0 - data_lo;
-		AdjustCC_N(data_lo);
-		AdjustCC_Z(data_lo);
+		SetCC_NZ(data_lo);
 		break;
 	case 12:		//	W	Data				EA
 		Write(reg_scratch, data_lo);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10594,8 +9861,6 @@ uint8_t Mc6809::NEG_idx()
 //*****************************************************************************
 uint8_t Mc6809::ORA_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -10609,17 +9874,11 @@ uint8_t Mc6809::ORA_idx()
 	case 10:
 		scratch_lo = Read(reg_scratch);
 		reg_A |= scratch_lo;
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_A);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10631,8 +9890,6 @@ uint8_t Mc6809::ORA_idx()
 //*****************************************************************************
 uint8_t Mc6809::ORB_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -10646,17 +9903,11 @@ uint8_t Mc6809::ORB_idx()
 	case 10:
 		scratch_lo = Read(reg_scratch);
 		reg_B |= scratch_lo;
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(reg_B);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10668,8 +9919,6 @@ uint8_t Mc6809::ORB_idx()
 //*****************************************************************************
 uint8_t Mc6809::ROL_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint8_t data_lo = 0;
 	uint8_t carry = 0;
 
@@ -10686,12 +9935,12 @@ uint8_t Mc6809::ROL_idx()
 		data_lo = Read(reg_scratch);
 		break;
 	case 11:		//	R	Don't Care			$ffff
+		ResolveCC();
 		carry = ((reg_CC & CC::C) != 0) ? 1 : 0;
 		AdjustCC_V(data_lo);
 		reg_CC = ((data_lo & 0x80) != 0) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
 		data_lo = (data_lo << 1) | carry;
-		AdjustCC_N(data_lo);
-		AdjustCC_Z(data_lo);
+		SetCC_NZ(data_lo);
 		break;
 		break;
 	case 12:		//	W	Data				EA
@@ -10699,11 +9948,7 @@ uint8_t Mc6809::ROL_idx()
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10715,8 +9960,6 @@ uint8_t Mc6809::ROL_idx()
 //*****************************************************************************
 uint8_t Mc6809::ROR_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint8_t data_lo = 0;
 	uint8_t carry = 0;
 
@@ -10733,22 +9976,18 @@ uint8_t Mc6809::ROR_idx()
 		data_lo = Read(reg_scratch);
 		break;
 	case 11:		//	R	Don't Care			$ffff
+		ResolveCC();
 		carry = ((reg_CC & CC::C) != 0) ? 0x80 : 0;
 		reg_CC = ((data_lo & 0x01) != 0) ? (reg_CC | CC::C) : (reg_CC & ~CC::C);
 		data_lo = (data_lo >> 1) | carry;
-		AdjustCC_N(data_lo);
-		AdjustCC_Z(data_lo);
+		SetCC_NZ(data_lo);
 		break;
 	case 12:		//	W	Data				EA
 		Write(reg_scratch, data_lo);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10760,8 +9999,6 @@ uint8_t Mc6809::ROR_idx()
 //*****************************************************************************
 uint8_t Mc6809::SBCA_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint16_t data;
 
 	switch (++clocksUsed)
@@ -10775,22 +10012,15 @@ uint8_t Mc6809::SBCA_idx()
 		break;
 	case 10:
 		scratch_lo = Read(reg_scratch);
+		ResolveCC();
 		data = reg_A - scratch_lo - ((reg_CC & CC::C) == CC::C ? 1 : 0);
-		AdjustCC_V(scratch_lo, reg_A, (data & 0xff));
+		SetCC_Sub(reg_A, scratch_lo, data);
 		reg_A = (data & 0xff);
-		AdjustCC_H(reg_A);
-		AdjustCC_N(reg_A);
-		AdjustCC_Z(reg_A);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10802,8 +10032,6 @@ uint8_t Mc6809::SBCA_idx()
 //*****************************************************************************
 uint8_t Mc6809::SBCB_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint16_t data;
 
 	switch (++clocksUsed)
@@ -10817,21 +10045,14 @@ uint8_t Mc6809::SBCB_idx()
 		break;
 	case 10:
 		scratch_lo = Read(reg_scratch);
+		ResolveCC();
 		data = reg_B - scratch_lo - ((reg_CC & CC::C) == CC::C ? 1 : 0);
-		AdjustCC_V(scratch_lo, reg_B, (data & 0xff));
+		SetCC_Sub(reg_B, scratch_lo, data);
 		reg_B = (data & 0xff);
-		AdjustCC_H(reg_B);
-		AdjustCC_N(reg_B);
-		AdjustCC_Z(reg_B);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10843,8 +10064,6 @@ uint8_t Mc6809::SBCB_idx()
 //*****************************************************************************
 uint8_t Mc6809::STA_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -10860,11 +10079,7 @@ uint8_t Mc6809::STA_idx()
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10876,8 +10091,6 @@ uint8_t Mc6809::STA_idx()
 //*****************************************************************************
 uint8_t Mc6809::STB_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -10893,11 +10106,7 @@ uint8_t Mc6809::STB_idx()
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10909,8 +10118,6 @@ uint8_t Mc6809::STB_idx()
 //*****************************************************************************
 uint8_t Mc6809::STD_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -10929,11 +10136,7 @@ uint8_t Mc6809::STD_idx()
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10945,8 +10148,6 @@ uint8_t Mc6809::STD_idx()
 //*****************************************************************************
 uint8_t Mc6809::STS_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -10968,11 +10169,7 @@ uint8_t Mc6809::STS_idx()
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10984,8 +10181,6 @@ uint8_t Mc6809::STS_idx()
 //*****************************************************************************
 uint8_t Mc6809::STU_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -11004,11 +10199,7 @@ uint8_t Mc6809::STU_idx()
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -11020,8 +10211,6 @@ uint8_t Mc6809::STU_idx()
 //*****************************************************************************
 uint8_t Mc6809::STX_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -11040,11 +10229,7 @@ uint8_t Mc6809::STX_idx()
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -11056,8 +10241,6 @@ uint8_t Mc6809::STX_idx()
 //*****************************************************************************
 uint8_t Mc6809::STY_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -11079,11 +10262,7 @@ uint8_t Mc6809::STY_idx()
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -11095,8 +10274,6 @@ uint8_t Mc6809::STY_idx()
 //*****************************************************************************
 uint8_t Mc6809::SUBA_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -11111,11 +10288,7 @@ uint8_t Mc6809::SUBA_idx()
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -11127,8 +10300,6 @@ uint8_t Mc6809::SUBA_idx()
 //*****************************************************************************
 uint8_t Mc6809::SUBB_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -11143,11 +10314,7 @@ uint8_t Mc6809::SUBB_idx()
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -11159,8 +10326,6 @@ uint8_t Mc6809::SUBB_idx()
 //*****************************************************************************
 uint8_t Mc6809::SUBD_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 	uint16_t data = 0;
 	uint32_t  tempRegValue = 0;
 
@@ -11182,19 +10347,12 @@ uint8_t Mc6809::SUBD_idx()
 	case 12:		//	R	Don't Care			$ffff
 		tempRegValue = Read(reg_PC++);
 		data = reg_D - tempRegValue;
-		AdjustCC_V(reg_D, tempRegValue, (uint16_t)(data & 0xffff));
+		SetCC_Sub(reg_D, (uint16_t)tempRegValue, (uint32_t)(reg_D - tempRegValue));
 		reg_D = (uint16_t)(data & 0xffff);
-		AdjustCC_N(reg_D);
-		AdjustCC_Z(reg_D);
-		AdjustCC_C(data);
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -11206,8 +10364,6 @@ uint8_t Mc6809::SUBD_idx()
 //*****************************************************************************
 uint8_t Mc6809::TST_idx()
 {
-	static uint8_t postByte;
-	uint8_t mode;
 
 	switch (++clocksUsed)
 	{
@@ -11222,19 +10378,13 @@ uint8_t Mc6809::TST_idx()
 		scratch_lo = Read(reg_scratch);
 		break;
 	case 11:		//	R	Don't Care			$ffff
-		AdjustCC_N(scratch_lo);
-		AdjustCC_Z(scratch_lo);
-		reg_CC &= ~CC::V;
+		SetCC_NZ0(scratch_lo);
 		break;
 	case 12:		//	R	Don't Care			$ffff
 		clocksUsed = 255;
 		break;
 	default:
-		mode = postByte & 0x90 >> 4;
-		if (mode == 0 || mode == 8)
-			clocksUsed = Direct(postByte, clocksUsed);
-		else
-			clocksUsed = Indirect(postByte, clocksUsed);
+		clocksUsed = Indexed(postByte, clocksUsed);
 		break;
 	}
 	return(clocksUsed);
@@ -10,27 +10,53 @@
 ******************************************************************************/
 #pragma once
 
+#include <atomic>
 #include <cstdint>
-#include <string>
-#include <vector>
 
 #include "CPU.h"
 #include "MMU.h"
+#ifdef USE_BUS_TRACE
+#include "BusTrace.h"
+#endif
+#ifdef USE_PC_PROFILE
+#include "PcProfile.h"
+#endif
 
 #define MC6809E
+#define USE_RESET_3E		// build the undocumented $3E RESET opcode instead of treating it as invalid
+#define USE_LAZY_CC			// work out H N Z V C only when CC is read, not after every ALU op
+#define USE_THREADED_DISPATCH	// Step() calls handlers directly (a switch, or computed goto) instead of through exec
+//#define USE_COMPUTED_GOTO	// threaded dispatch jumps through a table of label addresses instead of a switch (GCC and Clang only)
+#define USE_DECODE_CACHE	// keep page, opcode and length per PC so code is only decoded again after it is written
+#define USE_BLOCK_CACHE		// Run() replays straight-line code from predecoded blocks instead of decoding every opcode
+//#define USE_BUS_TRACE		// record every bus cycle to a BusTrace set with SetTrace()
+//#define USE_OPCODE_PROFILE	// count executions and cycles per opcode and indexed post byte (see Mc6809Profile.cpp)
+//#define USE_PC_PROFILE		// sample PC into a PcProfile set with SetPcProfile()
 
+#if defined(USE_BLOCK_CACHE) && !defined(USE_DECODE_CACHE)
+#error USE_BLOCK_CACHE decodes through USE_DECODE_CACHE
+#endif
+#if defined(USE_COMPUTED_GOTO) && !defined(__GNUC__)
+#error USE_COMPUTED_GOTO needs GCC or Clang label addresses
+#endif
+
+//*****************************************************************************
+//	Every piece of Mc6809 state lives in the instance, including what an
+// instruction carries from one cycle to the next. The only statics are the
+// const tables built at compile time (OpCode, OpCodeName, IndexedModes,
+// AluFlags), so separate instances share nothing mutable and may be clocked
+// from separate threads. One instance, and the MMU it is given, must only be
+// clocked from one thread at a time.
+//*****************************************************************************
 class Mc6809 : 	public CPU
 {
 	// variables
 private:
-	MMU* bus;
+	MMU* bus;										// RAM and ROM through its page tables, the rest virtual
 	uint8_t(Mc6809::* exec)();						// Mnemonic function from interpreted Opcode
 
 	uint8_t clocksUsed;
-
-	static const uint8_t HIGH_BYTE;
-	static const uint8_t LOW_BYTE;
-	static const uint8_t SINGLE_BYTE;
+	bool waitState;									// parked in SYNC, CWAI or HALT waiting on an external line
 
 
 protected:
@@ -63,8 +89,41 @@ protected:
 		DP
 	};
 
+	//-------------------------------------------------------------------------
+	// enumeration for the ALU operation recorded for lazy condition codes
+	//-------------------------------------------------------------------------
+	enum CCOP : uint8_t
+	{
+		NZ8 = 0x00,
+		NZ16,
+		ADD8,
+		ADD16,
+		SUB8,
+		SUB16
+	};
+
+	//-------------------------------------------------------------------------
+	// enumeration for the indexed addressing offset kinds
+	//-------------------------------------------------------------------------
+	enum IDX : uint8_t
+	{
+		NO_OFFSET = 0x00,
+		OFFSET_5BIT,
+		OFFSET_8BIT,
+		OFFSET_16BIT,
+		OFFSET_A,
+		OFFSET_B,
+		OFFSET_D,
+		ILLEGAL
+	};
+
 	// Registers, Program/App accessible and internal to CPU only
 	uint8_t reg_CC;				// Condition Code register		(Program Accessible)	0B
+	uint8_t ccLazy;				// CC flags still owed by the recorded ALU operation	(INTERNAL CPU USE ONLY)
+	uint8_t ccOp;				// recorded ALU operation (CCOP)						(INTERNAL CPU USE ONLY)
+	uint16_t ccA;				// recorded operand (register)							(INTERNAL CPU USE ONLY)
+	uint16_t ccB;				// recorded operand (data)								(INTERNAL CPU USE ONLY)
+	uint32_t ccR;				// recorded result, with carry out						(INTERNAL CPU USE ONLY)
 	uint8_t reg_DP;				// Direct Page register.		(Program Accessible)	0A
 
 	union		// Registers: Accumulator A, B, and D
@@ -131,26 +190,186 @@ protected:
 		};
 		uint16_t reg_scratch;		// scratch register				(INTERNAL CPU USE ONLY)
 	};
+	union		// Operand Register, carries a fetched operand or address across the cycles of an instruction
+	{
+		struct
+		{
+			uint8_t operand_lo;		// operand register low byte	(INTERNAL CPU USE ONLY)
+			uint8_t operand_hi;		// operand register hi byte		(INTERNAL CPU USE ONLY)
+		};
+		uint16_t reg_operand;		// operand register				(INTERNAL CPU USE ONLY)
+	};
+	uint16_t indexedAddress;		// pointer address for indirect indexed modes	(INTERNAL CPU USE ONLY)
+	uint8_t postByte;				// post byte of the indexed instruction in flight	(INTERNAL CPU USE ONLY)
+	int8_t bitNumber;				// PSHx/PULx register being stacked				(INTERNAL CPU USE ONLY)
+	int8_t syncCount;				// SYNC, cycles an interrupt line has been held	(INTERNAL CPU USE ONLY)
+	uint32_t runCycles;				// cycles of whole instructions so far in Run()	(INTERNAL CPU USE ONLY)
+
+	// Idle loop signatures, code that only ever leaves on an interrupt or an
+	// outside event (see AddIdleLoop()). Branches to themselves are always
+	// idle and need no signature.
+	static const uint8_t IDLE_LOOPS = 4;
+	static const uint8_t IDLE_LOOP_BYTES = 8;
+
+	struct IDLELOOP
+	{
+		uint16_t pc;
+		uint8_t length;
+		uint8_t code[IDLE_LOOP_BYTES];
+	};
 
+	IDLELOOP idleLoops[IDLE_LOOPS];
+	uint8_t idleLoopCount;
+
+	// Opcode dispatch tables, generated at build time from Opcodes_p1/p2/p3.csv
+	// by GenOpCodes.py (see Mc6809OpCodes.cpp). The hot table only holds what
+	// is needed to dispatch and time an instruction, the mnemonics live apart
+	// in the cold table so they never share cache lines with the dispatch data.
 	struct OPCODE
 	{
-		std::string name;
 		uint8_t(Mc6809::* opcode)();						// Mnemonic function from interpreted Opcode
 		uint8_t minCycles;
-		uint8_t maxCycles;
+		uint8_t maxCycles;									// 99 = post byte dependent, 0 = open ended
 		uint8_t pgmBytes;
 	};
 
-	std::vector<OPCODE> OpCode[3];
+	// H N Z V C for every 8 bit reg + data + carry, built at compile time and
+	// shared by all instances (see Mc6809Flags.cpp). Subtracts use the same
+	// table as reg + ~data + !borrow.
+	struct FLAGTABLE
+	{
+		uint8_t add[2][256][256];						// [carry][reg][data]
+
+		constexpr FLAGTABLE();
+	};
+
+	static const FLAGTABLE AluFlags;
+
+	// Indexed addressing post byte decode, one entry per post byte. Generated
+	// with the opcode tables (see Mc6809OpCodes.cpp).
+	struct IDXMODE
+	{
+		uint16_t Mc6809::* reg;								// base register, nullptr for [n16]
+		uint8_t offset;										// IDX offset kind
+		int8_t offset5;										// 5 bit offset, sign extended
+		int8_t step;										// +1 +2 post increment, -1 -2 pre decrement
+		bool indirect;
+		uint8_t cycles;										// extra cycles over the base indexed cost
+		uint8_t pgmBytes;									// extra program bytes after the post byte
+	};
+
+	static const IDXMODE IndexedModes[256];
+
+	static const OPCODE OpCode[3][256];
+	static const char* const OpCodeName[3][256];
 	uint8_t opCodePage;
 
+#ifdef USE_OPCODE_PROFILE
+	// Per opcode and per post byte counts, exported by SaveProfile(). The
+	// sheet rows and post byte names are cold tables generated with OpCode.
+	struct PROFILE
+	{
+		uint64_t executions;
+		uint64_t cycles;
+	};
+
+	static const char* const OpCodeSheet[3][256];
+	static const char* const IndexedName[256];
+
+	PROFILE profile[3][256];
+	uint64_t postByteCount[256];
+	PROFILE* profiling;									// entry of the instruction in flight, for Clock() and Resume()
+#endif
+
+#ifdef USE_PC_PROFILE
+	PcProfile* pcProfile;								// not owned, nullptr = not sampling
+	int32_t pcCountdown;								// cycles to the next sample
+#endif
+
+#ifdef USE_DECODE_CACHE
+	// One decoded instruction per 16 bit PC (see Mc6809Decode.cpp). An entry
+	// is good while the write generations of the page(s) it was read from
+	// add up to the same value as when it was decoded. A write into decoded
+	// code bumps the generation of its page, and of every page aliasing it,
+	// a map change bumps them all.
+	//
+	//	Entries are kept by logical PC, but pages are told apart by the
+	// memory the MMU points them at. aliasNext[] links the pages reading the
+	// same memory into a ring (SAM mirrors, DiscreetMMU slots on one bank),
+	// so a write through any of them reaches code decoded through the rest.
+	struct DECODED
+	{
+		uint32_t generation;								// pageGeneration[first] + pageGeneration[last]
+		uint8_t page;										// OpCode[] page, 0 = no prefix
+		uint8_t opcode;
+		uint8_t length : 7;									// program bytes, prefix and indexed offsets included
+		uint8_t endsBlock : 1;								// flow of control can leave here (or illegal)
+		uint8_t postByte;									// IndexedModes[] entry, indexed opcodes only
+	};
+
+	DECODED* decoded;									// [0x10000]
+	uint32_t pageGeneration[256];
+	uint32_t decodeMapGeneration;						// bus->MapGeneration() pageGeneration[] was last bumped for
+	uint8_t aliasNext[256];								// next page reading the same memory, itself if none
+	uint8_t writeAlias[256];							// a page on the ring reading what this page writes
+#endif
+
+#ifdef USE_BLOCK_CACHE
+	// Translated straight-line code, one block per start PC (direct mapped),
+	// see Mc6809Blocks.cpp. codeMap has a bit set for every byte a valid
+	// block was decoded from, so Write() only has to test one bit.
+	static const uint16_t BLOCK_CACHE_SIZE = 1024;		// blocks, power of 2
+	static const uint8_t BLOCK_OPS = 16;				// opcodes per block at most
+
+	struct BLOCKOP
+	{
+		uint16_t pc;
+		uint8_t page;
+		uint8_t opcode;
+	};
+
+	struct BLOCK
+	{
+		uint16_t start;
+		uint8_t count;										// 0 = empty
+		uint8_t firstPage;
+		uint8_t lastPage;
+		BLOCKOP op[BLOCK_OPS];
+	};
+
+	BLOCK blocks[BLOCK_CACHE_SIZE];
+	uint8_t codeMap[0x10000 / 8];
+	uint32_t blockMapGeneration;						// bus->MapGeneration() the blocks were decoded under
+	bool blockAbort;									// the running block was just invalidated
+#endif
+
+#ifdef USE_BUS_TRACE
+	BusTrace* trace;									// not owned, nullptr = not tracing
+	uint32_t traceCycle;								// cycles run, low 32 bits
+	uint8_t traceFlags;									// BusTrace::FLAG for the next Read()
+#endif
+
+
+	// Interrupt and control lines, one bit each, raised and dropped from any
+	// thread with Assert()/Deassert(). RESET is latched until the reset
+	// sequence starts, NMI is latched on the asserting edge until it is
+	// taken, the rest follow the line level. NMI_LEVEL is the level behind
+	// the NMI latch and is never pending itself.
+	static const uint8_t NMI_LEVEL = (1 << 7);
+	std::atomic<uint8_t> lines;
 
 public:
-	volatile bool Halt = false;
-	volatile bool Reset = true;
-	volatile bool Nmi = false;
-	volatile bool Firq = false;
-	volatile bool Irq = false;
+	struct LINE
+	{
+		enum : uint8_t
+		{
+			HALT = (1 << 0),
+			RESET = (1 << 1),
+			NMI = (1 << 2),
+			FIRQ = (1 << 3),
+			IRQ = (1 << 4),
+		};
+	};
 
 	// functions
 private:
@@ -235,60 +454,129 @@ protected:
 	uint8_t FIRQ();			// hardware FIRQ
 	uint8_t IRQ();			// hardware IRQ
 
-	// internal functionality
-	uint8_t Read(const uint16_t address, const bool readOnly = false);
-	void Write(const uint16_t address, const uint8_t byte);
-	uint8_t Fetch(const uint16_t address);
+	// internal functionality (final so handler bus accesses are direct calls)
+	uint8_t Read(const uint16_t address, const bool readOnly = false) final;
+	void Write(const uint16_t address, const uint8_t byte) final;
+	uint8_t Fetch(const uint16_t address) final;
+
+	void RecordCC(uint8_t op, uint8_t flags, uint16_t dataA, uint16_t dataB, uint32_t result);
+	void ResolveCC();
+	void ResolveLazyCC();
+
+	void SetCC_NZ(uint8_t result);
+	void SetCC_NZ0(uint8_t result);
+	void SetCC_Add(uint8_t reg, uint8_t data, uint16_t result);
+	void SetCC_Sub(uint8_t reg, uint8_t data, uint16_t result);
+
+	void SetCC_NZ(uint16_t result);
+	void SetCC_NZ0(uint16_t result);
+	void SetCC_Add(uint16_t reg, uint16_t data, uint32_t result);
+	void SetCC_Sub(uint16_t reg, uint16_t data, uint32_t result);
 
-	void AdjustCC_H(uint8_t reg);
-	void AdjustCC_N(uint8_t reg);
 	void AdjustCC_Z(uint8_t reg);
-	void AdjustCC_V(uint8_t reg1, uint8_t data, uint8_t result);
 	void AdjustCC_V(uint8_t reg);
 	void AdjustCC_C(uint16_t word);
-
-//	void AdjustCC_H(uint16_t reg);
-	void AdjustCC_N(uint16_t reg);
 	void AdjustCC_Z(uint16_t reg);
-	void AdjustCC_V(uint16_t reg1, uint16_t data, uint16_t result);
-	void AdjustCC_C(uint32_t word);
-
-	void IndexedIncRegister(uint8_t postByte);
-	void IndexedDecRegister(uint8_t poatByte);
-	void IndexedAddToScratchRegister(uint8_t postByte);
-	uint8_t IndexedReadByteFromIndex(uint8_t postByte, uint8_t offset = 0);
-
-	uint8_t Direct(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t DirectNoOffset(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t Direct5bitOffset(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t Direct8BitOffset(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t Direct16BitOffset(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t DirectAccAOffset(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t DirectAccBOffset(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t DirectAccDOffset(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t DirectInc1Offset(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t DirectInc2Offset(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t DirectDec1Offset(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t DirectDec2Offset(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t Direct8BitFromPcOffset(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t Direct16BitFromPcOffset(uint8_t postByte, uint8_t clocksUsed);
-
-	uint8_t Indirect(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t IndirectNoOffset(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t Indirect8BitOffset(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t Indirect16BitOffset(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t IndirectAccAOffset(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t IndirectAccBOffset(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t IndirectAccDOffset(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t IndirectInc2Offset(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t IndirectDec2Offset(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t Indirect8BitFromPcOffset(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t Indirect16BitFromPcOffset(uint8_t postByte, uint8_t clocksUsed);
-	uint8_t Indirect16BitExtendedOffset(uint8_t postByte, uint8_t clocksUsed);
+
+	uint8_t Pending() const
+	{
+		return(lines.load(std::memory_order_acquire) & ~NMI_LEVEL);
+	}
+	uint8_t Unmasked();
+
+#ifdef USE_PC_PROFILE
+	// one sample per Interval() cycles, charged to the instruction at pc
+	void SamplePC(const uint16_t pc, const uint8_t cycles)
+	{
+		if (pcProfile == nullptr)
+			return;
+		for (pcCountdown -= cycles; pcCountdown <= 0; pcCountdown += pcProfile->Interval())
+			pcProfile->Sample(bus->Bank(pc), pc);
+	}
+#endif
+
+	uint8_t Indexed(uint8_t postByte, uint8_t clocksUsed);
+	uint8_t Interpret(uint8_t page, uint8_t opcode);
+	uint8_t DispatchSwitch(uint8_t page, uint8_t opcode);
+#if defined(__GNUC__)
+	uint8_t DispatchTable(uint8_t page, uint8_t opcode);
+#endif
+	uint8_t Execute(uint8_t page, uint8_t opcode);
+	uint8_t Resume();
+	bool IdleLoopAt(uint16_t pc);
+
+#ifdef USE_DECODE_CACHE
+	const DECODED* Decode(uint16_t pc);
+	void MapAliases();
+#endif
+
+#ifdef USE_BLOCK_CACHE
+	uint32_t RunBlock(uint32_t cycleBudget);
+	bool Translate(BLOCK& block, uint16_t pc);
+	void InvalidateCodePage(uint8_t page);
+	void FlushBlocks();
+#endif
+
 public:
 	Mc6809(MMU* device = nullptr);
 	~Mc6809();
 
 	void SetMMU(MMU* device);
 	void Clock();
+	uint8_t Step();
+	uint32_t Run(uint32_t cycleBudget);
+	bool Idle();
+
+	// the tick the instruction in flight started on, for devices being
+	// caught up to the CPU mid-Run()
+	uint64_t Now() const override
+	{
+		return(reached + (phase + uint64_t(runCycles) * rate.ticks) / rate.cycles);
+	}
+
+	void Assert(uint8_t line);
+	void Deassert(uint8_t line);
+
+#ifdef USE_BUS_TRACE
+	void SetTrace(BusTrace* recorder) { trace = recorder; }
+#endif
+
+#ifdef USE_OPCODE_PROFILE
+	void ClearProfile();
+	bool SaveProfile(const char* prefix);
+#endif
+
+#ifdef USE_PC_PROFILE
+	void SetPcProfile(PcProfile* sampler);
+#endif
+
+	bool AddIdleLoop(uint16_t pc, const uint8_t* code, uint8_t length);
+	void ClearIdleLoops();
+
+	uint8_t GetCC();
+
+	// the programmer visible registers, for debuggers and trace checkers
+	struct REGISTERS
+	{
+		uint16_t pc;
+		uint16_t x;
+		uint16_t y;
+		uint16_t u;
+		uint16_t s;
+		uint8_t a;
+		uint8_t b;
+		uint8_t dp;
+		uint8_t cc;
+	};
+
+	void GetRegisters(REGISTERS& regs);
+
+	static uint8_t FlagsAdd8(uint8_t reg, uint8_t data, uint8_t carry)
+	{
+		return(AluFlags.add[carry & 0x01][reg][data]);
+	}
+	static uint8_t FlagsSub8(uint8_t reg, uint8_t data, uint8_t borrow)
+	{
+		return(AluFlags.add[(borrow & 0x01) ^ 0x01][reg][data ^ 0xff] ^ CC::C);
+	}
 };
@@ -0,0 +1,154 @@
+/******************************************************************************
+*		   File: Mc6809Blocks.cpp
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/21
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+//	Basic block cache for Run().
+//
+//	A block is a run of straight-line code decoded once into (pc, page,
+// opcode) triples, ending at the first instruction that can change the flow
+// of control. Replaying a block skips the prefix check, opcode fetch and
+// table lookup Step() does for every instruction. The handlers still fetch
+// their own operands, so bus timing inside an instruction is unchanged.
+//
+//	A block is dropped when a byte it was decoded from is written through
+// Write(), at that address or through any page aliasing it (see
+// MapAliases()), and the whole cache is dropped when the MMU map changes.
+//*****************************************************************************
+#include <cstring>
+
+#include "Mc6809.h"
+
+#ifdef USE_BLOCK_CACHE
+
+
+//*****************************************************************************
+//	RunBlock()
+//*****************************************************************************
+//	Replays the block starting at PC, translating it first if needed. Stops
+// early on an unmasked interrupt line, a wait state, StopRun(), cycleBudget,
+// PC leaving the block, a write into the block itself, or a change to the
+// map.
+//*****************************************************************************
+//	runCycles is moved on before each instruction, for Now().
+//*****************************************************************************
+//	Returns:
+//	uint32_t - cycles used, 0 if there is no block to run here and the
+//				caller should Step() instead.
+//*****************************************************************************
+uint32_t Mc6809::RunBlock(const uint32_t cycleBudget)
+{
+	const uint32_t start = runCycles;
+	uint32_t cycles = 0;
+
+	if ((exec != nullptr) || ((Pending() != 0) && (Unmasked() != 0)))
+		return(0);
+
+	if (bus->MapGeneration() != blockMapGeneration)
+	{
+		FlushBlocks();
+		blockMapGeneration = bus->MapGeneration();
+	}
+
+	BLOCK& block = blocks[reg_PC & (BLOCK_CACHE_SIZE - 1)];
+	if (((block.count == 0) || (block.start != reg_PC)) && !Translate(block, reg_PC))
+		return(0);
+
+	blockAbort = false;
+	for (uint8_t i = 0; i < block.count; i++)
+	{
+		const BLOCKOP& op = block.op[i];
+
+		if (reg_PC != op.pc)
+			break;
+		runCycles = start + cycles;
+		cycles += Execute(op.page, op.opcode);
+		if ((exec != nullptr) || blockAbort || (cycles >= cycleBudget))
+			break;
+		if (stopRun.load(std::memory_order_relaxed))
+			break;
+		if (((Pending() != 0) && (Unmasked() != 0)) || (bus->MapGeneration() != blockMapGeneration))
+			break;
+	}
+
+	return(cycles);
+}
+
+
+//*****************************************************************************
+//	Translate()
+//*****************************************************************************
+//	Fills block with straight-line code from pc, through Decode(). Code in
+// I/O pages is never decoded, so it always goes through Step().
+//*****************************************************************************
+//	Returns:
+//	bool - false if not even one instruction could be decoded.
+//*****************************************************************************
+bool Mc6809::Translate(BLOCK& block, const uint16_t pc)
+{
+	uint16_t address = pc;
+
+	block.start = pc;
+	block.count = 0;
+	block.firstPage = pc >> 8;
+	block.lastPage = pc >> 8;
+
+	while (block.count < BLOCK_OPS)
+	{
+		const DECODED* entry = Decode(address);
+		if (entry == nullptr)
+			break;
+
+		block.op[block.count++] = { address, entry->page, entry->opcode };
+		block.lastPage = (address + entry->length - 1) >> 8;
+		for (uint16_t at = address; at != (uint16_t)(address + entry->length); at++)
+			codeMap[at >> 3] |= (1 << (at & 0x07));
+		address += entry->length;
+
+		if (entry->endsBlock)
+			break;
+	}
+
+	return(block.count != 0);
+}
+
+
+//*****************************************************************************
+//	InvalidateCodePage()
+//*****************************************************************************
+//	A byte some block was decoded from has been written. Drops every block
+// and decoded entry with code in that page and tells RunBlock() to stop
+// after the current instruction, in case it was the one running.
+//*****************************************************************************
+void Mc6809::InvalidateCodePage(const uint8_t page)
+{
+	pageGeneration[page]++;
+	for (BLOCK& block : blocks)
+	{
+		if ((block.firstPage == page) || (block.lastPage == page))
+			block.count = 0;
+	}
+	memset(&codeMap[page << 5], 0x00, 0x100 / 8);
+	blockAbort = true;
+}
+
+
+//*****************************************************************************
+//	FlushBlocks()
+//*****************************************************************************
+//	Drops every block.
+//*****************************************************************************
+void Mc6809::FlushBlocks()
+{
+	for (BLOCK& block : blocks)
+		block.count = 0;
+	memset(codeMap, 0x00, sizeof(codeMap));
+	blockAbort = true;
+}
+
+#endif
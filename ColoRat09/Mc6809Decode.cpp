@@ -0,0 +1,196 @@
+/******************************************************************************
+*		   File: Mc6809Decode.cpp
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/21
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+//	Per-PC instruction decode cache.
+//
+//	Works out, once per address, which OpCode[] page and opcode sit there
+// and how many program bytes the instruction takes, so the block cache
+// (Mc6809Blocks.cpp) can walk code, prefixes and indexed post bytes
+// included, without decoding it again. Step() does not use it: with the MMU
+// page tables, peeking at the opcode costs less than the lookup.
+//*****************************************************************************
+#include <algorithm>
+
+#include "Mc6809.h"
+
+#ifdef USE_DECODE_CACHE
+
+
+//*****************************************************************************
+//	EndsBlock()
+//*****************************************************************************
+//	True for the opcodes that can leave straight-line code: branches, jumps,
+// calls, returns, software interrupts, waits, and the ones that can load PC
+// (TFR, EXG, PULS, PULU).
+//*****************************************************************************
+static bool EndsBlock(const uint8_t page, const uint8_t opcode)
+{
+	if (page == 0)
+	{
+		switch (opcode)
+		{
+		case 0x0e:	// JMP dir
+		case 0x13:	// SYNC
+		case 0x16:	// LBRA
+		case 0x17:	// LBSR
+		case 0x1e:	// EXG
+		case 0x1f:	// TFR
+		case 0x35:	// PULS
+		case 0x37:	// PULU
+		case 0x39:	// RTS
+		case 0x3b:	// RTI
+		case 0x3c:	// CWAI
+		case 0x3e:	// RESET
+		case 0x3f:	// SWI
+		case 0x6e:	// JMP idx
+		case 0x7e:	// JMP ext
+		case 0x8d:	// BSR
+		case 0x9d:	// JSR dir
+		case 0xad:	// JSR idx
+		case 0xbd:	// JSR ext
+			return(true);
+		}
+		return((opcode & 0xf0) == 0x20);			// Bcc
+	}
+	return((opcode == 0x3f) || ((page == 1) && ((opcode & 0xf0) == 0x20)));	// SWI2 SWI3, LBcc
+}
+
+
+//*****************************************************************************
+//	IsIndexed()
+//*****************************************************************************
+//	True for the opcodes with an indexed post byte: LEAx $30-$33 and the $6x,
+// $Ax and $Ex columns, on every page.
+//*****************************************************************************
+static bool IsIndexed(const uint8_t opcode)
+{
+	return(((opcode >= 0x30) && (opcode <= 0x33)) || ((opcode & 0xf0) == 0x60) || ((opcode & 0xf0) == 0xa0) || ((opcode & 0xf0) == 0xe0));
+}
+
+
+//*****************************************************************************
+//	Decode()
+//*****************************************************************************
+//	Returns the cached decode of the instruction at pc, decoding it first if
+// the entry is missing or stale. Only RAM and ROM pages are decoded; reading
+// ahead in I/O could have side effects.
+//*****************************************************************************
+//	Returns:
+//	const DECODED* - the entry, or nullptr if pc (or the bytes after it) is
+//				not in mapped memory.
+//*****************************************************************************
+const Mc6809::DECODED* Mc6809::Decode(const uint16_t pc)
+{
+	if (bus->MapGeneration() != decodeMapGeneration)
+	{
+		for (uint32_t& generation : pageGeneration)
+			generation++;
+		decodeMapGeneration = bus->MapGeneration();
+		MapAliases();
+	}
+
+	DECODED& entry = decoded[pc];
+	uint8_t lastPage = (pc + entry.length - 1) >> 8;
+	if ((entry.length != 0) && (entry.generation == pageGeneration[pc >> 8] + pageGeneration[lastPage]))
+		return(&entry);
+
+	// longest instruction is 5 bytes ($10 prefix, indexed, 16 bit offset)
+	const uint8_t* first = bus->ReadPage(pc);
+	const uint8_t* last = bus->ReadPage(pc + 4);
+	if ((first == nullptr) || (last == nullptr))
+		return(nullptr);
+
+	uint8_t bytes[5];
+	for (uint8_t i = 0; i < 5; i++)
+	{
+		uint16_t at = pc + i;
+		bytes[i] = (((at ^ pc) & 0xff00) == 0) ? first[at & 0xff] : last[at & 0xff];
+	}
+
+	uint8_t page = 0;
+	uint8_t opcode = bytes[0];
+	if ((opcode == 0x10) || (opcode == 0x11))
+	{
+		page = (opcode == 0x10) ? 1 : 2;
+		opcode = bytes[1];
+	}
+
+	const OPCODE& op = OpCode[page][opcode];
+	uint8_t length = (op.pgmBytes != 0) ? op.pgmBytes : 1;
+	uint8_t postByte = 0;
+	bool illegal = (op.opcode == nullptr) || (op.opcode == &Mc6809::XXX);
+
+	if (!illegal && IsIndexed(opcode))
+	{
+		postByte = bytes[length - 1];
+		illegal = (IndexedModes[postByte].offset == IDX::ILLEGAL);
+		length += IndexedModes[postByte].pgmBytes;
+	}
+
+	lastPage = (pc + length - 1) >> 8;
+	entry.generation = pageGeneration[pc >> 8] + pageGeneration[lastPage];
+	entry.page = page;
+	entry.opcode = opcode;
+	entry.length = length;
+	entry.endsBlock = (illegal || EndsBlock(page, opcode)) ? 1 : 0;
+	entry.postByte = postByte;
+
+	return(&entry);
+}
+
+
+//*****************************************************************************
+//	MapAliases()
+//*****************************************************************************
+//	Rebuilds the alias rings from the MMU's page pointers. Two pages alias
+// when they read through the same pointer. A page whose writes land in
+// memory it does not read itself (RAM under ROM) starts its ring walk at a
+// page that does read it, if any.
+//*****************************************************************************
+void Mc6809::MapAliases()
+{
+	struct MAPPED
+	{
+		const uint8_t* memory;
+		uint8_t page;
+
+		bool operator<(const MAPPED& other) const { return(memory < other.memory); }
+	};
+	MAPPED mapped[256];
+	uint16_t count = 0;
+
+	for (uint16_t page = 0; page < 256; page++)
+	{
+		aliasNext[page] = (uint8_t)page;
+		writeAlias[page] = (uint8_t)page;
+		if ((bus != nullptr) && (bus->ReadPage(page << 8) != nullptr))
+			mapped[count++] = { bus->ReadPage(page << 8), (uint8_t)page };
+	}
+	std::sort(mapped, mapped + count);
+
+	for (uint16_t first = 0, last; first < count; first = last)
+	{
+		for (last = first + 1; (last < count) && (mapped[last].memory == mapped[first].memory); last++)
+			aliasNext[mapped[last - 1].page] = mapped[last].page;
+		aliasNext[mapped[last - 1].page] = mapped[first].page;
+	}
+
+	for (uint16_t page = 0; (bus != nullptr) && (page < 256); page++)
+	{
+		const uint8_t* memory = bus->WritePage(page << 8);
+		if ((memory == nullptr) || (memory == bus->ReadPage(page << 8)))
+			continue;
+		const MAPPED* found = std::lower_bound(mapped, mapped + count, MAPPED{ memory, 0 });
+		if ((found != mapped + count) && (found->memory == memory))
+			writeAlias[page] = found->page;
+	}
+}
+
+#endif
@@ -0,0 +1,797 @@
+/******************************************************************************
+*		   File: Mc6809Dispatch.h
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/21
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+//	GENERATED FILE - DO NOT EDIT.
+//
+//	Built by GenOpCodes.py from Opcodes_p1.csv, Opcodes_p2.csv and
+// Opcodes_p3.csv. Edit the sheets and re-run the script instead.
+//
+//	DISPATCH(page, opcode, handler) for every opcode of every page, in table
+// order. Only included by Mc6809.cpp, which defines DISPATCH first, so there
+// is no include guard.
+//*****************************************************************************
+
+// page 1
+DISPATCH(0, 0x00, NEG_dir)
+DISPATCH(0, 0x01, XXX)
+DISPATCH(0, 0x02, XXX)
+DISPATCH(0, 0x03, COM_dir)
+DISPATCH(0, 0x04, LSR_dir)
+DISPATCH(0, 0x05, XXX)
+DISPATCH(0, 0x06, ROR_dir)
+DISPATCH(0, 0x07, ASR_dir)
+DISPATCH(0, 0x08, ASL_LSL_dir)
+DISPATCH(0, 0x09, ROL_dir)
+DISPATCH(0, 0x0A, DEC_dir)
+DISPATCH(0, 0x0B, XXX)
+DISPATCH(0, 0x0C, INC_dir)
+DISPATCH(0, 0x0D, TST_dir)
+DISPATCH(0, 0x0E, JMP_dir)
+DISPATCH(0, 0x0F, CLR_dir)
+DISPATCH(0, 0x10, XXX)
+DISPATCH(0, 0x11, XXX)
+DISPATCH(0, 0x12, NOP_inh)
+DISPATCH(0, 0x13, SYNC_inh)
+DISPATCH(0, 0x14, XXX)
+DISPATCH(0, 0x15, XXX)
+DISPATCH(0, 0x16, LBRA_rel)
+DISPATCH(0, 0x17, LBSR_rel)
+DISPATCH(0, 0x18, XXX)
+DISPATCH(0, 0x19, DAA_inh)
+DISPATCH(0, 0x1A, ORCC_imm)
+DISPATCH(0, 0x1B, XXX)
+DISPATCH(0, 0x1C, ANDCC_imm)
+DISPATCH(0, 0x1D, SEX_inh)
+DISPATCH(0, 0x1E, EXG_imm)
+DISPATCH(0, 0x1F, TFR_imm)
+DISPATCH(0, 0x20, BRA_rel)
+DISPATCH(0, 0x21, BRN_rel)
+DISPATCH(0, 0x22, BHI_rel)
+DISPATCH(0, 0x23, BLS_rel)
+DISPATCH(0, 0x24, BHS_BCC_rel)
+DISPATCH(0, 0x25, BLO_BCS_rel)
+DISPATCH(0, 0x26, BNE_rel)
+DISPATCH(0, 0x27, BEQ_rel)
+DISPATCH(0, 0x28, BVC_rel)
+DISPATCH(0, 0x29, BVS_rel)
+DISPATCH(0, 0x2A, BPL_rel)
+DISPATCH(0, 0x2B, BMI_rel)
+DISPATCH(0, 0x2C, BGE_rel)
+DISPATCH(0, 0x2D, BLT_rel)
+DISPATCH(0, 0x2E, BGT_rel)
+DISPATCH(0, 0x2F, BLE_rel)
+DISPATCH(0, 0x30, LEAX_idx)
+DISPATCH(0, 0x31, LEAY_idx)
+DISPATCH(0, 0x32, LEAS_idx)
+DISPATCH(0, 0x33, LEAU_idx)
+DISPATCH(0, 0x34, PSHS_imm)
+DISPATCH(0, 0x35, PULS_imm)
+DISPATCH(0, 0x36, PSHU_imm)
+DISPATCH(0, 0x37, PULU_imm)
+DISPATCH(0, 0x38, XXX)
+DISPATCH(0, 0x39, RTS_inh)
+DISPATCH(0, 0x3A, ABX_inh)
+DISPATCH(0, 0x3B, RTI_inh)
+DISPATCH(0, 0x3C, CWAI_inh)
+DISPATCH(0, 0x3D, MUL_inh)
+#ifdef USE_RESET_3E
+DISPATCH(0, 0x3E, RESET_inh)
+#else
+DISPATCH(0, 0x3E, XXX)
+#endif
+DISPATCH(0, 0x3F, SWI_inh)
+DISPATCH(0, 0x40, NEGA_inh)
+DISPATCH(0, 0x41, XXX)
+DISPATCH(0, 0x42, XXX)
+DISPATCH(0, 0x43, COMA_inh)
+DISPATCH(0, 0x44, LSRA_inh)
+DISPATCH(0, 0x45, XXX)
+DISPATCH(0, 0x46, RORA_inh)
+DISPATCH(0, 0x47, ASRA_inh)
+DISPATCH(0, 0x48, ASLA_LSLA_inh)
+DISPATCH(0, 0x49, ROLA_inh)
+DISPATCH(0, 0x4A, DECA_inh)
+DISPATCH(0, 0x4B, XXX)
+DISPATCH(0, 0x4C, INCA_inh)
+DISPATCH(0, 0x4D, TSTA_inh)
+DISPATCH(0, 0x4E, XXX)
+DISPATCH(0, 0x4F, CLRA_inh)
+DISPATCH(0, 0x50, NEGB_inh)
+DISPATCH(0, 0x51, XXX)
+DISPATCH(0, 0x52, XXX)
+DISPATCH(0, 0x53, COMB_inh)
+DISPATCH(0, 0x54, LSRB_inh)
+DISPATCH(0, 0x55, XXX)
+DISPATCH(0, 0x56, RORB_inh)
+DISPATCH(0, 0x57, ASRB_inh)
+DISPATCH(0, 0x58, ASLB_LSLB_inh)
+DISPATCH(0, 0x59, ROLB_inh)
+DISPATCH(0, 0x5A, DECB_inh)
+DISPATCH(0, 0x5B, XXX)
+DISPATCH(0, 0x5C, INCB_inh)
+DISPATCH(0, 0x5D, TSTB_inh)
+DISPATCH(0, 0x5E, XXX)
+DISPATCH(0, 0x5F, CLRB_inh)
+DISPATCH(0, 0x60, NEG_idx)
+DISPATCH(0, 0x61, XXX)
+DISPATCH(0, 0x62, XXX)
+DISPATCH(0, 0x63, COM_idx)
+DISPATCH(0, 0x64, LSR_idx)
+DISPATCH(0, 0x65, XXX)
+DISPATCH(0, 0x66, ROR_idx)
+DISPATCH(0, 0x67, ASR_idx)
+DISPATCH(0, 0x68, ASL_LSL_idx)
+DISPATCH(0, 0x69, ROL_idx)
+DISPATCH(0, 0x6A, DEC_idx)
+DISPATCH(0, 0x6B, XXX)
+DISPATCH(0, 0x6C, INC_idx)
+DISPATCH(0, 0x6D, TST_idx)
+DISPATCH(0, 0x6E, JMP_idx)
+DISPATCH(0, 0x6F, CLR_idx)
+DISPATCH(0, 0x70, NEG_ext)
+DISPATCH(0, 0x71, XXX)
+DISPATCH(0, 0x72, XXX)
+DISPATCH(0, 0x73, COM_ext)
+DISPATCH(0, 0x74, LSR_ext)
+DISPATCH(0, 0x75, XXX)
+DISPATCH(0, 0x76, ROR_ext)
+DISPATCH(0, 0x77, ASR_ext)
+DISPATCH(0, 0x78, ASL_LSL_ext)
+DISPATCH(0, 0x79, ROL_ext)
+DISPATCH(0, 0x7A, DEC_ext)
+DISPATCH(0, 0x7B, XXX)
+DISPATCH(0, 0x7C, INC_ext)
+DISPATCH(0, 0x7D, TST_ext)
+DISPATCH(0, 0x7E, JMP_ext)
+DISPATCH(0, 0x7F, CLR_ext)
+DISPATCH(0, 0x80, SUBA_imm)
+DISPATCH(0, 0x81, CMPA_imm)
+DISPATCH(0, 0x82, SBCA_imm)
+DISPATCH(0, 0x83, SUBD_imm)
+DISPATCH(0, 0x84, ANDA_imm)
+DISPATCH(0, 0x85, BITA_imm)
+DISPATCH(0, 0x86, LDA_imm)
+DISPATCH(0, 0x87, XXX)
+DISPATCH(0, 0x88, EORA_imm)
+DISPATCH(0, 0x89, ADCA_imm)
+DISPATCH(0, 0x8A, ORA_imm)
+DISPATCH(0, 0x8B, ADDA_imm)
+DISPATCH(0, 0x8C, CMPX_imm)
+DISPATCH(0, 0x8D, BSR_rel)
+DISPATCH(0, 0x8E, LDX_imm)
+DISPATCH(0, 0x8F, XXX)
+DISPATCH(0, 0x90, SUBA_dir)
+DISPATCH(0, 0x91, CMPA_dir)
+DISPATCH(0, 0x92, SBCA_dir)
+DISPATCH(0, 0x93, SUBD_dir)
+DISPATCH(0, 0x94, ANDA_dir)
+DISPATCH(0, 0x95, BITA_dir)
+DISPATCH(0, 0x96, LDA_dir)
+DISPATCH(0, 0x97, STA_dir)
+DISPATCH(0, 0x98, EORA_dir)
+DISPATCH(0, 0x99, ADCA_dir)
+DISPATCH(0, 0x9A, ORA_dir)
+DISPATCH(0, 0x9B, ADDA_dir)
+DISPATCH(0, 0x9C, CMPX_dir)
+DISPATCH(0, 0x9D, JSR_dir)
+DISPATCH(0, 0x9E, LDX_dir)
+DISPATCH(0, 0x9F, STX_dir)
+DISPATCH(0, 0xA0, SUBA_idx)
+DISPATCH(0, 0xA1, CMPA_idx)
+DISPATCH(0, 0xA2, SBCA_idx)
+DISPATCH(0, 0xA3, SUBD_idx)
+DISPATCH(0, 0xA4, ANDA_idx)
+DISPATCH(0, 0xA5, BITA_idx)
+DISPATCH(0, 0xA6, LDA_idx)
+DISPATCH(0, 0xA7, STA_idx)
+DISPATCH(0, 0xA8, EORA_idx)
+DISPATCH(0, 0xA9, ADCA_idx)
+DISPATCH(0, 0xAA, ORA_idx)
+DISPATCH(0, 0xAB, ADDA_idx)
+DISPATCH(0, 0xAC, CMPX_idx)
+DISPATCH(0, 0xAD, JSR_idx)
+DISPATCH(0, 0xAE, LDX_idx)
+DISPATCH(0, 0xAF, STX_idx)
+DISPATCH(0, 0xB0, SUBA_ext)
+DISPATCH(0, 0xB1, CMPA_ext)
+DISPATCH(0, 0xB2, SBCA_ext)
+DISPATCH(0, 0xB3, SUBD_ext)
+DISPATCH(0, 0xB4, ANDA_ext)
+DISPATCH(0, 0xB5, BITA_ext)
+DISPATCH(0, 0xB6, LDA_ext)
+DISPATCH(0, 0xB7, STA_ext)
+DISPATCH(0, 0xB8, EORA_ext)
+DISPATCH(0, 0xB9, ADCA_ext)
+DISPATCH(0, 0xBA, ORA_ext)
+DISPATCH(0, 0xBB, ADDA_ext)
+DISPATCH(0, 0xBC, CMPX_ext)
+DISPATCH(0, 0xBD, JSR_ext)
+DISPATCH(0, 0xBE, LDX_ext)
+DISPATCH(0, 0xBF, STX_ext)
+DISPATCH(0, 0xC0, SUBB_imm)
+DISPATCH(0, 0xC1, CMPB_imm)
+DISPATCH(0, 0xC2, SBCB_imm)
+DISPATCH(0, 0xC3, ADDD_imm)
+DISPATCH(0, 0xC4, ANDB_imm)
+DISPATCH(0, 0xC5, BITB_imm)
+DISPATCH(0, 0xC6, LDB_imm)
+DISPATCH(0, 0xC7, XXX)
+DISPATCH(0, 0xC8, EORB_imm)
+DISPATCH(0, 0xC9, ADCB_imm)
+DISPATCH(0, 0xCA, ORB_imm)
+DISPATCH(0, 0xCB, ADDB_imm)
+DISPATCH(0, 0xCC, LDD_imm)
+DISPATCH(0, 0xCD, XXX)
+DISPATCH(0, 0xCE, LDU_imm)
+DISPATCH(0, 0xCF, XXX)
+DISPATCH(0, 0xD0, SUBB_dir)
+DISPATCH(0, 0xD1, CMPB_dir)
+DISPATCH(0, 0xD2, SBCB_dir)
+DISPATCH(0, 0xD3, ADDD_dir)
+DISPATCH(0, 0xD4, ANDB_dir)
+DISPATCH(0, 0xD5, BITB_dir)
+DISPATCH(0, 0xD6, LDB_dir)
+DISPATCH(0, 0xD7, STB_dir)
+DISPATCH(0, 0xD8, EORB_dir)
+DISPATCH(0, 0xD9, ADCB_dir)
+DISPATCH(0, 0xDA, ORB_dir)
+DISPATCH(0, 0xDB, ADDB_dir)
+DISPATCH(0, 0xDC, LDD_dir)
+DISPATCH(0, 0xDD, STD_dir)
+DISPATCH(0, 0xDE, LDU_dir)
+DISPATCH(0, 0xDF, STU_dir)
+DISPATCH(0, 0xE0, SUBB_idx)
+DISPATCH(0, 0xE1, CMPB_idx)
+DISPATCH(0, 0xE2, SBCB_idx)
+DISPATCH(0, 0xE3, ADDD_idx)
+DISPATCH(0, 0xE4, ANDB_idx)
+DISPATCH(0, 0xE5, BITB_idx)
+DISPATCH(0, 0xE6, LDB_idx)
+DISPATCH(0, 0xE7, STB_idx)
+DISPATCH(0, 0xE8, EORB_idx)
+DISPATCH(0, 0xE9, ADCB_idx)
+DISPATCH(0, 0xEA, ORB_idx)
+DISPATCH(0, 0xEB, ADDB_idx)
+DISPATCH(0, 0xEC, LDD_idx)
+DISPATCH(0, 0xED, STD_idx)
+DISPATCH(0, 0xEE, LDU_idx)
+DISPATCH(0, 0xEF, STU_idx)
+DISPATCH(0, 0xF0, SUBB_ext)
+DISPATCH(0, 0xF1, CMPB_ext)
+DISPATCH(0, 0xF2, SBCB_ext)
+DISPATCH(0, 0xF3, ADDD_ext)
+DISPATCH(0, 0xF4, ANDB_ext)
+DISPATCH(0, 0xF5, BITB_ext)
+DISPATCH(0, 0xF6, LDB_ext)
+DISPATCH(0, 0xF7, STB_ext)
+DISPATCH(0, 0xF8, EORB_ext)
+DISPATCH(0, 0xF9, ADCB_ext)
+DISPATCH(0, 0xFA, ORB_ext)
+DISPATCH(0, 0xFB, ADDB_ext)
+DISPATCH(0, 0xFC, LDD_ext)
+DISPATCH(0, 0xFD, STD_ext)
+DISPATCH(0, 0xFE, LDU_ext)
+DISPATCH(0, 0xFF, STU_ext)
+
+// page 2 - $10 prefix
+DISPATCH(1, 0x00, XXX)
+DISPATCH(1, 0x01, XXX)
+DISPATCH(1, 0x02, XXX)
+DISPATCH(1, 0x03, XXX)
+DISPATCH(1, 0x04, XXX)
+DISPATCH(1, 0x05, XXX)
+DISPATCH(1, 0x06, XXX)
+DISPATCH(1, 0x07, XXX)
+DISPATCH(1, 0x08, XXX)
+DISPATCH(1, 0x09, XXX)
+DISPATCH(1, 0x0A, XXX)
+DISPATCH(1, 0x0B, XXX)
+DISPATCH(1, 0x0C, XXX)
+DISPATCH(1, 0x0D, XXX)
+DISPATCH(1, 0x0E, XXX)
+DISPATCH(1, 0x0F, XXX)
+DISPATCH(1, 0x10, XXX)
+DISPATCH(1, 0x11, XXX)
+DISPATCH(1, 0x12, XXX)
+DISPATCH(1, 0x13, XXX)
+DISPATCH(1, 0x14, XXX)
+DISPATCH(1, 0x15, XXX)
+DISPATCH(1, 0x16, XXX)
+DISPATCH(1, 0x17, XXX)
+DISPATCH(1, 0x18, XXX)
+DISPATCH(1, 0x19, XXX)
+DISPATCH(1, 0x1A, XXX)
+DISPATCH(1, 0x1B, XXX)
+DISPATCH(1, 0x1C, XXX)
+DISPATCH(1, 0x1D, XXX)
+DISPATCH(1, 0x1E, XXX)
+DISPATCH(1, 0x1F, XXX)
+DISPATCH(1, 0x20, XXX)
+DISPATCH(1, 0x21, LBRN_rel)
+DISPATCH(1, 0x22, LBHI_rel)
+DISPATCH(1, 0x23, LBLS_rel)
+DISPATCH(1, 0x24, LBHS_LBCC_rel)
+DISPATCH(1, 0x25, LBCS_LBLO_rel)
+DISPATCH(1, 0x26, LBNE_rel)
+DISPATCH(1, 0x27, LBEQ_rel)
+DISPATCH(1, 0x28, LBVC_rel)
+DISPATCH(1, 0x29, LBVS_rel)
+DISPATCH(1, 0x2A, LBPL_rel)
+DISPATCH(1, 0x2B, LBMI_rel)
+DISPATCH(1, 0x2C, LBGE_rel)
+DISPATCH(1, 0x2D, LBLT_rel)
+DISPATCH(1, 0x2E, LBGT_rel)
+DISPATCH(1, 0x2F, LBLE_rel)
+DISPATCH(1, 0x30, XXX)
+DISPATCH(1, 0x31, XXX)
+DISPATCH(1, 0x32, XXX)
+DISPATCH(1, 0x33, XXX)
+DISPATCH(1, 0x34, XXX)
+DISPATCH(1, 0x35, XXX)
+DISPATCH(1, 0x36, XXX)
+DISPATCH(1, 0x37, XXX)
+DISPATCH(1, 0x38, XXX)
+DISPATCH(1, 0x39, XXX)
+DISPATCH(1, 0x3A, XXX)
+DISPATCH(1, 0x3B, XXX)
+DISPATCH(1, 0x3C, XXX)
+DISPATCH(1, 0x3D, XXX)
+DISPATCH(1, 0x3E, XXX)
+DISPATCH(1, 0x3F, SWI2_inh)
+DISPATCH(1, 0x40, XXX)
+DISPATCH(1, 0x41, XXX)
+DISPATCH(1, 0x42, XXX)
+DISPATCH(1, 0x43, XXX)
+DISPATCH(1, 0x44, XXX)
+DISPATCH(1, 0x45, XXX)
+DISPATCH(1, 0x46, XXX)
+DISPATCH(1, 0x47, XXX)
+DISPATCH(1, 0x48, XXX)
+DISPATCH(1, 0x49, XXX)
+DISPATCH(1, 0x4A, XXX)
+DISPATCH(1, 0x4B, XXX)
+DISPATCH(1, 0x4C, XXX)
+DISPATCH(1, 0x4D, XXX)
+DISPATCH(1, 0x4E, XXX)
+DISPATCH(1, 0x4F, XXX)
+DISPATCH(1, 0x50, XXX)
+DISPATCH(1, 0x51, XXX)
+DISPATCH(1, 0x52, XXX)
+DISPATCH(1, 0x53, XXX)
+DISPATCH(1, 0x54, XXX)
+DISPATCH(1, 0x55, XXX)
+DISPATCH(1, 0x56, XXX)
+DISPATCH(1, 0x57, XXX)
+DISPATCH(1, 0x58, XXX)
+DISPATCH(1, 0x59, XXX)
+DISPATCH(1, 0x5A, XXX)
+DISPATCH(1, 0x5B, XXX)
+DISPATCH(1, 0x5C, XXX)
+DISPATCH(1, 0x5D, XXX)
+DISPATCH(1, 0x5E, XXX)
+DISPATCH(1, 0x5F, XXX)
+DISPATCH(1, 0x60, XXX)
+DISPATCH(1, 0x61, XXX)
+DISPATCH(1, 0x62, XXX)
+DISPATCH(1, 0x63, XXX)
+DISPATCH(1, 0x64, XXX)
+DISPATCH(1, 0x65, XXX)
+DISPATCH(1, 0x66, XXX)
+DISPATCH(1, 0x67, XXX)
+DISPATCH(1, 0x68, XXX)
+DISPATCH(1, 0x69, XXX)
+DISPATCH(1, 0x6A, XXX)
+DISPATCH(1, 0x6B, XXX)
+DISPATCH(1, 0x6C, XXX)
+DISPATCH(1, 0x6D, XXX)
+DISPATCH(1, 0x6E, XXX)
+DISPATCH(1, 0x6F, XXX)
+DISPATCH(1, 0x70, XXX)
+DISPATCH(1, 0x71, XXX)
+DISPATCH(1, 0x72, XXX)
+DISPATCH(1, 0x73, XXX)
+DISPATCH(1, 0x74, XXX)
+DISPATCH(1, 0x75, XXX)
+DISPATCH(1, 0x76, XXX)
+DISPATCH(1, 0x77, XXX)
+DISPATCH(1, 0x78, XXX)
+DISPATCH(1, 0x79, XXX)
+DISPATCH(1, 0x7A, XXX)
+DISPATCH(1, 0x7B, XXX)
+DISPATCH(1, 0x7C, XXX)
+DISPATCH(1, 0x7D, XXX)
+DISPATCH(1, 0x7E, XXX)
+DISPATCH(1, 0x7F, XXX)
+DISPATCH(1, 0x80, XXX)
+DISPATCH(1, 0x81, XXX)
+DISPATCH(1, 0x82, XXX)
+DISPATCH(1, 0x83, CMPD_imm)
+DISPATCH(1, 0x84, XXX)
+DISPATCH(1, 0x85, XXX)
+DISPATCH(1, 0x86, XXX)
+DISPATCH(1, 0x87, XXX)
+DISPATCH(1, 0x88, XXX)
+DISPATCH(1, 0x89, XXX)
+DISPATCH(1, 0x8A, XXX)
+DISPATCH(1, 0x8B, XXX)
+DISPATCH(1, 0x8C, CMPY_imm)
+DISPATCH(1, 0x8D, XXX)
+DISPATCH(1, 0x8E, LDY_imm)
+DISPATCH(1, 0x8F, XXX)
+DISPATCH(1, 0x90, XXX)
+DISPATCH(1, 0x91, XXX)
+DISPATCH(1, 0x92, XXX)
+DISPATCH(1, 0x93, CMPD_dir)
+DISPATCH(1, 0x94, XXX)
+DISPATCH(1, 0x95, XXX)
+DISPATCH(1, 0x96, XXX)
+DISPATCH(1, 0x97, XXX)
+DISPATCH(1, 0x98, XXX)
+DISPATCH(1, 0x99, XXX)
+DISPATCH(1, 0x9A, XXX)
+DISPATCH(1, 0x9B, XXX)
+DISPATCH(1, 0x9C, CMPY_dir)
+DISPATCH(1, 0x9D, XXX)
+DISPATCH(1, 0x9E, LDY_dir)
+DISPATCH(1, 0x9F, STY_dir)
+DISPATCH(1, 0xA0, XXX)
+DISPATCH(1, 0xA1, XXX)
+DISPATCH(1, 0xA2, XXX)
+DISPATCH(1, 0xA3, CMPD_idx)
+DISPATCH(1, 0xA4, XXX)
+DISPATCH(1, 0xA5, XXX)
+DISPATCH(1, 0xA6, XXX)
+DISPATCH(1, 0xA7, XXX)
+DISPATCH(1, 0xA8, XXX)
+DISPATCH(1, 0xA9, XXX)
+DISPATCH(1, 0xAA, XXX)
+DISPATCH(1, 0xAB, XXX)
+DISPATCH(1, 0xAC, CMPY_idx)
+DISPATCH(1, 0xAD, XXX)
+DISPATCH(1, 0xAE, LDY_idx)
+DISPATCH(1, 0xAF, STY_idx)
+DISPATCH(1, 0xB0, XXX)
+DISPATCH(1, 0xB1, XXX)
+DISPATCH(1, 0xB2, XXX)
+DISPATCH(1, 0xB3, CMPD_ext)
+DISPATCH(1, 0xB4, XXX)
+DISPATCH(1, 0xB5, XXX)
+DISPATCH(1, 0xB6, XXX)
+DISPATCH(1, 0xB7, XXX)
+DISPATCH(1, 0xB8, XXX)
+DISPATCH(1, 0xB9, XXX)
+DISPATCH(1, 0xBA, XXX)
+DISPATCH(1, 0xBB, XXX)
+DISPATCH(1, 0xBC, CMPY_ext)
+DISPATCH(1, 0xBD, XXX)
+DISPATCH(1, 0xBE, LDY_ext)
+DISPATCH(1, 0xBF, STY_ext)
+DISPATCH(1, 0xC0, XXX)
+DISPATCH(1, 0xC1, XXX)
+DISPATCH(1, 0xC2, XXX)
+DISPATCH(1, 0xC3, XXX)
+DISPATCH(1, 0xC4, XXX)
+DISPATCH(1, 0xC5, XXX)
+DISPATCH(1, 0xC6, XXX)
+DISPATCH(1, 0xC7, XXX)
+DISPATCH(1, 0xC8, XXX)
+DISPATCH(1, 0xC9, XXX)
+DISPATCH(1, 0xCA, XXX)
+DISPATCH(1, 0xCB, XXX)
+DISPATCH(1, 0xCC, XXX)
+DISPATCH(1, 0xCD, XXX)
+DISPATCH(1, 0xCE, LDS_imm)
+DISPATCH(1, 0xCF, XXX)
+DISPATCH(1, 0xD0, XXX)
+DISPATCH(1, 0xD1, XXX)
+DISPATCH(1, 0xD2, XXX)
+DISPATCH(1, 0xD3, XXX)
+DISPATCH(1, 0xD4, XXX)
+DISPATCH(1, 0xD5, XXX)
+DISPATCH(1, 0xD6, XXX)
+DISPATCH(1, 0xD7, XXX)
+DISPATCH(1, 0xD8, XXX)
+DISPATCH(1, 0xD9, XXX)
+DISPATCH(1, 0xDA, XXX)
+DISPATCH(1, 0xDB, XXX)
+DISPATCH(1, 0xDC, XXX)
+DISPATCH(1, 0xDD, XXX)
+DISPATCH(1, 0xDE, LDS_dir)
+DISPATCH(1, 0xDF, STS_dir)
+DISPATCH(1, 0xE0, XXX)
+DISPATCH(1, 0xE1, XXX)
+DISPATCH(1, 0xE2, XXX)
+DISPATCH(1, 0xE3, XXX)
+DISPATCH(1, 0xE4, XXX)
+DISPATCH(1, 0xE5, XXX)
+DISPATCH(1, 0xE6, XXX)
+DISPATCH(1, 0xE7, XXX)
+DISPATCH(1, 0xE8, XXX)
+DISPATCH(1, 0xE9, XXX)
+DISPATCH(1, 0xEA, XXX)
+DISPATCH(1, 0xEB, XXX)
+DISPATCH(1, 0xEC, XXX)
+DISPATCH(1, 0xED, XXX)
+DISPATCH(1, 0xEE, LDS_idx)
+DISPATCH(1, 0xEF, STS_idx)
+DISPATCH(1, 0xF0, XXX)
+DISPATCH(1, 0xF1, XXX)
+DISPATCH(1, 0xF2, XXX)
+DISPATCH(1, 0xF3, XXX)
+DISPATCH(1, 0xF4, XXX)
+DISPATCH(1, 0xF5, XXX)
+DISPATCH(1, 0xF6, XXX)
+DISPATCH(1, 0xF7, XXX)
+DISPATCH(1, 0xF8, XXX)
+DISPATCH(1, 0xF9, XXX)
+DISPATCH(1, 0xFA, XXX)
+DISPATCH(1, 0xFB, XXX)
+DISPATCH(1, 0xFC, XXX)
+DISPATCH(1, 0xFD, XXX)
+DISPATCH(1, 0xFE, LDS_ext)
+DISPATCH(1, 0xFF, STS_ext)
+
+// page 3 - $11 prefix
+DISPATCH(2, 0x00, XXX)
+DISPATCH(2, 0x01, XXX)
+DISPATCH(2, 0x02, XXX)
+DISPATCH(2, 0x03, XXX)
+DISPATCH(2, 0x04, XXX)
+DISPATCH(2, 0x05, XXX)
+DISPATCH(2, 0x06, XXX)
+DISPATCH(2, 0x07, XXX)
+DISPATCH(2, 0x08, XXX)
+DISPATCH(2, 0x09, XXX)
+DISPATCH(2, 0x0A, XXX)
+DISPATCH(2, 0x0B, XXX)
+DISPATCH(2, 0x0C, XXX)
+DISPATCH(2, 0x0D, XXX)
+DISPATCH(2, 0x0E, XXX)
+DISPATCH(2, 0x0F, XXX)
+DISPATCH(2, 0x10, XXX)
+DISPATCH(2, 0x11, XXX)
+DISPATCH(2, 0x12, XXX)
+DISPATCH(2, 0x13, XXX)
+DISPATCH(2, 0x14, XXX)
+DISPATCH(2, 0x15, XXX)
+DISPATCH(2, 0x16, XXX)
+DISPATCH(2, 0x17, XXX)
+DISPATCH(2, 0x18, XXX)
+DISPATCH(2, 0x19, XXX)
+DISPATCH(2, 0x1A, XXX)
+DISPATCH(2, 0x1B, XXX)
+DISPATCH(2, 0x1C, XXX)
+DISPATCH(2, 0x1D, XXX)
+DISPATCH(2, 0x1E, XXX)
+DISPATCH(2, 0x1F, XXX)
+DISPATCH(2, 0x20, XXX)
+DISPATCH(2, 0x21, XXX)
+DISPATCH(2, 0x22, XXX)
+DISPATCH(2, 0x23, XXX)
+DISPATCH(2, 0x24, XXX)
+DISPATCH(2, 0x25, XXX)
+DISPATCH(2, 0x26, XXX)
+DISPATCH(2, 0x27, XXX)
+DISPATCH(2, 0x28, XXX)
+DISPATCH(2, 0x29, XXX)
+DISPATCH(2, 0x2A, XXX)
+DISPATCH(2, 0x2B, XXX)
+DISPATCH(2, 0x2C, XXX)
+DISPATCH(2, 0x2D, XXX)
+DISPATCH(2, 0x2E, XXX)
+DISPATCH(2, 0x2F, XXX)
+DISPATCH(2, 0x30, XXX)
+DISPATCH(2, 0x31, XXX)
+DISPATCH(2, 0x32, XXX)
+DISPATCH(2, 0x33, XXX)
+DISPATCH(2, 0x34, XXX)
+DISPATCH(2, 0x35, XXX)
+DISPATCH(2, 0x36, XXX)
+DISPATCH(2, 0x37, XXX)
+DISPATCH(2, 0x38, XXX)
+DISPATCH(2, 0x39, XXX)
+DISPATCH(2, 0x3A, XXX)
+DISPATCH(2, 0x3B, XXX)
+DISPATCH(2, 0x3C, XXX)
+DISPATCH(2, 0x3D, XXX)
+DISPATCH(2, 0x3E, XXX)
+DISPATCH(2, 0x3F, SWI3_inh)
+DISPATCH(2, 0x40, XXX)
+DISPATCH(2, 0x41, XXX)
+DISPATCH(2, 0x42, XXX)
+DISPATCH(2, 0x43, XXX)
+DISPATCH(2, 0x44, XXX)
+DISPATCH(2, 0x45, XXX)
+DISPATCH(2, 0x46, XXX)
+DISPATCH(2, 0x47, XXX)
+DISPATCH(2, 0x48, XXX)
+DISPATCH(2, 0x49, XXX)
+DISPATCH(2, 0x4A, XXX)
+DISPATCH(2, 0x4B, XXX)
+DISPATCH(2, 0x4C, XXX)
+DISPATCH(2, 0x4D, XXX)
+DISPATCH(2, 0x4E, XXX)
+DISPATCH(2, 0x4F, XXX)
+DISPATCH(2, 0x50, XXX)
+DISPATCH(2, 0x51, XXX)
+DISPATCH(2, 0x52, XXX)
+DISPATCH(2, 0x53, XXX)
+DISPATCH(2, 0x54, XXX)
+DISPATCH(2, 0x55, XXX)
+DISPATCH(2, 0x56, XXX)
+DISPATCH(2, 0x57, XXX)
+DISPATCH(2, 0x58, XXX)
+DISPATCH(2, 0x59, XXX)
+DISPATCH(2, 0x5A, XXX)
+DISPATCH(2, 0x5B, XXX)
+DISPATCH(2, 0x5C, XXX)
+DISPATCH(2, 0x5D, XXX)
+DISPATCH(2, 0x5E, XXX)
+DISPATCH(2, 0x5F, XXX)
+DISPATCH(2, 0x60, XXX)
+DISPATCH(2, 0x61, XXX)
+DISPATCH(2, 0x62, XXX)
+DISPATCH(2, 0x63, XXX)
+DISPATCH(2, 0x64, XXX)
+DISPATCH(2, 0x65, XXX)
+DISPATCH(2, 0x66, XXX)
+DISPATCH(2, 0x67, XXX)
+DISPATCH(2, 0x68, XXX)
+DISPATCH(2, 0x69, XXX)
+DISPATCH(2, 0x6A, XXX)
+DISPATCH(2, 0x6B, XXX)
+DISPATCH(2, 0x6C, XXX)
+DISPATCH(2, 0x6D, XXX)
+DISPATCH(2, 0x6E, XXX)
+DISPATCH(2, 0x6F, XXX)
+DISPATCH(2, 0x70, XXX)
+DISPATCH(2, 0x71, XXX)
+DISPATCH(2, 0x72, XXX)
+DISPATCH(2, 0x73, XXX)
+DISPATCH(2, 0x74, XXX)
+DISPATCH(2, 0x75, XXX)
+DISPATCH(2, 0x76, XXX)
+DISPATCH(2, 0x77, XXX)
+DISPATCH(2, 0x78, XXX)
+DISPATCH(2, 0x79, XXX)
+DISPATCH(2, 0x7A, XXX)
+DISPATCH(2, 0x7B, XXX)
+DISPATCH(2, 0x7C, XXX)
+DISPATCH(2, 0x7D, XXX)
+DISPATCH(2, 0x7E, XXX)
+DISPATCH(2, 0x7F, XXX)
+DISPATCH(2, 0x80, XXX)
+DISPATCH(2, 0x81, XXX)
+DISPATCH(2, 0x82, XXX)
+DISPATCH(2, 0x83, CMPU_imm)
+DISPATCH(2, 0x84, XXX)
+DISPATCH(2, 0x85, XXX)
+DISPATCH(2, 0x86, XXX)
+DISPATCH(2, 0x87, XXX)
+DISPATCH(2, 0x88, XXX)
+DISPATCH(2, 0x89, XXX)
+DISPATCH(2, 0x8A, XXX)
+DISPATCH(2, 0x8B, XXX)
+DISPATCH(2, 0x8C, CMPS_imm)
+DISPATCH(2, 0x8D, XXX)
+DISPATCH(2, 0x8E, XXX)
+DISPATCH(2, 0x8F, XXX)
+DISPATCH(2, 0x90, XXX)
+DISPATCH(2, 0x91, XXX)
+DISPATCH(2, 0x92, XXX)
+DISPATCH(2, 0x93, CMPU_dir)
+DISPATCH(2, 0x94, XXX)
+DISPATCH(2, 0x95, XXX)
+DISPATCH(2, 0x96, XXX)
+DISPATCH(2, 0x97, XXX)
+DISPATCH(2, 0x98, XXX)
+DISPATCH(2, 0x99, XXX)
+DISPATCH(2, 0x9A, XXX)
+DISPATCH(2, 0x9B, XXX)
+DISPATCH(2, 0x9C, CMPS_dir)
+DISPATCH(2, 0x9D, XXX)
+DISPATCH(2, 0x9E, XXX)
+DISPATCH(2, 0x9F, XXX)
+DISPATCH(2, 0xA0, XXX)
+DISPATCH(2, 0xA1, XXX)
+DISPATCH(2, 0xA2, XXX)
+DISPATCH(2, 0xA3, CMPU_idx)
+DISPATCH(2, 0xA4, XXX)
+DISPATCH(2, 0xA5, XXX)
+DISPATCH(2, 0xA6, XXX)
+DISPATCH(2, 0xA7, XXX)
+DISPATCH(2, 0xA8, XXX)
+DISPATCH(2, 0xA9, XXX)
+DISPATCH(2, 0xAA, XXX)
+DISPATCH(2, 0xAB, XXX)
+DISPATCH(2, 0xAC, CMPS_idx)
+DISPATCH(2, 0xAD, XXX)
+DISPATCH(2, 0xAE, XXX)
+DISPATCH(2, 0xAF, XXX)
+DISPATCH(2, 0xB0, XXX)
+DISPATCH(2, 0xB1, XXX)
+DISPATCH(2, 0xB2, XXX)
+DISPATCH(2, 0xB3, CMPU_ext)
+DISPATCH(2, 0xB4, XXX)
+DISPATCH(2, 0xB5, XXX)
+DISPATCH(2, 0xB6, XXX)
+DISPATCH(2, 0xB7, XXX)
+DISPATCH(2, 0xB8, XXX)
+DISPATCH(2, 0xB9, XXX)
+DISPATCH(2, 0xBA, XXX)
+DISPATCH(2, 0xBB, XXX)
+DISPATCH(2, 0xBC, CMPS_ext)
+DISPATCH(2, 0xBD, XXX)
+DISPATCH(2, 0xBE, XXX)
+DISPATCH(2, 0xBF, XXX)
+DISPATCH(2, 0xC0, XXX)
+DISPATCH(2, 0xC1, XXX)
+DISPATCH(2, 0xC2, XXX)
+DISPATCH(2, 0xC3, XXX)
+DISPATCH(2, 0xC4, XXX)
+DISPATCH(2, 0xC5, XXX)
+DISPATCH(2, 0xC6, XXX)
+DISPATCH(2, 0xC7, XXX)
+DISPATCH(2, 0xC8, XXX)
+DISPATCH(2, 0xC9, XXX)
+DISPATCH(2, 0xCA, XXX)
+DISPATCH(2, 0xCB, XXX)
+DISPATCH(2, 0xCC, XXX)
+DISPATCH(2, 0xCD, XXX)
+DISPATCH(2, 0xCE, XXX)
+DISPATCH(2, 0xCF, XXX)
+DISPATCH(2, 0xD0, XXX)
+DISPATCH(2, 0xD1, XXX)
+DISPATCH(2, 0xD2, XXX)
+DISPATCH(2, 0xD3, XXX)
+DISPATCH(2, 0xD4, XXX)
+DISPATCH(2, 0xD5, XXX)
+DISPATCH(2, 0xD6, XXX)
+DISPATCH(2, 0xD7, XXX)
+DISPATCH(2, 0xD8, XXX)
+DISPATCH(2, 0xD9, XXX)
+DISPATCH(2, 0xDA, XXX)
+DISPATCH(2, 0xDB, XXX)
+DISPATCH(2, 0xDC, XXX)
+DISPATCH(2, 0xDD, XXX)
+DISPATCH(2, 0xDE, XXX)
+DISPATCH(2, 0xDF, XXX)
+DISPATCH(2, 0xE0, XXX)
+DISPATCH(2, 0xE1, XXX)
+DISPATCH(2, 0xE2, XXX)
+DISPATCH(2, 0xE3, XXX)
+DISPATCH(2, 0xE4, XXX)
+DISPATCH(2, 0xE5, XXX)
+DISPATCH(2, 0xE6, XXX)
+DISPATCH(2, 0xE7, XXX)
+DISPATCH(2, 0xE8, XXX)
+DISPATCH(2, 0xE9, XXX)
+DISPATCH(2, 0xEA, XXX)
+DISPATCH(2, 0xEB, XXX)
+DISPATCH(2, 0xEC, XXX)
+DISPATCH(2, 0xED, XXX)
+DISPATCH(2, 0xEE, XXX)
+DISPATCH(2, 0xEF, XXX)
+DISPATCH(2, 0xF0, XXX)
+DISPATCH(2, 0xF1, XXX)
+DISPATCH(2, 0xF2, XXX)
+DISPATCH(2, 0xF3, XXX)
+DISPATCH(2, 0xF4, XXX)
+DISPATCH(2, 0xF5, XXX)
+DISPATCH(2, 0xF6, XXX)
+DISPATCH(2, 0xF7, XXX)
+DISPATCH(2, 0xF8, XXX)
+DISPATCH(2, 0xF9, XXX)
+DISPATCH(2, 0xFA, XXX)
+DISPATCH(2, 0xFB, XXX)
+DISPATCH(2, 0xFC, XXX)
+DISPATCH(2, 0xFD, XXX)
+DISPATCH(2, 0xFE, XXX)
+DISPATCH(2, 0xFF, XXX)
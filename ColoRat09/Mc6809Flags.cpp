@@ -0,0 +1,48 @@
+/******************************************************************************
+*		   File: Mc6809Flags.cpp
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/14
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+//	Compile-time condition code table for the 8 bit ALU.
+//
+//	The table is evaluated by the compiler (128K entries), the MSVC projects
+// raise /constexpr:steps for this file.
+//*****************************************************************************
+#include "Mc6809.h"
+
+
+//*****************************************************************************
+//	FLAGTABLE()
+//*****************************************************************************
+//	H N Z V C for reg + data + carry, indexed [carry][reg][data]
+//*****************************************************************************
+constexpr Mc6809::FLAGTABLE::FLAGTABLE() : add()
+{
+	for (uint16_t carry = 0; carry < 2; ++carry)
+	{
+		for (uint16_t reg = 0; reg < 256; ++reg)
+		{
+			for (uint16_t data = 0; data < 256; ++data)
+			{
+				uint16_t result = reg + data + carry;
+				uint8_t flags = 0;
+
+				flags |= (((reg ^ data ^ result) & 0x10) != 0) ? CC::H : 0;
+				flags |= ((result & 0x80) != 0) ? CC::N : 0;
+				flags |= ((result & 0xff) == 0) ? CC::Z : 0;
+				flags |= (((reg ^ result) & (data ^ result) & 0x80) != 0) ? CC::V : 0;
+				flags |= ((result & 0x100) != 0) ? CC::C : 0;
+
+				add[carry][reg][data] = flags;
+			}
+		}
+	}
+}
+
+
+constexpr Mc6809::FLAGTABLE Mc6809::AluFlags;
@@ -0,0 +1,2026 @@
+/******************************************************************************
+*		   File: Mc6809OpCodes.cpp
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/14
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+//	GENERATED FILE - DO NOT EDIT.
+//
+//	Built by GenOpCodes.py from Opcodes_p1.csv, Opcodes_p2.csv and
+// Opcodes_p3.csv. Edit the sheets and re-run the script instead.
+//*****************************************************************************
+#include "Mc6809.h"
+
+using op = Mc6809;
+
+
+//*****************************************************************************
+//	OpCode[page][opcode]
+//*****************************************************************************
+//	Hot dispatch table: handler, min cycles, max cycles, program bytes.
+//	max cycles: 99 = variable (post byte dependent), 0 = open ended
+//*****************************************************************************
+constexpr Mc6809::OPCODE Mc6809::OpCode[3][256] =
+{
+	{	// page 1
+		{ &op::NEG_dir        ,  6,  6, 2 },	// $00 NEG
+		{ &op::XXX            ,  1,  1, 1 },	// $01 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $02 ???
+		{ &op::COM_dir        ,  6,  6, 2 },	// $03 COM
+		{ &op::LSR_dir        ,  6,  6, 2 },	// $04 LSR
+		{ &op::XXX            ,  1,  1, 1 },	// $05 ???
+		{ &op::ROR_dir        ,  6,  6, 2 },	// $06 ROR
+		{ &op::ASR_dir        ,  6,  6, 2 },	// $07 ASR
+		{ &op::ASL_LSL_dir    ,  6,  6, 2 },	// $08 ASL/LSL
+		{ &op::ROL_dir        ,  6,  6, 2 },	// $09 ROL
+		{ &op::DEC_dir        ,  6,  6, 2 },	// $0A DEC
+		{ &op::XXX            ,  1,  1, 1 },	// $0B ???
+		{ &op::INC_dir        ,  6,  6, 2 },	// $0C INC
+		{ &op::TST_dir        ,  6,  6, 2 },	// $0D TST
+		{ &op::JMP_dir        ,  3,  3, 2 },	// $0E JMP
+		{ &op::CLR_dir        ,  6,  6, 2 },	// $0F CLR
+		{ nullptr             ,  0,  0, 0 },	// $10 ***
+		{ nullptr             ,  0,  0, 0 },	// $11 ***
+		{ &op::NOP_inh        ,  2,  2, 1 },	// $12 NOP
+		{ &op::SYNC_inh       ,  4,  0, 1 },	// $13 SYNC
+		{ &op::XXX            ,  1,  1, 1 },	// $14 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $15 ???
+		{ &op::LBRA_rel       ,  5,  5, 3 },	// $16 LBRA
+		{ &op::LBSR_rel       ,  9,  9, 3 },	// $17 LBSR
+		{ &op::XXX            ,  1,  1, 1 },	// $18 ???
+		{ &op::DAA_inh        ,  2,  2, 1 },	// $19 DAA
+		{ &op::ORCC_imm       ,  3,  3, 2 },	// $1A ORCC
+		{ &op::XXX            ,  1,  1, 1 },	// $1B ???
+		{ &op::ANDCC_imm      ,  3,  3, 2 },	// $1C ANDCC
+		{ &op::SEX_inh        ,  2,  2, 1 },	// $1D SEX
+		{ &op::EXG_imm        ,  8,  8, 2 },	// $1E EXG
+		{ &op::TFR_imm        ,  6,  6, 2 },	// $1F TFR
+		{ &op::BRA_rel        ,  3,  3, 2 },	// $20 BRA
+		{ &op::BRN_rel        ,  3,  3, 2 },	// $21 BRN
+		{ &op::BHI_rel        ,  3,  3, 2 },	// $22 BHI
+		{ &op::BLS_rel        ,  3,  3, 2 },	// $23 BLS
+		{ &op::BHS_BCC_rel    ,  3,  3, 2 },	// $24 BHS/BCC
+		{ &op::BLO_BCS_rel    ,  3,  3, 2 },	// $25 BLO/BCS
+		{ &op::BNE_rel        ,  3,  3, 2 },	// $26 BNE
+		{ &op::BEQ_rel        ,  3,  3, 2 },	// $27 BEQ
+		{ &op::BVC_rel        ,  3,  3, 2 },	// $28 BVC
+		{ &op::BVS_rel        ,  3,  3, 2 },	// $29 BVS
+		{ &op::BPL_rel        ,  3,  3, 2 },	// $2A BPL
+		{ &op::BMI_rel        ,  3,  3, 2 },	// $2B BMI
+		{ &op::BGE_rel        ,  3,  3, 2 },	// $2C BGE
+		{ &op::BLT_rel        ,  3,  3, 2 },	// $2D BLT
+		{ &op::BGT_rel        ,  3,  3, 2 },	// $2E BGT
+		{ &op::BLE_rel        ,  3,  3, 2 },	// $2F BLE
+		{ &op::LEAX_idx       ,  4, 99, 2 },	// $30 LEAX
+		{ &op::LEAY_idx       ,  4, 99, 2 },	// $31 LEAY
+		{ &op::LEAS_idx       ,  4, 99, 2 },	// $32 LEAS
+		{ &op::LEAU_idx       ,  4, 99, 2 },	// $33 LEAU
+		{ &op::PSHS_imm       ,  5, 99, 2 },	// $34 PSHS
+		{ &op::PULS_imm       ,  5, 99, 2 },	// $35 PULS
+		{ &op::PSHU_imm       ,  5, 99, 2 },	// $36 PSHU
+		{ &op::PULU_imm       ,  5, 99, 2 },	// $37 PULU
+		{ &op::XXX            ,  1,  1, 1 },	// $38 ???
+		{ &op::RTS_inh        ,  5,  5, 1 },	// $39 RTS
+		{ &op::ABX_inh        ,  3,  3, 1 },	// $3A ABX
+		{ &op::RTI_inh        ,  6, 15, 1 },	// $3B RTI
+		{ &op::CWAI_inh       , 20,  0, 2 },	// $3C CWAI
+		{ &op::MUL_inh        , 11, 11, 1 },	// $3D MUL
+#ifdef USE_RESET_3E
+		{ &op::RESET_inh      , 19, 19, 1 },	// $3E RESET
+#else
+		{ &op::XXX            ,  1,  1, 1 },	// $3E ???
+#endif
+		{ &op::SWI_inh        , 19, 19, 1 },	// $3F SWI
+		{ &op::NEGA_inh       ,  2,  2, 1 },	// $40 NEGA
+		{ &op::XXX            ,  1,  1, 1 },	// $41 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $42 ???
+		{ &op::COMA_inh       ,  2,  2, 1 },	// $43 COMA
+		{ &op::LSRA_inh       ,  2,  2, 1 },	// $44 LSRA
+		{ &op::XXX            ,  1,  1, 1 },	// $45 ???
+		{ &op::RORA_inh       ,  2,  2, 1 },	// $46 RORA
+		{ &op::ASRA_inh       ,  2,  2, 1 },	// $47 ASRA
+		{ &op::ASLA_LSLA_inh  ,  2,  2, 1 },	// $48 ASLA/LSLA
+		{ &op::ROLA_inh       ,  2,  2, 1 },	// $49 ROLA
+		{ &op::DECA_inh       ,  2,  2, 1 },	// $4A DECA
+		{ &op::XXX            ,  1,  1, 1 },	// $4B ???
+		{ &op::INCA_inh       ,  2,  2, 1 },	// $4C INCA
+		{ &op::TSTA_inh       ,  2,  2, 1 },	// $4D TSTA
+		{ &op::XXX            ,  1,  1, 1 },	// $4E ???
+		{ &op::CLRA_inh       ,  2,  2, 1 },	// $4F CLRA
+		{ &op::NEGB_inh       ,  2,  2, 1 },	// $50 NEGB
+		{ &op::XXX            ,  1,  1, 1 },	// $51 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $52 ???
+		{ &op::COMB_inh       ,  2,  2, 1 },	// $53 COMB
+		{ &op::LSRB_inh       ,  2,  2, 1 },	// $54 LSRB
+		{ &op::XXX            ,  1,  1, 1 },	// $55 ???
+		{ &op::RORB_inh       ,  2,  2, 1 },	// $56 RORB
+		{ &op::ASRB_inh       ,  2,  2, 1 },	// $57 ASRB
+		{ &op::ASLB_LSLB_inh  ,  2,  2, 1 },	// $58 ASLB/LSLB
+		{ &op::ROLB_inh       ,  2,  2, 1 },	// $59 ROLB
+		{ &op::DECB_inh       ,  2,  2, 1 },	// $5A DECB
+		{ &op::XXX            ,  1,  1, 1 },	// $5B ???
+		{ &op::INCB_inh       ,  2,  2, 1 },	// $5C INCB
+		{ &op::TSTB_inh       ,  2,  2, 1 },	// $5D TSTB
+		{ &op::XXX            ,  1,  1, 1 },	// $5E ???
+		{ &op::CLRB_inh       ,  2,  2, 1 },	// $5F CLRB
+		{ &op::NEG_idx        ,  6, 99, 2 },	// $60 NEG
+		{ &op::XXX            ,  1,  1, 1 },	// $61 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $62 ???
+		{ &op::COM_idx        ,  6, 99, 2 },	// $63 COM
+		{ &op::LSR_idx        ,  6, 99, 2 },	// $64 LSR
+		{ &op::XXX            ,  1,  1, 1 },	// $65 ???
+		{ &op::ROR_idx        ,  6, 99, 2 },	// $66 ROR
+		{ &op::ASR_idx        ,  6, 99, 2 },	// $67 ASR
+		{ &op::ASL_LSL_idx    ,  6, 99, 2 },	// $68 ASL/LSL
+		{ &op::ROL_idx        ,  6, 99, 2 },	// $69 ROL
+		{ &op::DEC_idx        ,  6, 99, 2 },	// $6A DEC
+		{ &op::XXX            ,  1,  1, 1 },	// $6B ???
+		{ &op::INC_idx        ,  6, 99, 2 },	// $6C INC
+		{ &op::TST_idx        ,  6, 99, 2 },	// $6D TST
+		{ &op::JMP_idx        ,  3, 99, 2 },	// $6E JMP
+		{ &op::CLR_idx        ,  6, 99, 2 },	// $6F CLR
+		{ &op::NEG_ext        ,  7,  7, 3 },	// $70 NEG
+		{ &op::XXX            ,  1,  1, 1 },	// $71 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $72 ???
+		{ &op::COM_ext        ,  7,  7, 3 },	// $73 COM
+		{ &op::LSR_ext        ,  7,  7, 3 },	// $74 LSR
+		{ &op::XXX            ,  1,  1, 1 },	// $75 ???
+		{ &op::ROR_ext        ,  7,  7, 3 },	// $76 ROR
+		{ &op::ASR_ext        ,  7,  7, 3 },	// $77 ASR
+		{ &op::ASL_LSL_ext    ,  7,  7, 3 },	// $78 ASL/LSL
+		{ &op::ROL_ext        ,  7,  7, 3 },	// $79 ROL
+		{ &op::DEC_ext        ,  7,  7, 3 },	// $7A DEC
+		{ &op::XXX            ,  1,  1, 1 },	// $7B ???
+		{ &op::INC_ext        ,  7,  7, 3 },	// $7C INC
+		{ &op::TST_ext        ,  7,  7, 3 },	// $7D TST
+		{ &op::JMP_ext        ,  4,  4, 3 },	// $7E JMP
+		{ &op::CLR_ext        ,  7,  7, 3 },	// $7F CLR
+		{ &op::SUBA_imm       ,  2,  2, 2 },	// $80 SUBA
+		{ &op::CMPA_imm       ,  2,  2, 2 },	// $81 CMPA
+		{ &op::SBCA_imm       ,  2,  2, 2 },	// $82 SBCA
+		{ &op::SUBD_imm       ,  4,  4, 3 },	// $83 SUBD
+		{ &op::ANDA_imm       ,  2,  2, 2 },	// $84 ANDA
+		{ &op::BITA_imm       ,  2,  2, 2 },	// $85 BITA
+		{ &op::LDA_imm        ,  2,  2, 2 },	// $86 LDA
+		{ &op::XXX            ,  1,  1, 1 },	// $87 ???
+		{ &op::EORA_imm       ,  2,  2, 2 },	// $88 EORA
+		{ &op::ADCA_imm       ,  2,  2, 2 },	// $89 ADCA
+		{ &op::ORA_imm        ,  2,  2, 2 },	// $8A ORA
+		{ &op::ADDA_imm       ,  2,  2, 2 },	// $8B ADDA
+		{ &op::CMPX_imm       ,  4,  4, 3 },	// $8C CMPX
+		{ &op::BSR_rel        ,  7,  7, 2 },	// $8D BSR
+		{ &op::LDX_imm        ,  3,  3, 3 },	// $8E LDX
+		{ &op::XXX            ,  1,  1, 1 },	// $8F ???
+		{ &op::SUBA_dir       ,  4,  4, 2 },	// $90 SUBA
+		{ &op::CMPA_dir       ,  4,  4, 2 },	// $91 CMPA
+		{ &op::SBCA_dir       ,  4,  4, 2 },	// $92 SBCA
+		{ &op::SUBD_dir       ,  6,  6, 2 },	// $93 SUBD
+		{ &op::ANDA_dir       ,  4,  4, 2 },	// $94 ANDA
+		{ &op::BITA_dir       ,  4,  4, 2 },	// $95 BITA
+		{ &op::LDA_dir        ,  4,  4, 2 },	// $96 LDA
+		{ &op::STA_dir        ,  4,  4, 2 },	// $97 STA
+		{ &op::EORA_dir       ,  4,  4, 2 },	// $98 EORA
+		{ &op::ADCA_dir       ,  4,  4, 2 },	// $99 ADCA
+		{ &op::ORA_dir        ,  4,  4, 2 },	// $9A ORA
+		{ &op::ADDA_dir       ,  4,  4, 2 },	// $9B ADDA
+		{ &op::CMPX_dir       ,  6,  6, 2 },	// $9C CMPX
+		{ &op::JSR_dir        ,  7,  7, 2 },	// $9D JSR
+		{ &op::LDX_dir        ,  5,  5, 2 },	// $9E LDX
+		{ &op::STX_dir        ,  5,  5, 2 },	// $9F STX
+		{ &op::SUBA_idx       ,  4, 99, 2 },	// $A0 SUBA
+		{ &op::CMPA_idx       ,  4, 99, 2 },	// $A1 CMPA
+		{ &op::SBCA_idx       ,  4, 99, 2 },	// $A2 SBCA
+		{ &op::SUBD_idx       ,  4, 99, 2 },	// $A3 SUBD
+		{ &op::ANDA_idx       ,  4, 99, 2 },	// $A4 ANDA
+		{ &op::BITA_idx       ,  4, 99, 2 },	// $A5 BITA
+		{ &op::LDA_idx        ,  4, 99, 2 },	// $A6 LDA
+		{ &op::STA_idx        ,  4, 99, 2 },	// $A7 STA
+		{ &op::EORA_idx       ,  4, 99, 2 },	// $A8 EORA
+		{ &op::ADCA_idx       ,  4, 99, 2 },	// $A9 ADCA
+		{ &op::ORA_idx        ,  4, 99, 2 },	// $AA ORA
+		{ &op::ADDA_idx       ,  4, 99, 2 },	// $AB ADDA
+		{ &op::CMPX_idx       ,  6, 99, 2 },	// $AC CMPX
+		{ &op::JSR_idx        ,  7, 99, 2 },	// $AD JSR
+		{ &op::LDX_idx        ,  5, 99, 2 },	// $AE LDX
+		{ &op::STX_idx        ,  5, 99, 2 },	// $AF STX
+		{ &op::SUBA_ext       ,  5,  5, 3 },	// $B0 SUBA
+		{ &op::CMPA_ext       ,  5,  5, 3 },	// $B1 CMPA
+		{ &op::SBCA_ext       ,  5,  5, 3 },	// $B2 SBCA
+		{ &op::SUBD_ext       ,  7,  7, 3 },	// $B3 SUBD
+		{ &op::ANDA_ext       ,  5,  5, 3 },	// $B4 ANDA
+		{ &op::BITA_ext       ,  5,  5, 3 },	// $B5 BITA
+		{ &op::LDA_ext        ,  5,  5, 3 },	// $B6 LDA
+		{ &op::STA_ext        ,  5,  5, 3 },	// $B7 STA
+		{ &op::EORA_ext       ,  5,  5, 3 },	// $B8 EORA
+		{ &op::ADCA_ext       ,  5,  5, 3 },	// $B9 ADCA
+		{ &op::ORA_ext        ,  5,  5, 3 },	// $BA ORA
+		{ &op::ADDA_ext       ,  5,  5, 3 },	// $BB ADDA
+		{ &op::CMPX_ext       ,  7,  7, 3 },	// $BC CMPX
+		{ &op::JSR_ext        ,  8,  8, 3 },	// $BD JSR
+		{ &op::LDX_ext        ,  6,  6, 3 },	// $BE LDX
+		{ &op::STX_ext        ,  6,  6, 3 },	// $BF STX
+		{ &op::SUBB_imm       ,  2,  2, 2 },	// $C0 SUBB
+		{ &op::CMPB_imm       ,  2,  2, 2 },	// $C1 CMPB
+		{ &op::SBCB_imm       ,  2,  2, 2 },	// $C2 SBCB
+		{ &op::ADDD_imm       ,  4,  4, 3 },	// $C3 ADDD
+		{ &op::ANDB_imm       ,  2,  2, 2 },	// $C4 ANDB
+		{ &op::BITB_imm       ,  2,  2, 2 },	// $C5 BITB
+		{ &op::LDB_imm        ,  2,  2, 2 },	// $C6 LDB
+		{ &op::XXX            ,  1,  1, 1 },	// $C7 ???
+		{ &op::EORB_imm       ,  2,  2, 2 },	// $C8 EORB
+		{ &op::ADCB_imm       ,  2,  2, 2 },	// $C9 ADCB
+		{ &op::ORB_imm        ,  2,  2, 2 },	// $CA ORB
+		{ &op::ADDB_imm       ,  2,  2, 2 },	// $CB ADDB
+		{ &op::LDD_imm        ,  3,  3, 3 },	// $CC LDD
+		{ &op::XXX            ,  1,  1, 1 },	// $CD ???
+		{ &op::LDU_imm        ,  3,  3, 3 },	// $CE LDU
+		{ &op::XXX            ,  1,  1, 1 },	// $CF ???
+		{ &op::SUBB_dir       ,  4,  4, 2 },	// $D0 SUBB
+		{ &op::CMPB_dir       ,  4,  4, 2 },	// $D1 CMPB
+		{ &op::SBCB_dir       ,  4,  4, 2 },	// $D2 SBCB
+		{ &op::ADDD_dir       ,  6,  6, 2 },	// $D3 ADDD
+		{ &op::ANDB_dir       ,  4,  4, 2 },	// $D4 ANDB
+		{ &op::BITB_dir       ,  4,  4, 2 },	// $D5 BITB
+		{ &op::LDB_dir        ,  4,  4, 2 },	// $D6 LDB
+		{ &op::STB_dir        ,  4,  4, 2 },	// $D7 STB
+		{ &op::EORB_dir       ,  4,  4, 2 },	// $D8 EORB
+		{ &op::ADCB_dir       ,  4,  4, 2 },	// $D9 ADCB
+		{ &op::ORB_dir        ,  4,  4, 2 },	// $DA ORB
+		{ &op::ADDB_dir       ,  4,  4, 2 },	// $DB ADDB
+		{ &op::LDD_dir        ,  5,  5, 2 },	// $DC LDD
+		{ &op::STD_dir        ,  5,  5, 2 },	// $DD STD
+		{ &op::LDU_dir        ,  5,  5, 2 },	// $DE LDU
+		{ &op::STU_dir        ,  5,  5, 2 },	// $DF STU
+		{ &op::SUBB_idx       ,  4, 99, 2 },	// $E0 SUBB
+		{ &op::CMPB_idx       ,  4, 99, 2 },	// $E1 CMPB
+		{ &op::SBCB_idx       ,  4, 99, 2 },	// $E2 SBCB
+		{ &op::ADDD_idx       ,  6, 99, 2 },	// $E3 ADDD
+		{ &op::ANDB_idx       ,  4, 99, 2 },	// $E4 ANDB
+		{ &op::BITB_idx       ,  4, 99, 2 },	// $E5 BITB
+		{ &op::LDB_idx        ,  4, 99, 2 },	// $E6 LDB
+		{ &op::STB_idx        ,  4, 99, 2 },	// $E7 STB
+		{ &op::EORB_idx       ,  4, 99, 2 },	// $E8 EORB
+		{ &op::ADCB_idx       ,  4, 99, 2 },	// $E9 ADCB
+		{ &op::ORB_idx        ,  4, 99, 2 },	// $EA ORB
+		{ &op::ADDB_idx       ,  4, 99, 2 },	// $EB ADDB
+		{ &op::LDD_idx        ,  5, 99, 2 },	// $EC LDD
+		{ &op::STD_idx        ,  5, 99, 2 },	// $ED STD
+		{ &op::LDU_idx        ,  5, 99, 2 },	// $EE LDU
+		{ &op::STU_idx        ,  5, 99, 2 },	// $EF STU
+		{ &op::SUBB_ext       ,  5,  5, 3 },	// $F0 SUBB
+		{ &op::CMPB_ext       ,  5,  5, 3 },	// $F1 CMPB
+		{ &op::SBCB_ext       ,  5,  5, 3 },	// $F2 SBCB
+		{ &op::ADDD_ext       ,  7,  7, 3 },	// $F3 ADDD
+		{ &op::ANDB_ext       ,  5,  5, 3 },	// $F4 ANDB
+		{ &op::BITB_ext       ,  5,  5, 3 },	// $F5 BITB
+		{ &op::LDB_ext        ,  5,  5, 3 },	// $F6 LDB
+		{ &op::STB_ext        ,  5,  5, 3 },	// $F7 STB
+		{ &op::EORB_ext       ,  5,  5, 3 },	// $F8 EORB
+		{ &op::ADCB_ext       ,  5,  5, 3 },	// $F9 ADCB
+		{ &op::ORB_ext        ,  5,  5, 3 },	// $FA ORB
+		{ &op::ADDB_ext       ,  5,  5, 3 },	// $FB ADDB
+		{ &op::LDD_ext        ,  6,  6, 3 },	// $FC LDD
+		{ &op::STD_ext        ,  6,  6, 3 },	// $FD STD
+		{ &op::LDU_ext        ,  6,  6, 3 },	// $FE LDU
+		{ &op::STU_ext        ,  6,  6, 3 },	// $FF STU
+	},
+	{	// page 2 - $10 prefix
+		{ &op::XXX            ,  1,  1, 1 },	// $00 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $01 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $02 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $03 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $04 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $05 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $06 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $07 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $08 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $09 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $0A ???
+		{ &op::XXX            ,  1,  1, 1 },	// $0B ???
+		{ &op::XXX            ,  1,  1, 1 },	// $0C ???
+		{ &op::XXX            ,  1,  1, 1 },	// $0D ???
+		{ &op::XXX            ,  1,  1, 1 },	// $0E ???
+		{ &op::XXX            ,  1,  1, 1 },	// $0F ???
+		{ nullptr             ,  0,  0, 0 },	// $10 ***
+		{ nullptr             ,  0,  0, 0 },	// $11 ***
+		{ &op::XXX            ,  1,  1, 1 },	// $12 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $13 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $14 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $15 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $16 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $17 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $18 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $19 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $1A ???
+		{ &op::XXX            ,  1,  1, 1 },	// $1B ???
+		{ &op::XXX            ,  1,  1, 1 },	// $1C ???
+		{ &op::XXX            ,  1,  1, 1 },	// $1D ???
+		{ &op::XXX            ,  1,  1, 1 },	// $1E ???
+		{ &op::XXX            ,  1,  1, 1 },	// $1F ???
+		{ &op::XXX            ,  1,  1, 1 },	// $20 ???
+		{ &op::LBRN_rel       ,  5,  5, 4 },	// $21 LBRN
+		{ &op::LBHI_rel       ,  5,  6, 4 },	// $22 LBHI
+		{ &op::LBLS_rel       ,  5,  6, 4 },	// $23 LBLS
+		{ &op::LBHS_LBCC_rel  ,  5,  6, 4 },	// $24 LBHS/LBCC
+		{ &op::LBCS_LBLO_rel  ,  5,  6, 4 },	// $25 LBCS/LBLO
+		{ &op::LBNE_rel       ,  5,  6, 4 },	// $26 LBNE
+		{ &op::LBEQ_rel       ,  5,  6, 4 },	// $27 LBEQ
+		{ &op::LBVC_rel       ,  5,  6, 4 },	// $28 LBVC
+		{ &op::LBVS_rel       ,  5,  6, 4 },	// $29 LBVS
+		{ &op::LBPL_rel       ,  5,  6, 4 },	// $2A LBPL
+		{ &op::LBMI_rel       ,  5,  6, 4 },	// $2B LBMI
+		{ &op::LBGE_rel       ,  5,  6, 4 },	// $2C LBGE
+		{ &op::LBLT_rel       ,  5,  6, 4 },	// $2D LBLT
+		{ &op::LBGT_rel       ,  5,  6, 4 },	// $2E LBGT
+		{ &op::LBLE_rel       ,  5,  6, 4 },	// $2F LBLE
+		{ &op::XXX            ,  1,  1, 1 },	// $30 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $31 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $32 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $33 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $34 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $35 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $36 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $37 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $38 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $39 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $3A ???
+		{ &op::XXX            ,  1,  1, 1 },	// $3B ???
+		{ &op::XXX            ,  1,  1, 1 },	// $3C ???
+		{ &op::XXX            ,  1,  1, 1 },	// $3D ???
+		{ &op::XXX            ,  1,  1, 1 },	// $3E ???
+		{ &op::SWI2_inh       , 20, 20, 2 },	// $3F SWI2
+		{ &op::XXX            ,  1,  1, 1 },	// $40 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $41 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $42 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $43 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $44 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $45 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $46 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $47 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $48 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $49 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $4A ???
+		{ &op::XXX            ,  1,  1, 1 },	// $4B ???
+		{ &op::XXX            ,  1,  1, 1 },	// $4C ???
+		{ &op::XXX            ,  1,  1, 1 },	// $4D ???
+		{ &op::XXX            ,  1,  1, 1 },	// $4E ???
+		{ &op::XXX            ,  1,  1, 1 },	// $4F ???
+		{ &op::XXX            ,  1,  1, 1 },	// $50 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $51 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $52 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $53 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $54 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $55 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $56 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $57 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $58 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $59 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $5A ???
+		{ &op::XXX            ,  1,  1, 1 },	// $5B ???
+		{ &op::XXX            ,  1,  1, 1 },	// $5C ???
+		{ &op::XXX            ,  1,  1, 1 },	// $5D ???
+		{ &op::XXX            ,  1,  1, 1 },	// $5E ???
+		{ &op::XXX            ,  1,  1, 1 },	// $5F ???
+		{ &op::XXX            ,  1,  1, 1 },	// $60 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $61 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $62 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $63 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $64 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $65 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $66 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $67 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $68 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $69 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $6A ???
+		{ &op::XXX            ,  1,  1, 1 },	// $6B ???
+		{ &op::XXX            ,  1,  1, 1 },	// $6C ???
+		{ &op::XXX            ,  1,  1, 1 },	// $6D ???
+		{ &op::XXX            ,  1,  1, 1 },	// $6E ???
+		{ &op::XXX            ,  1,  1, 1 },	// $6F ???
+		{ &op::XXX            ,  1,  1, 1 },	// $70 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $71 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $72 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $73 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $74 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $75 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $76 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $77 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $78 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $79 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $7A ???
+		{ &op::XXX            ,  1,  1, 1 },	// $7B ???
+		{ &op::XXX            ,  1,  1, 1 },	// $7C ???
+		{ &op::XXX            ,  1,  1, 1 },	// $7D ???
+		{ &op::XXX            ,  1,  1, 1 },	// $7E ???
+		{ &op::XXX            ,  1,  1, 1 },	// $7F ???
+		{ &op::XXX            ,  1,  1, 1 },	// $80 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $81 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $82 ???
+		{ &op::CMPD_imm       ,  5,  5, 4 },	// $83 CMPD
+		{ &op::XXX            ,  1,  1, 1 },	// $84 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $85 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $86 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $87 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $88 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $89 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $8A ???
+		{ &op::XXX            ,  1,  1, 1 },	// $8B ???
+		{ &op::CMPY_imm       ,  5,  5, 4 },	// $8C CMPY
+		{ &op::XXX            ,  1,  1, 1 },	// $8D ???
+		{ &op::LDY_imm        ,  4,  4, 4 },	// $8E LDY
+		{ &op::XXX            ,  1,  1, 1 },	// $8F ???
+		{ &op::XXX            ,  1,  1, 1 },	// $90 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $91 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $92 ???
+		{ &op::CMPD_dir       ,  7,  7, 3 },	// $93 CMPD
+		{ &op::XXX            ,  1,  1, 1 },	// $94 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $95 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $96 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $97 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $98 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $99 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $9A ???
+		{ &op::XXX            ,  1,  1, 1 },	// $9B ???
+		{ &op::CMPY_dir       ,  7,  7, 3 },	// $9C CMPY
+		{ &op::XXX            ,  1,  1, 1 },	// $9D ???
+		{ &op::LDY_dir        ,  6,  6, 3 },	// $9E LDY
+		{ &op::STY_dir        ,  6,  6, 3 },	// $9F STY
+		{ &op::XXX            ,  1,  1, 1 },	// $A0 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $A1 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $A2 ???
+		{ &op::CMPD_idx       ,  7, 99, 3 },	// $A3 CMPD
+		{ &op::XXX            ,  1,  1, 1 },	// $A4 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $A5 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $A6 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $A7 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $A8 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $A9 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $AA ???
+		{ &op::XXX            ,  1,  1, 1 },	// $AB ???
+		{ &op::CMPY_idx       ,  7, 99, 3 },	// $AC CMPY
+		{ &op::XXX            ,  1,  1, 1 },	// $AD ???
+		{ &op::LDY_idx        ,  6, 99, 3 },	// $AE LDY
+		{ &op::STY_idx        ,  6, 99, 3 },	// $AF STY
+		{ &op::XXX            ,  1,  1, 1 },	// $B0 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $B1 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $B2 ???
+		{ &op::CMPD_ext       ,  8,  8, 4 },	// $B3 CMPD
+		{ &op::XXX            ,  1,  1, 1 },	// $B4 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $B5 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $B6 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $B7 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $B8 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $B9 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $BA ???
+		{ &op::XXX            ,  1,  1, 1 },	// $BB ???
+		{ &op::CMPY_ext       ,  8,  8, 4 },	// $BC CMPY
+		{ &op::XXX            ,  1,  1, 1 },	// $BD ???
+		{ &op::LDY_ext        ,  7,  7, 4 },	// $BE LDY
+		{ &op::STY_ext        ,  7,  7, 4 },	// $BF STY
+		{ &op::XXX            ,  1,  1, 1 },	// $C0 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $C1 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $C2 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $C3 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $C4 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $C5 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $C6 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $C7 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $C8 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $C9 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $CA ???
+		{ &op::XXX            ,  1,  1, 1 },	// $CB ???
+		{ &op::XXX            ,  1,  1, 1 },	// $CC ???
+		{ &op::XXX            ,  1,  1, 1 },	// $CD ???
+		{ &op::LDS_imm        ,  4,  4, 4 },	// $CE LDS
+		{ &op::XXX            ,  1,  1, 1 },	// $CF ???
+		{ &op::XXX            ,  1,  1, 1 },	// $D0 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $D1 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $D2 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $D3 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $D4 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $D5 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $D6 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $D7 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $D8 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $D9 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $DA ???
+		{ &op::XXX            ,  1,  1, 1 },	// $DB ???
+		{ &op::XXX            ,  1,  1, 1 },	// $DC ???
+		{ &op::XXX            ,  1,  1, 1 },	// $DD ???
+		{ &op::LDS_dir        ,  6,  6, 4 },	// $DE LDS
+		{ &op::STS_dir        ,  6,  6, 3 },	// $DF STS
+		{ &op::XXX            ,  1,  1, 1 },	// $E0 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $E1 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $E2 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $E3 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $E4 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $E5 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $E6 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $E7 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $E8 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $E9 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $EA ???
+		{ &op::XXX            ,  1,  1, 1 },	// $EB ???
+		{ &op::XXX            ,  1,  1, 1 },	// $EC ???
+		{ &op::XXX            ,  1,  1, 1 },	// $ED ???
+		{ &op::LDS_idx        ,  6, 99, 3 },	// $EE LDS
+		{ &op::STS_idx        ,  6, 99, 3 },	// $EF STS
+		{ &op::XXX            ,  1,  1, 1 },	// $F0 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $F1 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $F2 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $F3 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $F4 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $F5 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $F6 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $F7 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $F8 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $F9 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $FA ???
+		{ &op::XXX            ,  1,  1, 1 },	// $FB ???
+		{ &op::XXX            ,  1,  1, 1 },	// $FC ???
+		{ &op::XXX            ,  1,  1, 1 },	// $FD ???
+		{ &op::LDS_ext        ,  7,  7, 4 },	// $FE LDS
+		{ &op::STS_ext        ,  7,  7, 4 },	// $FF STS
+	},
+	{	// page 3 - $11 prefix
+		{ &op::XXX            ,  1,  1, 1 },	// $00 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $01 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $02 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $03 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $04 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $05 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $06 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $07 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $08 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $09 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $0A ???
+		{ &op::XXX            ,  1,  1, 1 },	// $0B ???
+		{ &op::XXX            ,  1,  1, 1 },	// $0C ???
+		{ &op::XXX            ,  1,  1, 1 },	// $0D ???
+		{ &op::XXX            ,  1,  1, 1 },	// $0E ???
+		{ &op::XXX            ,  1,  1, 1 },	// $0F ???
+		{ nullptr             ,  0,  0, 0 },	// $10 ***
+		{ nullptr             ,  0,  0, 0 },	// $11 ***
+		{ &op::XXX            ,  1,  1, 1 },	// $12 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $13 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $14 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $15 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $16 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $17 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $18 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $19 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $1A ???
+		{ &op::XXX            ,  1,  1, 1 },	// $1B ???
+		{ &op::XXX            ,  1,  1, 1 },	// $1C ???
+		{ &op::XXX            ,  1,  1, 1 },	// $1D ???
+		{ &op::XXX            ,  1,  1, 1 },	// $1E ???
+		{ &op::XXX            ,  1,  1, 1 },	// $1F ???
+		{ &op::XXX            ,  1,  1, 1 },	// $20 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $21 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $22 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $23 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $24 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $25 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $26 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $27 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $28 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $29 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $2A ???
+		{ &op::XXX            ,  1,  1, 1 },	// $2B ???
+		{ &op::XXX            ,  1,  1, 1 },	// $2C ???
+		{ &op::XXX            ,  1,  1, 1 },	// $2D ???
+		{ &op::XXX            ,  1,  1, 1 },	// $2E ???
+		{ &op::XXX            ,  1,  1, 1 },	// $2F ???
+		{ &op::XXX            ,  1,  1, 1 },	// $30 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $31 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $32 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $33 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $34 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $35 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $36 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $37 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $38 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $39 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $3A ???
+		{ &op::XXX            ,  1,  1, 1 },	// $3B ???
+		{ &op::XXX            ,  1,  1, 1 },	// $3C ???
+		{ &op::XXX            ,  1,  1, 1 },	// $3D ???
+		{ &op::XXX            ,  1,  1, 1 },	// $3E ???
+		{ &op::SWI3_inh       , 20, 20, 2 },	// $3F SWI3
+		{ &op::XXX            ,  1,  1, 1 },	// $40 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $41 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $42 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $43 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $44 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $45 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $46 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $47 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $48 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $49 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $4A ???
+		{ &op::XXX            ,  1,  1, 1 },	// $4B ???
+		{ &op::XXX            ,  1,  1, 1 },	// $4C ???
+		{ &op::XXX            ,  1,  1, 1 },	// $4D ???
+		{ &op::XXX            ,  1,  1, 1 },	// $4E ???
+		{ &op::XXX            ,  1,  1, 1 },	// $4F ???
+		{ &op::XXX            ,  1,  1, 1 },	// $50 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $51 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $52 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $53 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $54 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $55 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $56 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $57 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $58 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $59 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $5A ???
+		{ &op::XXX            ,  1,  1, 1 },	// $5B ???
+		{ &op::XXX            ,  1,  1, 1 },	// $5C ???
+		{ &op::XXX            ,  1,  1, 1 },	// $5D ???
+		{ &op::XXX            ,  1,  1, 1 },	// $5E ???
+		{ &op::XXX            ,  1,  1, 1 },	// $5F ???
+		{ &op::XXX            ,  1,  1, 1 },	// $60 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $61 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $62 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $63 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $64 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $65 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $66 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $67 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $68 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $69 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $6A ???
+		{ &op::XXX            ,  1,  1, 1 },	// $6B ???
+		{ &op::XXX            ,  1,  1, 1 },	// $6C ???
+		{ &op::XXX            ,  1,  1, 1 },	// $6D ???
+		{ &op::XXX            ,  1,  1, 1 },	// $6E ???
+		{ &op::XXX            ,  1,  1, 1 },	// $6F ???
+		{ &op::XXX            ,  1,  1, 1 },	// $70 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $71 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $72 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $73 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $74 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $75 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $76 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $77 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $78 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $79 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $7A ???
+		{ &op::XXX            ,  1,  1, 1 },	// $7B ???
+		{ &op::XXX            ,  1,  1, 1 },	// $7C ???
+		{ &op::XXX            ,  1,  1, 1 },	// $7D ???
+		{ &op::XXX            ,  1,  1, 1 },	// $7E ???
+		{ &op::XXX            ,  1,  1, 1 },	// $7F ???
+		{ &op::XXX            ,  1,  1, 1 },	// $80 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $81 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $82 ???
+		{ &op::CMPU_imm       ,  5,  5, 4 },	// $83 CMPU
+		{ &op::XXX            ,  1,  1, 1 },	// $84 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $85 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $86 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $87 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $88 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $89 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $8A ???
+		{ &op::XXX            ,  1,  1, 1 },	// $8B ???
+		{ &op::CMPS_imm       ,  5,  5, 4 },	// $8C CMPS
+		{ &op::XXX            ,  1,  1, 1 },	// $8D ???
+		{ &op::XXX            ,  1,  1, 1 },	// $8E ???
+		{ &op::XXX            ,  1,  1, 1 },	// $8F ???
+		{ &op::XXX            ,  1,  1, 1 },	// $90 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $91 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $92 ???
+		{ &op::CMPU_dir       ,  7,  7, 3 },	// $93 CMPU
+		{ &op::XXX            ,  1,  1, 1 },	// $94 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $95 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $96 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $97 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $98 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $99 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $9A ???
+		{ &op::XXX            ,  1,  1, 1 },	// $9B ???
+		{ &op::CMPS_dir       ,  7,  7, 3 },	// $9C CMPS
+		{ &op::XXX            ,  1,  1, 1 },	// $9D ???
+		{ &op::XXX            ,  1,  1, 1 },	// $9E ???
+		{ &op::XXX            ,  1,  1, 1 },	// $9F ???
+		{ &op::XXX            ,  1,  1, 1 },	// $A0 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $A1 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $A2 ???
+		{ &op::CMPU_idx       ,  7, 99, 3 },	// $A3 CMPU
+		{ &op::XXX            ,  1,  1, 1 },	// $A4 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $A5 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $A6 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $A7 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $A8 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $A9 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $AA ???
+		{ &op::XXX            ,  1,  1, 1 },	// $AB ???
+		{ &op::CMPS_idx       ,  7, 99, 3 },	// $AC CMPS
+		{ &op::XXX            ,  1,  1, 1 },	// $AD ???
+		{ &op::XXX            ,  1,  1, 1 },	// $AE ???
+		{ &op::XXX            ,  1,  1, 1 },	// $AF ???
+		{ &op::XXX            ,  1,  1, 1 },	// $B0 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $B1 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $B2 ???
+		{ &op::CMPU_ext       ,  8,  8, 4 },	// $B3 CMPU
+		{ &op::XXX            ,  1,  1, 1 },	// $B4 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $B5 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $B6 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $B7 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $B8 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $B9 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $BA ???
+		{ &op::XXX            ,  1,  1, 1 },	// $BB ???
+		{ &op::CMPS_ext       ,  8,  8, 4 },	// $BC CMPS
+		{ &op::XXX            ,  1,  1, 1 },	// $BD ???
+		{ &op::XXX            ,  1,  1, 1 },	// $BE ???
+		{ &op::XXX            ,  1,  1, 1 },	// $BF ???
+		{ &op::XXX            ,  1,  1, 1 },	// $C0 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $C1 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $C2 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $C3 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $C4 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $C5 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $C6 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $C7 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $C8 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $C9 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $CA ???
+		{ &op::XXX            ,  1,  1, 1 },	// $CB ???
+		{ &op::XXX            ,  1,  1, 1 },	// $CC ???
+		{ &op::XXX            ,  1,  1, 1 },	// $CD ???
+		{ &op::XXX            ,  1,  1, 1 },	// $CE ???
+		{ &op::XXX            ,  1,  1, 1 },	// $CF ???
+		{ &op::XXX            ,  1,  1, 1 },	// $D0 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $D1 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $D2 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $D3 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $D4 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $D5 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $D6 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $D7 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $D8 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $D9 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $DA ???
+		{ &op::XXX            ,  1,  1, 1 },	// $DB ???
+		{ &op::XXX            ,  1,  1, 1 },	// $DC ???
+		{ &op::XXX            ,  1,  1, 1 },	// $DD ???
+		{ &op::XXX            ,  1,  1, 1 },	// $DE ???
+		{ &op::XXX            ,  1,  1, 1 },	// $DF ???
+		{ &op::XXX            ,  1,  1, 1 },	// $E0 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $E1 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $E2 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $E3 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $E4 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $E5 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $E6 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $E7 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $E8 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $E9 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $EA ???
+		{ &op::XXX            ,  1,  1, 1 },	// $EB ???
+		{ &op::XXX            ,  1,  1, 1 },	// $EC ???
+		{ &op::XXX            ,  1,  1, 1 },	// $ED ???
+		{ &op::XXX            ,  1,  1, 1 },	// $EE ???
+		{ &op::XXX            ,  1,  1, 1 },	// $EF ???
+		{ &op::XXX            ,  1,  1, 1 },	// $F0 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $F1 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $F2 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $F3 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $F4 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $F5 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $F6 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $F7 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $F8 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $F9 ???
+		{ &op::XXX            ,  1,  1, 1 },	// $FA ???
+		{ &op::XXX            ,  1,  1, 1 },	// $FB ???
+		{ &op::XXX            ,  1,  1, 1 },	// $FC ???
+		{ &op::XXX            ,  1,  1, 1 },	// $FD ???
+		{ &op::XXX            ,  1,  1, 1 },	// $FE ???
+		{ &op::XXX            ,  1,  1, 1 },	// $FF ???
+	},
+};
+
+
+//*****************************************************************************
+//	OpCodeName[page][opcode]
+//*****************************************************************************
+//	Cold table: mnemonics, only needed by debuggers and disassembly.
+//*****************************************************************************
+constexpr const char* const Mc6809::OpCodeName[3][256] =
+{
+	{	// page 1
+		"NEG",       "???",       "???",       "COM",       "LSR",       "???",       "ROR",       "ASR",
+		"ASL/LSL",   "ROL",       "DEC",       "???",       "INC",       "TST",       "JMP",       "CLR",
+		"***",       "***",       "NOP",       "SYNC",      "???",       "???",       "LBRA",      "LBSR",
+		"???",       "DAA",       "ORCC",      "???",       "ANDCC",     "SEX",       "EXG",       "TFR",
+		"BRA",       "BRN",       "BHI",       "BLS",       "BHS/BCC",   "BLO/BCS",   "BNE",       "BEQ",
+		"BVC",       "BVS",       "BPL",       "BMI",       "BGE",       "BLT",       "BGT",       "BLE",
+		"LEAX",      "LEAY",      "LEAS",      "LEAU",      "PSHS",      "PULS",      "PSHU",      "PULU",
+		"???",       "RTS",       "ABX",       "RTI",       "CWAI",      "MUL",
+#ifdef USE_RESET_3E
+		"RESET",
+#else
+		"???",
+#endif
+		"SWI",
+		"NEGA",      "???",       "???",       "COMA",      "LSRA",      "???",       "RORA",      "ASRA",
+		"ASLA/LSLA", "ROLA",      "DECA",      "???",       "INCA",      "TSTA",      "???",       "CLRA",
+		"NEGB",      "???",       "???",       "COMB",      "LSRB",      "???",       "RORB",      "ASRB",
+		"ASLB/LSLB", "ROLB",      "DECB",      "???",       "INCB",      "TSTB",      "???",       "CLRB",
+		"NEG",       "???",       "???",       "COM",       "LSR",       "???",       "ROR",       "ASR",
+		"ASL/LSL",   "ROL",       "DEC",       "???",       "INC",       "TST",       "JMP",       "CLR",
+		"NEG",       "???",       "???",       "COM",       "LSR",       "???",       "ROR",       "ASR",
+		"ASL/LSL",   "ROL",       "DEC",       "???",       "INC",       "TST",       "JMP",       "CLR",
+		"SUBA",      "CMPA",      "SBCA",      "SUBD",      "ANDA",      "BITA",      "LDA",       "???",
+		"EORA",      "ADCA",      "ORA",       "ADDA",      "CMPX",      "BSR",       "LDX",       "???",
+		"SUBA",      "CMPA",      "SBCA",      "SUBD",      "ANDA",      "BITA",      "LDA",       "STA",
+		"EORA",      "ADCA",      "ORA",       "ADDA",      "CMPX",      "JSR",       "LDX",       "STX",
+		"SUBA",      "CMPA",      "SBCA",      "SUBD",      "ANDA",      "BITA",      "LDA",       "STA",
+		"EORA",      "ADCA",      "ORA",       "ADDA",      "CMPX",      "JSR",       "LDX",       "STX",
+		"SUBA",      "CMPA",      "SBCA",      "SUBD",      "ANDA",      "BITA",      "LDA",       "STA",
+		"EORA",      "ADCA",      "ORA",       "ADDA",      "CMPX",      "JSR",       "LDX",       "STX",
+		"SUBB",      "CMPB",      "SBCB",      "ADDD",      "ANDB",      "BITB",      "LDB",       "???",
+		"EORB",      "ADCB",      "ORB",       "ADDB",      "LDD",       "???",       "LDU",       "???",
+		"SUBB",      "CMPB",      "SBCB",      "ADDD",      "ANDB",      "BITB",      "LDB",       "STB",
+		"EORB",      "ADCB",      "ORB",       "ADDB",      "LDD",       "STD",       "LDU",       "STU",
+		"SUBB",      "CMPB",      "SBCB",      "ADDD",      "ANDB",      "BITB",      "LDB",       "STB",
+		"EORB",      "ADCB",      "ORB",       "ADDB",      "LDD",       "STD",       "LDU",       "STU",
+		"SUBB",      "CMPB",      "SBCB",      "ADDD",      "ANDB",      "BITB",      "LDB",       "STB",
+		"EORB",      "ADCB",      "ORB",       "ADDB",      "LDD",       "STD",       "LDU",       "STU",
+	},
+	{	// page 2
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"***",       "***",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "LBRN",      "LBHI",      "LBLS",      "LBHS/LBCC", "LBCS/LBLO", "LBNE",      "LBEQ",
+		"LBVC",      "LBVS",      "LBPL",      "LBMI",      "LBGE",      "LBLT",      "LBGT",      "LBLE",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "SWI2",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "CMPD",      "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "CMPY",      "???",       "LDY",       "???",
+		"???",       "???",       "???",       "CMPD",      "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "CMPY",      "???",       "LDY",       "STY",
+		"???",       "???",       "???",       "CMPD",      "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "CMPY",      "???",       "LDY",       "STY",
+		"???",       "???",       "???",       "CMPD",      "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "CMPY",      "???",       "LDY",       "STY",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "LDS",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "LDS",       "STS",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "LDS",       "STS",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "LDS",       "STS",
+	},
+	{	// page 3
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"***",       "***",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "SWI3",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "CMPU",      "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "CMPS",      "???",       "???",       "???",
+		"???",       "???",       "???",       "CMPU",      "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "CMPS",      "???",       "???",       "???",
+		"???",       "???",       "???",       "CMPU",      "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "CMPS",      "???",       "???",       "???",
+		"???",       "???",       "???",       "CMPU",      "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "CMPS",      "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+		"???",       "???",       "???",       "???",       "???",       "???",       "???",       "???",
+	},
+};
+
+
+//*****************************************************************************
+//	IndexedModes[postbyte]
+//*****************************************************************************
+//	Indexed addressing post byte: base register, offset kind, 5 bit offset,
+// auto increment (+) / decrement (-), indirect, extra cycles, extra program
+// bytes.
+//*****************************************************************************
+constexpr Mc6809::IDXMODE Mc6809::IndexedModes[256] =
+{
+	{ &op::reg_X,   IDX::OFFSET_5BIT,    0,  0, false, 1, 0 },	// $00 0,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,    1,  0, false, 1, 0 },	// $01 1,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,    2,  0, false, 1, 0 },	// $02 2,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,    3,  0, false, 1, 0 },	// $03 3,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,    4,  0, false, 1, 0 },	// $04 4,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,    5,  0, false, 1, 0 },	// $05 5,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,    6,  0, false, 1, 0 },	// $06 6,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,    7,  0, false, 1, 0 },	// $07 7,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,    8,  0, false, 1, 0 },	// $08 8,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,    9,  0, false, 1, 0 },	// $09 9,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,   10,  0, false, 1, 0 },	// $0A 10,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,   11,  0, false, 1, 0 },	// $0B 11,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,   12,  0, false, 1, 0 },	// $0C 12,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,   13,  0, false, 1, 0 },	// $0D 13,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,   14,  0, false, 1, 0 },	// $0E 14,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,   15,  0, false, 1, 0 },	// $0F 15,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,  -16,  0, false, 1, 0 },	// $10 -16,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,  -15,  0, false, 1, 0 },	// $11 -15,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,  -14,  0, false, 1, 0 },	// $12 -14,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,  -13,  0, false, 1, 0 },	// $13 -13,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,  -12,  0, false, 1, 0 },	// $14 -12,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,  -11,  0, false, 1, 0 },	// $15 -11,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,  -10,  0, false, 1, 0 },	// $16 -10,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,   -9,  0, false, 1, 0 },	// $17 -9,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,   -8,  0, false, 1, 0 },	// $18 -8,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,   -7,  0, false, 1, 0 },	// $19 -7,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,   -6,  0, false, 1, 0 },	// $1A -6,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,   -5,  0, false, 1, 0 },	// $1B -5,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,   -4,  0, false, 1, 0 },	// $1C -4,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,   -3,  0, false, 1, 0 },	// $1D -3,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,   -2,  0, false, 1, 0 },	// $1E -2,X
+	{ &op::reg_X,   IDX::OFFSET_5BIT,   -1,  0, false, 1, 0 },	// $1F -1,X
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,    0,  0, false, 1, 0 },	// $20 0,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,    1,  0, false, 1, 0 },	// $21 1,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,    2,  0, false, 1, 0 },	// $22 2,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,    3,  0, false, 1, 0 },	// $23 3,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,    4,  0, false, 1, 0 },	// $24 4,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,    5,  0, false, 1, 0 },	// $25 5,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,    6,  0, false, 1, 0 },	// $26 6,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,    7,  0, false, 1, 0 },	// $27 7,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,    8,  0, false, 1, 0 },	// $28 8,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,    9,  0, false, 1, 0 },	// $29 9,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,   10,  0, false, 1, 0 },	// $2A 10,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,   11,  0, false, 1, 0 },	// $2B 11,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,   12,  0, false, 1, 0 },	// $2C 12,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,   13,  0, false, 1, 0 },	// $2D 13,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,   14,  0, false, 1, 0 },	// $2E 14,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,   15,  0, false, 1, 0 },	// $2F 15,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,  -16,  0, false, 1, 0 },	// $30 -16,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,  -15,  0, false, 1, 0 },	// $31 -15,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,  -14,  0, false, 1, 0 },	// $32 -14,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,  -13,  0, false, 1, 0 },	// $33 -13,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,  -12,  0, false, 1, 0 },	// $34 -12,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,  -11,  0, false, 1, 0 },	// $35 -11,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,  -10,  0, false, 1, 0 },	// $36 -10,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,   -9,  0, false, 1, 0 },	// $37 -9,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,   -8,  0, false, 1, 0 },	// $38 -8,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,   -7,  0, false, 1, 0 },	// $39 -7,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,   -6,  0, false, 1, 0 },	// $3A -6,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,   -5,  0, false, 1, 0 },	// $3B -5,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,   -4,  0, false, 1, 0 },	// $3C -4,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,   -3,  0, false, 1, 0 },	// $3D -3,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,   -2,  0, false, 1, 0 },	// $3E -2,Y
+	{ &op::reg_Y,   IDX::OFFSET_5BIT,   -1,  0, false, 1, 0 },	// $3F -1,Y
+	{ &op::reg_U,   IDX::OFFSET_5BIT,    0,  0, false, 1, 0 },	// $40 0,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,    1,  0, false, 1, 0 },	// $41 1,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,    2,  0, false, 1, 0 },	// $42 2,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,    3,  0, false, 1, 0 },	// $43 3,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,    4,  0, false, 1, 0 },	// $44 4,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,    5,  0, false, 1, 0 },	// $45 5,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,    6,  0, false, 1, 0 },	// $46 6,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,    7,  0, false, 1, 0 },	// $47 7,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,    8,  0, false, 1, 0 },	// $48 8,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,    9,  0, false, 1, 0 },	// $49 9,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,   10,  0, false, 1, 0 },	// $4A 10,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,   11,  0, false, 1, 0 },	// $4B 11,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,   12,  0, false, 1, 0 },	// $4C 12,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,   13,  0, false, 1, 0 },	// $4D 13,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,   14,  0, false, 1, 0 },	// $4E 14,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,   15,  0, false, 1, 0 },	// $4F 15,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,  -16,  0, false, 1, 0 },	// $50 -16,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,  -15,  0, false, 1, 0 },	// $51 -15,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,  -14,  0, false, 1, 0 },	// $52 -14,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,  -13,  0, false, 1, 0 },	// $53 -13,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,  -12,  0, false, 1, 0 },	// $54 -12,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,  -11,  0, false, 1, 0 },	// $55 -11,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,  -10,  0, false, 1, 0 },	// $56 -10,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,   -9,  0, false, 1, 0 },	// $57 -9,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,   -8,  0, false, 1, 0 },	// $58 -8,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,   -7,  0, false, 1, 0 },	// $59 -7,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,   -6,  0, false, 1, 0 },	// $5A -6,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,   -5,  0, false, 1, 0 },	// $5B -5,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,   -4,  0, false, 1, 0 },	// $5C -4,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,   -3,  0, false, 1, 0 },	// $5D -3,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,   -2,  0, false, 1, 0 },	// $5E -2,U
+	{ &op::reg_U,   IDX::OFFSET_5BIT,   -1,  0, false, 1, 0 },	// $5F -1,U
+	{ &op::reg_S,   IDX::OFFSET_5BIT,    0,  0, false, 1, 0 },	// $60 0,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,    1,  0, false, 1, 0 },	// $61 1,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,    2,  0, false, 1, 0 },	// $62 2,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,    3,  0, false, 1, 0 },	// $63 3,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,    4,  0, false, 1, 0 },	// $64 4,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,    5,  0, false, 1, 0 },	// $65 5,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,    6,  0, false, 1, 0 },	// $66 6,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,    7,  0, false, 1, 0 },	// $67 7,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,    8,  0, false, 1, 0 },	// $68 8,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,    9,  0, false, 1, 0 },	// $69 9,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,   10,  0, false, 1, 0 },	// $6A 10,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,   11,  0, false, 1, 0 },	// $6B 11,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,   12,  0, false, 1, 0 },	// $6C 12,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,   13,  0, false, 1, 0 },	// $6D 13,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,   14,  0, false, 1, 0 },	// $6E 14,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,   15,  0, false, 1, 0 },	// $6F 15,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,  -16,  0, false, 1, 0 },	// $70 -16,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,  -15,  0, false, 1, 0 },	// $71 -15,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,  -14,  0, false, 1, 0 },	// $72 -14,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,  -13,  0, false, 1, 0 },	// $73 -13,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,  -12,  0, false, 1, 0 },	// $74 -12,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,  -11,  0, false, 1, 0 },	// $75 -11,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,  -10,  0, false, 1, 0 },	// $76 -10,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,   -9,  0, false, 1, 0 },	// $77 -9,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,   -8,  0, false, 1, 0 },	// $78 -8,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,   -7,  0, false, 1, 0 },	// $79 -7,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,   -6,  0, false, 1, 0 },	// $7A -6,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,   -5,  0, false, 1, 0 },	// $7B -5,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,   -4,  0, false, 1, 0 },	// $7C -4,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,   -3,  0, false, 1, 0 },	// $7D -3,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,   -2,  0, false, 1, 0 },	// $7E -2,S
+	{ &op::reg_S,   IDX::OFFSET_5BIT,   -1,  0, false, 1, 0 },	// $7F -1,S
+	{ &op::reg_X,   IDX::NO_OFFSET,      0,  1, false, 2, 0 },	// $80 ,X+
+	{ &op::reg_X,   IDX::NO_OFFSET,      0,  2, false, 3, 0 },	// $81 ,X++
+	{ &op::reg_X,   IDX::NO_OFFSET,      0, -1, false, 2, 0 },	// $82 ,-X
+	{ &op::reg_X,   IDX::NO_OFFSET,      0, -2, false, 3, 0 },	// $83 ,--X
+	{ &op::reg_X,   IDX::NO_OFFSET,      0,  0, false, 0, 0 },	// $84 ,X
+	{ &op::reg_X,   IDX::OFFSET_B,       0,  0, false, 1, 0 },	// $85 B,X
+	{ &op::reg_X,   IDX::OFFSET_A,       0,  0, false, 1, 0 },	// $86 A,X
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $87 illegal
+	{ &op::reg_X,   IDX::OFFSET_8BIT,    0,  0, false, 1, 1 },	// $88 n8,X
+	{ &op::reg_X,   IDX::OFFSET_16BIT,   0,  0, false, 4, 2 },	// $89 n16,X
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $8A illegal
+	{ &op::reg_X,   IDX::OFFSET_D,       0,  0, false, 4, 0 },	// $8B D,X
+	{ &op::reg_PC,  IDX::OFFSET_8BIT,    0,  0, false, 1, 1 },	// $8C n8,PCR
+	{ &op::reg_PC,  IDX::OFFSET_16BIT,   0,  0, false, 5, 2 },	// $8D n16,PCR
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $8E illegal
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $8F illegal
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $90 illegal
+	{ &op::reg_X,   IDX::NO_OFFSET,      0,  2, true,  6, 0 },	// $91 [,X++]
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $92 illegal
+	{ &op::reg_X,   IDX::NO_OFFSET,      0, -2, true,  6, 0 },	// $93 [,--X]
+	{ &op::reg_X,   IDX::NO_OFFSET,      0,  0, true,  3, 0 },	// $94 [,X]
+	{ &op::reg_X,   IDX::OFFSET_B,       0,  0, true,  4, 0 },	// $95 [B,X]
+	{ &op::reg_X,   IDX::OFFSET_A,       0,  0, true,  4, 0 },	// $96 [A,X]
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $97 illegal
+	{ &op::reg_X,   IDX::OFFSET_8BIT,    0,  0, true,  4, 1 },	// $98 [n8,X]
+	{ &op::reg_X,   IDX::OFFSET_16BIT,   0,  0, true,  7, 2 },	// $99 [n16,X]
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $9A illegal
+	{ &op::reg_X,   IDX::OFFSET_D,       0,  0, true,  7, 0 },	// $9B [D,X]
+	{ &op::reg_PC,  IDX::OFFSET_8BIT,    0,  0, true,  4, 1 },	// $9C [n8,PCR]
+	{ &op::reg_PC,  IDX::OFFSET_16BIT,   0,  0, true,  8, 2 },	// $9D [n16,PCR]
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $9E illegal
+	{ nullptr,      IDX::OFFSET_16BIT,   0,  0, true,  5, 2 },	// $9F [n16]
+	{ &op::reg_Y,   IDX::NO_OFFSET,      0,  1, false, 2, 0 },	// $A0 ,Y+
+	{ &op::reg_Y,   IDX::NO_OFFSET,      0,  2, false, 3, 0 },	// $A1 ,Y++
+	{ &op::reg_Y,   IDX::NO_OFFSET,      0, -1, false, 2, 0 },	// $A2 ,-Y
+	{ &op::reg_Y,   IDX::NO_OFFSET,      0, -2, false, 3, 0 },	// $A3 ,--Y
+	{ &op::reg_Y,   IDX::NO_OFFSET,      0,  0, false, 0, 0 },	// $A4 ,Y
+	{ &op::reg_Y,   IDX::OFFSET_B,       0,  0, false, 1, 0 },	// $A5 B,Y
+	{ &op::reg_Y,   IDX::OFFSET_A,       0,  0, false, 1, 0 },	// $A6 A,Y
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $A7 illegal
+	{ &op::reg_Y,   IDX::OFFSET_8BIT,    0,  0, false, 1, 1 },	// $A8 n8,Y
+	{ &op::reg_Y,   IDX::OFFSET_16BIT,   0,  0, false, 4, 2 },	// $A9 n16,Y
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $AA illegal
+	{ &op::reg_Y,   IDX::OFFSET_D,       0,  0, false, 4, 0 },	// $AB D,Y
+	{ &op::reg_PC,  IDX::OFFSET_8BIT,    0,  0, false, 1, 1 },	// $AC n8,PCR
+	{ &op::reg_PC,  IDX::OFFSET_16BIT,   0,  0, false, 5, 2 },	// $AD n16,PCR
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $AE illegal
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $AF illegal
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $B0 illegal
+	{ &op::reg_Y,   IDX::NO_OFFSET,      0,  2, true,  6, 0 },	// $B1 [,Y++]
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $B2 illegal
+	{ &op::reg_Y,   IDX::NO_OFFSET,      0, -2, true,  6, 0 },	// $B3 [,--Y]
+	{ &op::reg_Y,   IDX::NO_OFFSET,      0,  0, true,  3, 0 },	// $B4 [,Y]
+	{ &op::reg_Y,   IDX::OFFSET_B,       0,  0, true,  4, 0 },	// $B5 [B,Y]
+	{ &op::reg_Y,   IDX::OFFSET_A,       0,  0, true,  4, 0 },	// $B6 [A,Y]
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $B7 illegal
+	{ &op::reg_Y,   IDX::OFFSET_8BIT,    0,  0, true,  4, 1 },	// $B8 [n8,Y]
+	{ &op::reg_Y,   IDX::OFFSET_16BIT,   0,  0, true,  7, 2 },	// $B9 [n16,Y]
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $BA illegal
+	{ &op::reg_Y,   IDX::OFFSET_D,       0,  0, true,  7, 0 },	// $BB [D,Y]
+	{ &op::reg_PC,  IDX::OFFSET_8BIT,    0,  0, true,  4, 1 },	// $BC [n8,PCR]
+	{ &op::reg_PC,  IDX::OFFSET_16BIT,   0,  0, true,  8, 2 },	// $BD [n16,PCR]
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $BE illegal
+	{ nullptr,      IDX::OFFSET_16BIT,   0,  0, true,  5, 2 },	// $BF [n16]
+	{ &op::reg_U,   IDX::NO_OFFSET,      0,  1, false, 2, 0 },	// $C0 ,U+
+	{ &op::reg_U,   IDX::NO_OFFSET,      0,  2, false, 3, 0 },	// $C1 ,U++
+	{ &op::reg_U,   IDX::NO_OFFSET,      0, -1, false, 2, 0 },	// $C2 ,-U
+	{ &op::reg_U,   IDX::NO_OFFSET,      0, -2, false, 3, 0 },	// $C3 ,--U
+	{ &op::reg_U,   IDX::NO_OFFSET,      0,  0, false, 0, 0 },	// $C4 ,U
+	{ &op::reg_U,   IDX::OFFSET_B,       0,  0, false, 1, 0 },	// $C5 B,U
+	{ &op::reg_U,   IDX::OFFSET_A,       0,  0, false, 1, 0 },	// $C6 A,U
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $C7 illegal
+	{ &op::reg_U,   IDX::OFFSET_8BIT,    0,  0, false, 1, 1 },	// $C8 n8,U
+	{ &op::reg_U,   IDX::OFFSET_16BIT,   0,  0, false, 4, 2 },	// $C9 n16,U
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $CA illegal
+	{ &op::reg_U,   IDX::OFFSET_D,       0,  0, false, 4, 0 },	// $CB D,U
+	{ &op::reg_PC,  IDX::OFFSET_8BIT,    0,  0, false, 1, 1 },	// $CC n8,PCR
+	{ &op::reg_PC,  IDX::OFFSET_16BIT,   0,  0, false, 5, 2 },	// $CD n16,PCR
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $CE illegal
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $CF illegal
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $D0 illegal
+	{ &op::reg_U,   IDX::NO_OFFSET,      0,  2, true,  6, 0 },	// $D1 [,U++]
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $D2 illegal
+	{ &op::reg_U,   IDX::NO_OFFSET,      0, -2, true,  6, 0 },	// $D3 [,--U]
+	{ &op::reg_U,   IDX::NO_OFFSET,      0,  0, true,  3, 0 },	// $D4 [,U]
+	{ &op::reg_U,   IDX::OFFSET_B,       0,  0, true,  4, 0 },	// $D5 [B,U]
+	{ &op::reg_U,   IDX::OFFSET_A,       0,  0, true,  4, 0 },	// $D6 [A,U]
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $D7 illegal
+	{ &op::reg_U,   IDX::OFFSET_8BIT,    0,  0, true,  4, 1 },	// $D8 [n8,U]
+	{ &op::reg_U,   IDX::OFFSET_16BIT,   0,  0, true,  7, 2 },	// $D9 [n16,U]
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $DA illegal
+	{ &op::reg_U,   IDX::OFFSET_D,       0,  0, true,  7, 0 },	// $DB [D,U]
+	{ &op::reg_PC,  IDX::OFFSET_8BIT,    0,  0, true,  4, 1 },	// $DC [n8,PCR]
+	{ &op::reg_PC,  IDX::OFFSET_16BIT,   0,  0, true,  8, 2 },	// $DD [n16,PCR]
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $DE illegal
+	{ nullptr,      IDX::OFFSET_16BIT,   0,  0, true,  5, 2 },	// $DF [n16]
+	{ &op::reg_S,   IDX::NO_OFFSET,      0,  1, false, 2, 0 },	// $E0 ,S+
+	{ &op::reg_S,   IDX::NO_OFFSET,      0,  2, false, 3, 0 },	// $E1 ,S++
+	{ &op::reg_S,   IDX::NO_OFFSET,      0, -1, false, 2, 0 },	// $E2 ,-S
+	{ &op::reg_S,   IDX::NO_OFFSET,      0, -2, false, 3, 0 },	// $E3 ,--S
+	{ &op::reg_S,   IDX::NO_OFFSET,      0,  0, false, 0, 0 },	// $E4 ,S
+	{ &op::reg_S,   IDX::OFFSET_B,       0,  0, false, 1, 0 },	// $E5 B,S
+	{ &op::reg_S,   IDX::OFFSET_A,       0,  0, false, 1, 0 },	// $E6 A,S
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $E7 illegal
+	{ &op::reg_S,   IDX::OFFSET_8BIT,    0,  0, false, 1, 1 },	// $E8 n8,S
+	{ &op::reg_S,   IDX::OFFSET_16BIT,   0,  0, false, 4, 2 },	// $E9 n16,S
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $EA illegal
+	{ &op::reg_S,   IDX::OFFSET_D,       0,  0, false, 4, 0 },	// $EB D,S
+	{ &op::reg_PC,  IDX::OFFSET_8BIT,    0,  0, false, 1, 1 },	// $EC n8,PCR
+	{ &op::reg_PC,  IDX::OFFSET_16BIT,   0,  0, false, 5, 2 },	// $ED n16,PCR
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $EE illegal
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $EF illegal
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $F0 illegal
+	{ &op::reg_S,   IDX::NO_OFFSET,      0,  2, true,  6, 0 },	// $F1 [,S++]
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $F2 illegal
+	{ &op::reg_S,   IDX::NO_OFFSET,      0, -2, true,  6, 0 },	// $F3 [,--S]
+	{ &op::reg_S,   IDX::NO_OFFSET,      0,  0, true,  3, 0 },	// $F4 [,S]
+	{ &op::reg_S,   IDX::OFFSET_B,       0,  0, true,  4, 0 },	// $F5 [B,S]
+	{ &op::reg_S,   IDX::OFFSET_A,       0,  0, true,  4, 0 },	// $F6 [A,S]
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $F7 illegal
+	{ &op::reg_S,   IDX::OFFSET_8BIT,    0,  0, true,  4, 1 },	// $F8 [n8,S]
+	{ &op::reg_S,   IDX::OFFSET_16BIT,   0,  0, true,  7, 2 },	// $F9 [n16,S]
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $FA illegal
+	{ &op::reg_S,   IDX::OFFSET_D,       0,  0, true,  7, 0 },	// $FB [D,S]
+	{ &op::reg_PC,  IDX::OFFSET_8BIT,    0,  0, true,  4, 1 },	// $FC [n8,PCR]
+	{ &op::reg_PC,  IDX::OFFSET_16BIT,   0,  0, true,  8, 2 },	// $FD [n16,PCR]
+	{ nullptr,      IDX::ILLEGAL,        0,  0, false, 0, 0 },	// $FE illegal
+	{ nullptr,      IDX::OFFSET_16BIT,   0,  0, true,  5, 2 },	// $FF [n16]
+};
+
+
+#ifdef USE_OPCODE_PROFILE
+//*****************************************************************************
+//	OpCodeSheet[page][opcode]
+//*****************************************************************************
+//	Cold table: each opcode's row as it reads in its CSV sheet, so the
+// profile can be written out in the same layout (see Mc6809Profile.cpp).
+//*****************************************************************************
+constexpr const char* const Mc6809::OpCodeSheet[3][256] =
+{
+	{	// Opcodes_p1.csv
+		"\"NEG\"  ,NEG  ,6 ,2 ,DIR    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"COM\"  ,COM  ,6 ,2 ,DIR    ",
+		"\"LSR\"  ,LSR  ,6 ,2 ,DIR    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"ROR\"  ,ROR  ,6 ,2 ,DIR    ",
+		"\"ASR\"  ,ASR  ,6 ,2 ,DIR    ",
+		"\"ASL/LSL\"  ,LSL  ,6 ,2 ,DIR",
+		"\"ROL\"  ,ROL  ,6 ,2 ,DIR    ",
+		"\"DEC\"  ,DEC  ,6 ,2 ,DIR    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"INC\"  ,INC  ,6 ,2 ,DIR    ",
+		"\"TST\"  ,TST  ,6 ,2 ,DIR    ",
+		"\"JMP\"  ,JMP  ,3 ,2 ,DIR    ",
+		"\"CLR\"  ,CLR  ,6 ,2 ,DIR    ",
+		"\"***\"  ,nullptr,0,0,nullptr",
+		"\"***\"  ,nullptr,0,0,nullptr",
+		"\"NOP\"  ,NOP  ,2 ,1 ,INH    ",
+		"\"SYNC\" ,SYNC ,4 ,1 ,INH    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"LBRA\" ,LBRA ,5 ,3 ,REL    ",
+		"\"LBSR\" ,LBSR ,9 ,3 ,REL    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"DAA\"  ,DAA  ,2 ,1 ,INH    ",
+		"\"ORCC\" ,ORCC ,3 ,2 ,IMM    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"ANDCC\",ANDCC,3 ,2 ,IMM    ",
+		"\"SEX\"  ,SEX  ,2 ,1 ,INH    ",
+		"\"EXG\"  ,EXG  ,8 ,2 ,IMM    ",
+		"\"TFR\"  ,TFR  ,6 ,2 ,IMM    ",
+		"\"BRA\"  ,BRA  ,3 ,2 ,REL    ",
+		"\"BRN\"  ,BRN  ,3 ,2 ,REL    ",
+		"\"BHI\"  ,BHI  ,3 ,2 ,REL    ",
+		"\"BLS\"  ,BLS  ,3 ,2 ,REL    ",
+		"\"BHS/BCC\"  ,BCC  ,3 ,2 ,REL",
+		"\"BLO/BCS\"  ,BCS  ,3 ,2 ,REL",
+		"\"BNE\"  ,BNE  ,3 ,2 ,REL    ",
+		"\"BEQ\"  ,BEQ  ,3 ,2 ,REL    ",
+		"\"BVC\"  ,BVC  ,3 ,2 ,REL    ",
+		"\"BVS\"  ,BVS  ,3 ,2 ,REL    ",
+		"\"BPL\"  ,BPL  ,3 ,2 ,REL    ",
+		"\"BMI\"  ,BMI  ,3 ,2 ,REL    ",
+		"\"BGE\"  ,BGE  ,3 ,2 ,REL    ",
+		"\"BLT\"  ,BLT  ,3 ,2 ,REL    ",
+		"\"BGT\"  ,BGT  ,3 ,2 ,REL    ",
+		"\"BLE\"  ,BLE  ,3 ,2 ,REL    ",
+		"\"LEAX\" ,LEAX ,4 ,2 ,IDX    ",
+		"\"LEAY\" ,LEAY ,4 ,2 ,IDX    ",
+		"\"LEAS\" ,LEAS ,4 ,2 ,IDX    ",
+		"\"LEAU\" ,LEAU ,4 ,2 ,IDX    ",
+		"\"PSHS\" ,PSHS ,5 ,2 ,IMM    ",
+		"\"PULS\" ,PULS ,5 ,2 ,IMM    ",
+		"\"PSHU\" ,PSHU ,5 ,2 ,IMM    ",
+		"\"PULU\" ,PULU ,5 ,2 ,IMM    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"RTS\"  ,RTS  ,5 ,1 ,INH    ",
+		"\"ABX\"  ,ABX  ,3 ,1 ,INH    ",
+		"\"RTI\"  ,RTI  ,6 ,1 ,INH    ",
+		"\"CWAI\" ,CWAI ,20,2 ,INH    ",
+		"\"MUL\"  ,MUL  ,11,1 ,INH    ",
+#ifdef USE_RESET_3E
+		"\"RESET\",RESET,19,1 ,INH    ",
+#else
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+#endif
+		"\"SWI\"  ,SWI  ,19,1 ,INH    ",
+		"\"NEGA\" ,NEGA ,2 ,1 ,INH    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"COMA\" ,COMA ,2 ,1 ,INH    ",
+		"\"LSRA\" ,LSRA ,2 ,1 ,INH    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"RORA\" ,RORA ,2 ,1 ,INH    ",
+		"\"ASRA\" ,ASRA ,2 ,1 ,INH    ",
+		"\"ASLA/LSLA\",LSLA ,2 ,1 ,INH",
+		"\"ROLA\" ,ROLA ,2 ,1 ,INH    ",
+		"\"DECA\" ,DECA ,2 ,1 ,INH    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"INCA\" ,INCA ,2 ,1 ,INH    ",
+		"\"TSTA\" ,TSTA ,2 ,1 ,INH    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"CLRA\" ,CLRA ,2 ,1 ,INH    ",
+		"\"NEGB\" ,NEGB ,2 ,1 ,INH    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"COMB\" ,COMB ,2 ,1 ,INH    ",
+		"\"LSRB\" ,LSRB ,2 ,1 ,INH    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"RORB\" ,RORB ,2 ,1 ,INH    ",
+		"\"ASRB\" ,ASRB ,2 ,1 ,INH    ",
+		"\"ASLB/LSLB\",LSLB ,2 ,1 ,INH",
+		"\"ROLB\" ,ROLB ,2 ,1 ,INH    ",
+		"\"DECB\" ,DECB ,2 ,1 ,INH    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"INCB\" ,INCB ,2 ,1 ,INH    ",
+		"\"TSTB\" ,TSTB ,2 ,1 ,INH    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"CLRB\" ,CLRB ,2 ,1 ,INH    ",
+		"\"NEG\"  ,NEG  ,6 ,2 ,IDX    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"COM\"  ,COM  ,6 ,2 ,IDX    ",
+		"\"LSR\"  ,LSR  ,6 ,2 ,IDX    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"ROR\"  ,ROR  ,6 ,2 ,IDX    ",
+		"\"ASR\"  ,ASR  ,6 ,2 ,IDX    ",
+		"\"ASL/LSL\"  ,LSL  ,6 ,2 ,IDX",
+		"\"ROL\"  ,ROL  ,6 ,2 ,IDX    ",
+		"\"DEC\"  ,DEC  ,6 ,2 ,IDX    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"INC\"  ,INC  ,6 ,2 ,IDX    ",
+		"\"TST\"  ,TST  ,6 ,2 ,IDX    ",
+		"\"JMP\"  ,JMP  ,3 ,2 ,IDX    ",
+		"\"CLR\"  ,CLR  ,6 ,2 ,IDX    ",
+		"\"NEG\"  ,NEG  ,7 ,3 ,EXT    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"COM\"  ,COM  ,7 ,3 ,EXT    ",
+		"\"LSR\"  ,LSR  ,7 ,3 ,EXT    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"ROR\"  ,ROR  ,7 ,3 ,EXT    ",
+		"\"ASR\"  ,ASR  ,7 ,3 ,EXT    ",
+		"\"ASL/LSL\"  ,LSL  ,7 ,3 ,EXT",
+		"\"ROL\"  ,ROL  ,7 ,3 ,EXT    ",
+		"\"DEC\"  ,DEC  ,7 ,3 ,EXT    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"INC\"  ,INC  ,7 ,3 ,EXT    ",
+		"\"TST\"  ,TST  ,7 ,3 ,EXT    ",
+		"\"JMP\"  ,JMP  ,4 ,3 ,EXT    ",
+		"\"CLR\"  ,CLR  ,7 ,3 ,EXT    ",
+		"\"SUBA\" ,SUBA ,2 ,2 ,IMM    ",
+		"\"CMPA\" ,CMPA ,2 ,2 ,IMM    ",
+		"\"SBCA\" ,SBCA ,2 ,2 ,IMM    ",
+		"\"SUBD\" ,SUBD ,4 ,3 ,IMM    ",
+		"\"ANDA\" ,ANDA ,2 ,2 ,IMM    ",
+		"\"BITA\" ,BITA ,2 ,2 ,IMM    ",
+		"\"LDA\"  ,LDA  ,2 ,2 ,IMM    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"EORA\" ,EORA ,2 ,2 ,IMM    ",
+		"\"ADCA\" ,ADCA ,2 ,2 ,IMM    ",
+		"\"ORA\"  ,ORA  ,2 ,2 ,IMM    ",
+		"\"ADDA\" ,ADDA ,2 ,2 ,IMM    ",
+		"\"CMPX\" ,CMPX ,4 ,3 ,IMM    ",
+		"\"BSR\"  ,BSR  ,7 ,2 ,REL    ",
+		"\"LDX\"  ,LDX  ,3 ,3 ,IMM    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"SUBA\" ,SUBA ,4 ,2 ,DIR    ",
+		"\"CMPA\" ,CMPA ,4 ,2 ,DIR    ",
+		"\"SBCA\" ,SBCA ,4 ,2 ,DIR    ",
+		"\"SUBD\" ,SUBD ,6 ,2 ,DIR    ",
+		"\"ANDA\" ,ANDA ,4 ,2 ,DIR    ",
+		"\"BITA\" ,BITA ,4 ,2 ,DIR    ",
+		"\"LDA\"  ,LDA  ,4 ,2 ,DIR    ",
+		"\"STA\"  ,STA  ,4 ,2 ,DIR    ",
+		"\"EORA\" ,EORA ,4 ,2 ,DIR    ",
+		"\"ADCA\" ,ADCA ,4 ,2 ,DIR    ",
+		"\"ORA\"  ,ORA  ,4 ,2 ,DIR    ",
+		"\"ADDA\" ,ADDA ,4 ,2 ,DIR    ",
+		"\"CMPX\" ,CMPX ,6 ,2 ,DIR    ",
+		"\"JSR\"  ,JSR  ,7 ,2 ,DIR    ",
+		"\"LDX\"  ,LDX  ,5 ,2 ,DIR    ",
+		"\"STX\"  ,STX  ,5 ,2 ,DIR    ",
+		"\"SUBA\" ,SUBA ,4 ,2 ,IDX    ",
+		"\"CMPA\" ,CMPA ,4 ,2 ,IDX    ",
+		"\"SBCA\" ,SBCA ,4 ,2 ,IDX    ",
+		"\"SUBD\" ,SUBD ,4 ,2 ,IDX    ",
+		"\"ANDA\" ,ANDA ,4 ,2 ,IDX    ",
+		"\"BITA\" ,BITA ,4 ,2 ,IDX    ",
+		"\"LDA\"  ,LDA  ,4 ,2 ,IDX    ",
+		"\"STA\"  ,STA  ,4 ,2 ,IDX    ",
+		"\"EORA\" ,EORA ,4 ,2 ,IDX    ",
+		"\"ADCA\" ,ADCA ,4 ,2 ,IDX    ",
+		"\"ORA\"  ,ORA  ,4 ,2 ,IDX    ",
+		"\"ADDA\" ,ADDA ,4 ,2 ,IDX    ",
+		"\"CMPX\" ,CMPX ,6 ,2 ,IDX    ",
+		"\"JSR\"  ,JSR  ,7 ,2 ,IDX    ",
+		"\"LDX\"  ,LDX  ,5 ,2 ,IDX    ",
+		"\"STX\"  ,STX  ,5 ,2 ,IDX    ",
+		"\"SUBA\" ,SUBA ,5 ,3 ,EXT    ",
+		"\"CMPA\" ,CMPA ,5 ,3 ,EXT    ",
+		"\"SBCA\" ,SBCA ,5 ,3 ,EXT    ",
+		"\"SUBD\" ,SUBD ,7 ,3 ,EXT    ",
+		"\"ANDA\" ,ANDA ,5 ,3 ,EXT    ",
+		"\"BITA\" ,BITA ,5 ,3 ,EXT    ",
+		"\"LDA\"  ,LDA  ,5 ,3 ,EXT    ",
+		"\"STA\"  ,STA  ,5 ,3 ,EXT    ",
+		"\"EORA\" ,EORA ,5 ,3 ,EXT    ",
+		"\"ADCA\" ,ADCA ,5 ,3 ,EXT    ",
+		"\"ORA\"  ,ORA  ,5 ,3 ,EXT    ",
+		"\"ADDA\" ,ADDA ,5 ,3 ,EXT    ",
+		"\"CMPX\" ,CMPX ,7 ,3 ,EXT    ",
+		"\"JSR\"  ,JSR  ,8 ,3 ,EXT    ",
+		"\"LDX\"  ,LDX  ,6 ,3 ,EXT    ",
+		"\"STX\"  ,STX  ,6 ,3 ,EXT    ",
+		"\"SUBB\" ,SUBB ,2 ,2 ,IMM    ",
+		"\"CMPB\" ,CMPB ,2 ,2 ,IMM    ",
+		"\"SBCB\" ,SBCB ,2 ,2 ,IMM    ",
+		"\"ADDD\" ,ADDD ,4 ,3 ,IMM    ",
+		"\"ANDB\" ,ANDB ,2 ,2 ,IMM    ",
+		"\"BITB\" ,BITB ,2 ,2 ,IMM    ",
+		"\"LDB\"  ,LDB  ,2 ,2 ,IMM    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"EORB\" ,EORB ,2 ,2 ,IMM    ",
+		"\"ADCB\" ,ADCB ,2 ,2 ,IMM    ",
+		"\"ORB\"  ,ORB  ,2 ,2 ,IMM    ",
+		"\"ADDB\" ,ADDB ,2 ,2 ,IMM    ",
+		"\"LDD\"  ,LDD  ,3 ,3 ,IMM    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"LDU\"  ,LDU  ,3 ,3 ,IMM    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"SUBB\" ,SUBB ,4 ,2 ,DIR    ",
+		"\"CMPB\" ,CMPB ,4 ,2 ,DIR    ",
+		"\"SBCB\" ,SBCB ,4 ,2 ,DIR    ",
+		"\"ADDD\" ,ADDD ,6 ,2 ,DIR    ",
+		"\"ANDB\" ,ANDB ,4 ,2 ,DIR    ",
+		"\"BITB\" ,BITB ,4 ,2 ,DIR    ",
+		"\"LDB\"  ,LDB  ,4 ,2 ,DIR    ",
+		"\"STB\"  ,STB  ,4 ,2 ,DIR    ",
+		"\"EORB\" ,EORB ,4 ,2 ,DIR    ",
+		"\"ADCB\" ,ADCB ,4 ,2 ,DIR    ",
+		"\"ORB\"  ,ORB  ,4 ,2 ,DIR    ",
+		"\"ADDB\" ,ADDB ,4 ,2 ,DIR    ",
+		"\"LDD\"  ,LDD  ,5 ,2 ,DIR    ",
+		"\"STD\"  ,STD  ,5 ,2 ,DIR    ",
+		"\"LDU\"  ,LDU  ,5 ,2 ,DIR    ",
+		"\"STU\"  ,STU  ,5 ,2 ,DIR    ",
+		"\"SUBB\" ,SUBB ,4 ,2 ,IDX    ",
+		"\"CMPB\" ,CMPB ,4 ,2 ,IDX    ",
+		"\"SBCB\" ,SBCB ,4 ,2 ,IDX    ",
+		"\"ADDD\" ,ADDD ,6 ,2 ,IDX    ",
+		"\"ANDB\" ,ANDB ,4 ,2 ,IDX    ",
+		"\"BITB\" ,BITB ,4 ,2 ,IDX    ",
+		"\"LDB\"  ,LDB  ,4 ,2 ,IDX    ",
+		"\"STB\"  ,STB  ,4 ,2 ,IDX    ",
+		"\"EORB\" ,EORB ,4 ,2 ,IDX    ",
+		"\"ADCB\" ,ADCB ,4 ,2 ,IDX    ",
+		"\"ORB\"  ,ORB  ,4 ,2 ,IDX    ",
+		"\"ADDB\" ,ADDB ,4 ,2 ,IDX    ",
+		"\"LDD\"  ,LDD  ,5 ,2 ,IDX    ",
+		"\"STD\"  ,STD  ,5 ,2 ,IDX    ",
+		"\"LDU\"  ,LDU  ,5 ,2 ,IDX    ",
+		"\"STU\"  ,STU  ,5 ,2 ,IDX    ",
+		"\"SUBB\" ,SUBB ,5 ,3 ,EXT    ",
+		"\"CMPB\" ,CMPB ,5 ,3 ,EXT    ",
+		"\"SBCB\" ,SBCB ,5 ,3 ,EXT    ",
+		"\"ADDD\" ,ADDD ,7 ,3 ,EXT    ",
+		"\"ANDB\" ,ANDB ,5 ,3 ,EXT    ",
+		"\"BITB\" ,BITB ,5 ,3 ,EXT    ",
+		"\"LDB\"  ,LDB  ,5 ,3 ,EXT    ",
+		"\"STB\"  ,STB  ,5 ,3 ,EXT    ",
+		"\"EORB\" ,EORB ,5 ,3 ,EXT    ",
+		"\"ADCB\" ,ADCB ,5 ,3 ,EXT    ",
+		"\"ORB\"  ,ORB  ,5 ,3 ,EXT    ",
+		"\"ADDB\" ,ADDB ,5 ,3 ,EXT    ",
+		"\"LDD\"  ,LDD  ,6 ,3 ,EXT    ",
+		"\"STD\"  ,STD  ,6 ,3 ,EXT    ",
+		"\"LDU\"  ,LDU  ,6 ,3 ,EXT    ",
+		"\"STU\"  ,STU  ,6 ,3 ,EXT    ",
+	},
+	{	// Opcodes_p2.csv
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"***\"  ,nullptr,0,0,nullptr",
+		"\"***\"  ,nullptr,0,0,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"LBRN\" ,LBRN ,5 ,4 ,REL    ",
+		"\"LBHI\" ,LBHI ,5 ,4 ,REL    ",
+		"\"LBLS\" ,LBLS ,5 ,4 ,REL    ",
+		"\"LBHS/LBCC\",LBCC ,5 ,4 ,REL",
+		"\"LBCS/LBLO\",LBCS ,5 ,4 ,REL",
+		"\"LBNE\" ,LBNE ,5 ,4 ,REL    ",
+		"\"LBEQ\" ,LBEQ ,5 ,4 ,REL    ",
+		"\"LBVC\" ,LBVC ,5 ,4 ,REL    ",
+		"\"LBVS\" ,LBVS ,5 ,4 ,REL    ",
+		"\"LBPL\" ,LBPL ,5 ,4 ,REL    ",
+		"\"LBMI\" ,LBMI ,5 ,4 ,REL    ",
+		"\"LBGE\" ,LBGE ,5 ,4 ,REL    ",
+		"\"LBLT\" ,LBLT ,5 ,4 ,REL    ",
+		"\"LBGT\" ,LBGT ,5 ,4 ,REL    ",
+		"\"LBLE\" ,LBLE ,5 ,4 ,REL    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"SWI2\" ,SWI2 ,20,2 ,INH    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"CMPD\" ,CMPD ,5 ,4 ,IMM    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"CMPY\" ,CMPY ,5 ,4 ,IMM    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"LDY\"  ,LDY  ,4 ,4 ,IMM    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"CMPD\" ,CMPD ,7 ,3 ,DIR    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"CMPY\" ,CMPY ,7 ,3 ,DIR    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"LDY\"  ,LDY  ,6 ,3 ,DIR    ",
+		"\"STY\"  ,STY  ,6 ,3 ,DIR    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"CMPD\" ,CMPD ,7 ,3 ,IDX    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"CMPY\" ,CMPY ,7 ,3 ,IDX    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"LDY\"  ,LDY  ,6 ,3 ,IDX    ",
+		"\"STY\"  ,STY  ,6 ,3 ,IDX    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"CMPD\" ,CMPD ,8 ,4 ,EXT    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"CMPY\" ,CMPY ,8 ,4 ,EXT    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"LDY\"  ,LDY  ,7 ,4 ,EXT    ",
+		"\"STY\"  ,STY  ,7 ,4 ,EXT    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"LDS\"  ,LDS  ,4 ,4 ,IMM    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"LDS\"  ,LDS  ,6 ,4 ,DIR    ",
+		"\"STS\"  ,STS  ,6 ,3 ,DIR    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"LDS\"  ,LDS  ,6 ,3 ,IDX    ",
+		"\"STS\"  ,STS  ,6 ,3 ,IDX    ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"LDS\"  ,LDS  ,7 ,4 ,EXT    ",
+		"\"STS\"  ,STS  ,7 ,4 ,EXT    ",
+	},
+	{	// Opcodes_p3.csv
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"***\"  ,nullptr,0,0,nullptr",
+		"\"***\"  ,nullptr,0,0,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"SWI3\" ,SWI3 ,20,2 ,INH     ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"CMPU\" ,CMPU ,5 ,4 ,IMM     ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"CMPS\" ,CMPS ,5 ,4 ,IMM     ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"CMPU\" ,CMPU ,7 ,3 ,DIR     ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"CMPS\" ,CMPS ,7 ,3 ,DIR     ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"CMPU\" ,CMPU ,7 ,3 ,IDX     ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"CMPS\" ,CMPS ,7 ,3 ,IDX     ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"CMPU\" ,CMPU ,8 ,4 ,EXT     ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"CMPS\" ,CMPS ,8, 4 ,EXT     ",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+		"\"???\"  ,XXX  ,1 ,1 ,nullptr",
+	},
+};
+
+
+//*****************************************************************************
+//	IndexedName[postbyte]
+//*****************************************************************************
+//	Cold table: assembler syntax of each indexed post byte.
+//*****************************************************************************
+constexpr const char* const Mc6809::IndexedName[256] =
+{
+	"0,X",       "1,X",       "2,X",       "3,X",       "4,X",       "5,X",       "6,X",       "7,X",
+	"8,X",       "9,X",       "10,X",      "11,X",      "12,X",      "13,X",      "14,X",      "15,X",
+	"-16,X",     "-15,X",     "-14,X",     "-13,X",     "-12,X",     "-11,X",     "-10,X",     "-9,X",
+	"-8,X",      "-7,X",      "-6,X",      "-5,X",      "-4,X",      "-3,X",      "-2,X",      "-1,X",
+	"0,Y",       "1,Y",       "2,Y",       "3,Y",       "4,Y",       "5,Y",       "6,Y",       "7,Y",
+	"8,Y",       "9,Y",       "10,Y",      "11,Y",      "12,Y",      "13,Y",      "14,Y",      "15,Y",
+	"-16,Y",     "-15,Y",     "-14,Y",     "-13,Y",     "-12,Y",     "-11,Y",     "-10,Y",     "-9,Y",
+	"-8,Y",      "-7,Y",      "-6,Y",      "-5,Y",      "-4,Y",      "-3,Y",      "-2,Y",      "-1,Y",
+	"0,U",       "1,U",       "2,U",       "3,U",       "4,U",       "5,U",       "6,U",       "7,U",
+	"8,U",       "9,U",       "10,U",      "11,U",      "12,U",      "13,U",      "14,U",      "15,U",
+	"-16,U",     "-15,U",     "-14,U",     "-13,U",     "-12,U",     "-11,U",     "-10,U",     "-9,U",
+	"-8,U",      "-7,U",      "-6,U",      "-5,U",      "-4,U",      "-3,U",      "-2,U",      "-1,U",
+	"0,S",       "1,S",       "2,S",       "3,S",       "4,S",       "5,S",       "6,S",       "7,S",
+	"8,S",       "9,S",       "10,S",      "11,S",      "12,S",      "13,S",      "14,S",      "15,S",
+	"-16,S",     "-15,S",     "-14,S",     "-13,S",     "-12,S",     "-11,S",     "-10,S",     "-9,S",
+	"-8,S",      "-7,S",      "-6,S",      "-5,S",      "-4,S",      "-3,S",      "-2,S",      "-1,S",
+	",X+",       ",X++",      ",-X",       ",--X",      ",X",        "B,X",       "A,X",       "illegal",
+	"n8,X",      "n16,X",     "illegal",   "D,X",       "n8,PCR",    "n16,PCR",   "illegal",   "illegal",
+	"illegal",   "[,X++]",    "illegal",   "[,--X]",    "[,X]",      "[B,X]",     "[A,X]",     "illegal",
+	"[n8,X]",    "[n16,X]",   "illegal",   "[D,X]",     "[n8,PCR]",  "[n16,PCR]", "illegal",   "[n16]",
+	",Y+",       ",Y++",      ",-Y",       ",--Y",      ",Y",        "B,Y",       "A,Y",       "illegal",
+	"n8,Y",      "n16,Y",     "illegal",   "D,Y",       "n8,PCR",    "n16,PCR",   "illegal",   "illegal",
+	"illegal",   "[,Y++]",    "illegal",   "[,--Y]",    "[,Y]",      "[B,Y]",     "[A,Y]",     "illegal",
+	"[n8,Y]",    "[n16,Y]",   "illegal",   "[D,Y]",     "[n8,PCR]",  "[n16,PCR]", "illegal",   "[n16]",
+	",U+",       ",U++",      ",-U",       ",--U",      ",U",        "B,U",       "A,U",       "illegal",
+	"n8,U",      "n16,U",     "illegal",   "D,U",       "n8,PCR",    "n16,PCR",   "illegal",   "illegal",
+	"illegal",   "[,U++]",    "illegal",   "[,--U]",    "[,U]",      "[B,U]",     "[A,U]",     "illegal",
+	"[n8,U]",    "[n16,U]",   "illegal",   "[D,U]",     "[n8,PCR]",  "[n16,PCR]", "illegal",   "[n16]",
+	",S+",       ",S++",      ",-S",       ",--S",      ",S",        "B,S",       "A,S",       "illegal",
+	"n8,S",      "n16,S",     "illegal",   "D,S",       "n8,PCR",    "n16,PCR",   "illegal",   "illegal",
+	"illegal",   "[,S++]",    "illegal",   "[,--S]",    "[,S]",      "[B,S]",     "[A,S]",     "illegal",
+	"[n8,S]",    "[n16,S]",   "illegal",   "[D,S]",     "[n8,PCR]",  "[n16,PCR]", "illegal",   "[n16]",
+};
+#endif
@@ -0,0 +1,81 @@
+/******************************************************************************
+*		   File: Mc6809Profile.cpp
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/21
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+//	Opcode profile.
+//
+//	With USE_OPCODE_PROFILE the core counts every instruction it starts and
+// the cycles it takes against its (page, opcode), and every indexed post
+// byte it decodes. Interrupt sequences are not counted. SaveProfile() writes
+// the counts out as three sheets laid out like Opcodes_p1/p2/p3.csv, each
+// row the opcode's own row with the execution and cycle counts added on the
+// end, so they line up with the sheets the opcode tables are built from.
+//*****************************************************************************
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "Mc6809.h"
+
+#ifdef USE_OPCODE_PROFILE
+
+
+//*****************************************************************************
+//	ClearProfile()
+//*****************************************************************************
+//	Zeroes every count.
+//*****************************************************************************
+void Mc6809::ClearProfile()
+{
+	memset(profile, 0x00, sizeof(profile));
+	memset(postByteCount, 0x00, sizeof(postByteCount));
+	profiling = nullptr;
+}
+
+
+//*****************************************************************************
+//	SaveProfile()
+//*****************************************************************************
+//	Writes the counts to four CSV files:
+//		<prefix>_p1.csv, _p2.csv, _p3.csv	sheet row, executions, cycles
+//		<prefix>_idx.csv					post byte, syntax, count
+//	Every opcode and post byte gets a row, in table order, counted or not.
+//*****************************************************************************
+//	Returns:
+//	bool - false if a file could not be written.
+//*****************************************************************************
+bool Mc6809::SaveProfile(const char* prefix)
+{
+	static const char* const suffix[4] = { "_p1.csv", "_p2.csv", "_p3.csv", "_idx.csv" };
+
+	for (uint8_t sheet = 0; sheet < 4; sheet++)
+	{
+		std::string name = std::string(prefix) + suffix[sheet];
+		std::FILE* file = std::fopen(name.c_str(), "w");
+
+		if (file == nullptr)
+			return(false);
+
+		for (uint16_t code = 0; code < 256; code++)
+		{
+			if (sheet < 3)
+				std::fprintf(file, "%s,%" PRIu64 ",%" PRIu64 "\n", OpCodeSheet[sheet][code],
+					profile[sheet][code].executions, profile[sheet][code].cycles);
+			else
+				std::fprintf(file, "$%02X,\"%s\",%" PRIu64 "\n", code, IndexedName[code], postByteCount[code]);
+		}
+
+		if (std::fclose(file) != 0)
+			return(false);
+	}
+	return(true);
+}
+
+#endif
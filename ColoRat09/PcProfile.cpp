@@ -0,0 +1,281 @@
+/******************************************************************************
+*		   File: PcProfile.cpp
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/21
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+#include <algorithm>
+#include <cctype>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include "PcProfile.h"
+
+
+//*****************************************************************************
+//	ParseHex()
+//*****************************************************************************
+//	Reads a hex value, with or without a $ or 0x in front. Only the low 16
+// bits are kept; the linkers that write wider values put the area or bank
+// above them.
+//*****************************************************************************
+static bool ParseHex(std::string text, uint16_t& value)
+{
+	if ((text.size() > 1) && (text[0] == '$'))
+		text.erase(0, 1);
+	else if ((text.size() > 2) && (text[0] == '0') && ((text[1] == 'x') || (text[1] == 'X')))
+		text.erase(0, 2);
+
+	if (text.empty() || (text.size() > 8))
+		return(false);
+	for (char c : text)
+		if (!isxdigit((unsigned char)c))
+			return(false);
+
+	value = (uint16_t)strtoul(text.c_str(), nullptr, 16);
+	return(true);
+}
+
+
+//*****************************************************************************
+//	IsSymbol()
+//*****************************************************************************
+//	True for something that reads as a label rather than a number.
+//*****************************************************************************
+static bool IsSymbol(const std::string& text)
+{
+	if (text.empty() || !(isalpha((unsigned char)text[0]) || (text[0] == '_') || (text[0] == '.') || (text[0] == '@')))
+		return(false);
+	return(text.find_first_of("=(),") == std::string::npos);
+}
+
+
+//*****************************************************************************
+//	PcProfile()
+//*****************************************************************************
+//	Takes a sample every cycles cycles (at least 1).
+//*****************************************************************************
+PcProfile::PcProfile(uint32_t cycles)
+{
+	interval = (cycles != 0) ? cycles : 1;
+}
+
+
+//*****************************************************************************
+//	Clear()
+//*****************************************************************************
+//	Drops every sample. Symbols are kept.
+//*****************************************************************************
+void PcProfile::Clear()
+{
+	for (std::vector<uint64_t>& buckets : histogram)
+		buckets.clear();
+}
+
+
+//*****************************************************************************
+//	LoadSymbols()
+//*****************************************************************************
+//	Adds the symbols in a map file for code in any bank, or for code in one
+// bank only.
+//*****************************************************************************
+//	Returns:
+//	bool - false if the file can't be read.
+//*****************************************************************************
+bool PcProfile::LoadSymbols(const char* fileName)
+{
+	return(Load(fileName, 0));
+}
+
+bool PcProfile::LoadSymbols(const char* fileName, const uint8_t bank)
+{
+	return(Load(fileName, (uint32_t)bank + 1));
+}
+
+
+//*****************************************************************************
+//	Load()
+//*****************************************************************************
+//	Reads a map file into symbols under scope. Lines are taken in any of
+// these forms, anything else is skipped:
+//		Symbol: NAME (file) = ADDR		LWLINK map
+//		ADDR  NAME						ASxxxx (aslink) map
+//		NAME  EQU  ADDR					symbol dumps, NAME = ADDR as well
+//		NAME  ADDR						LWASM symbol table
+//	ASxxxx area start and length symbols (s__, l__) are left out.
+//*****************************************************************************
+bool PcProfile::Load(const char* fileName, const uint32_t scope)
+{
+	std::ifstream file(fileName);
+	std::string line;
+
+	if (!file)
+		return(false);
+
+	while (std::getline(file, line))
+	{
+		std::istringstream in(line);
+		std::vector<std::string> token;
+		std::string word;
+		std::string name;
+		uint16_t address = 0;
+		bool found = false;
+
+		while (in >> word)
+			token.push_back(word);
+		if (token.size() < 2)
+			continue;
+
+		if (token[0] == "Symbol:")
+		{
+			std::vector<std::string>::iterator equals = std::find(token.begin(), token.end(), "=");
+
+			if ((equals != token.end()) && (equals + 1 != token.end()))
+			{
+				name = token[1];
+				found = ParseHex(*(equals + 1), address);
+			}
+		}
+		else if ((token.size() >= 3) && ((token[1] == "EQU") || (token[1] == "equ") || (token[1] == "=")))
+		{
+			name = token[0];
+			found = ParseHex(token[2], address);
+		}
+		else if (ParseHex(token[0], address) && IsSymbol(token[1]))
+		{
+			name = token[1];
+			found = true;
+		}
+		else if (IsSymbol(token[0]) && ParseHex(token[1], address))
+		{
+			name = token[0];
+			found = true;
+		}
+
+		if (!found || !IsSymbol(name) || (name.compare(0, 3, "s__") == 0) || (name.compare(0, 3, "l__") == 0))
+			continue;
+		symbols[(scope << 16) | address] = name;
+	}
+	return(true);
+}
+
+
+//*****************************************************************************
+//	Resolve()
+//*****************************************************************************
+//	Names the routine a PC falls in: the closest symbol at or below it in
+// the bank's own symbols, then in the symbols for every bank.
+//*****************************************************************************
+std::string PcProfile::Resolve(const uint8_t bank, const uint16_t pc) const
+{
+	const uint32_t scopes[2] = { (uint32_t)bank + 1, 0 };
+	char prefix[8];
+
+	snprintf(prefix, sizeof(prefix), "%02X:", bank);
+	for (uint32_t scope : scopes)
+	{
+		std::map<uint32_t, std::string>::const_iterator symbol = symbols.upper_bound((scope << 16) | pc);
+
+		if ((symbol == symbols.begin()) || ((--symbol)->first >> 16) != scope)
+			continue;
+		return((scope != 0) ? (prefix + symbol->second) : symbol->second);
+	}
+
+	char page[8];
+	snprintf(page, sizeof(page), "$%02Xxx", pc >> 8);
+	return(prefix + std::string(page));
+}
+
+
+//*****************************************************************************
+//	Routines()
+//*****************************************************************************
+//	Cycles spent in each routine, estimated as samples times the interval.
+//*****************************************************************************
+std::map<std::string, uint64_t> PcProfile::Routines() const
+{
+	std::map<std::string, uint64_t> routines;
+
+	for (uint16_t bank = 0; bank < 256; bank++)
+	{
+		const std::vector<uint64_t>& buckets = histogram[bank];
+
+		for (uint32_t pc = 0; pc < buckets.size(); pc++)
+			if (buckets[pc] != 0)
+				routines[Resolve((uint8_t)bank, (uint16_t)pc)] += buckets[pc] * interval;
+	}
+	return(routines);
+}
+
+
+//*****************************************************************************
+//	SaveReport()
+//*****************************************************************************
+//	Writes the top routines by cycles as a flat text table.
+//*****************************************************************************
+//	Returns:
+//	bool - false if the file can't be written.
+//*****************************************************************************
+bool PcProfile::SaveReport(const char* fileName, const uint32_t top) const
+{
+	std::map<std::string, uint64_t> routines = Routines();
+	std::vector<std::pair<uint64_t, std::string>> ranked;
+	uint64_t total = 0;
+
+	for (const std::pair<const std::string, uint64_t>& routine : routines)
+	{
+		ranked.push_back(std::make_pair(routine.second, routine.first));
+		total += routine.second;
+	}
+	std::sort(ranked.begin(), ranked.end(), [](const std::pair<uint64_t, std::string>& a, const std::pair<uint64_t, std::string>& b)
+		{ return((a.first != b.first) ? (a.first > b.first) : (a.second < b.second)); });
+
+	std::FILE* file = std::fopen(fileName, "w");
+	if (file == nullptr)
+		return(false);
+
+	std::fprintf(file, "%14s %7s  %s\n", "cycles", "%", "routine");
+	for (uint32_t n = 0; (n < top) && (n < ranked.size()); n++)
+		std::fprintf(file, "%14" PRIu64 " %7.2f  %s\n", ranked[n].first, (100.0 * ranked[n].first) / total, ranked[n].second.c_str());
+	std::fprintf(file, "%14" PRIu64 " %7.2f  total, %u cycle interval\n", total, (total != 0) ? 100.0 : 0.0, interval);
+
+	return(std::fclose(file) == 0);
+}
+
+
+//*****************************************************************************
+//	SaveCollapsed()
+//*****************************************************************************
+//	Writes one "frame;frame cycles" line per routine, the collapsed stack
+// format flame graph tools read. There is no call stack to walk, so each
+// stack is the bank and the routine.
+//*****************************************************************************
+//	Returns:
+//	bool - false if the file can't be written.
+//*****************************************************************************
+bool PcProfile::SaveCollapsed(const char* fileName) const
+{
+	std::FILE* file = std::fopen(fileName, "w");
+	if (file == nullptr)
+		return(false);
+
+	for (const std::pair<const std::string, uint64_t>& routine : Routines())
+	{
+		std::string stack = routine.first;
+		std::string::size_type colon = stack.find(':');
+
+		if (colon != std::string::npos)
+			stack = "bank " + stack.substr(0, colon) + ";" + stack.substr(colon + 1);
+		std::replace(stack.begin(), stack.end(), ' ', '_');
+		std::fprintf(file, "%s %" PRIu64 "\n", stack.c_str(), routine.second);
+	}
+
+	return(std::fclose(file) == 0);
+}
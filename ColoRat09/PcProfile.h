@@ -0,0 +1,69 @@
+/******************************************************************************
+*		   File: PcProfile.h
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/21
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+
+//*****************************************************************************
+//	Statistical profile of guest code. The CPU calls Sample() with the PC of
+// the instruction running once every Interval() cycles, and each sample
+// lands in a 64K bucket histogram for the bank the PC was mapped to (see
+// MMU::Bank()). A bank's histogram is only allocated once it is sampled.
+//
+//	Buckets are put down to routines with symbols from assembler or linker
+// map files. A symbol loaded for a bank is tried first, then the symbols
+// loaded for every bank. Samples with no symbol below them are reported by
+// bank and 256 byte page.
+//*****************************************************************************
+class PcProfile
+{
+private:
+	uint32_t interval;
+	std::vector<uint64_t> histogram[256];				// [bank][pc], empty until sampled
+
+	// (scope << 16) | address, scope 0 = every bank, bank + 1 = that bank only
+	std::map<uint32_t, std::string> symbols;
+
+protected:
+public:
+
+private:
+	bool Load(const char* fileName, uint32_t scope);
+	std::string Resolve(uint8_t bank, uint16_t pc) const;
+	std::map<std::string, uint64_t> Routines() const;
+
+protected:
+public:
+	PcProfile(uint32_t cycles = 1000);
+	~PcProfile() {};
+
+	uint32_t Interval() const { return(interval); }
+
+	void Sample(const uint8_t bank, const uint16_t pc)
+	{
+		std::vector<uint64_t>& buckets = histogram[bank];
+
+		if (buckets.empty())
+			buckets.resize(0x10000);
+		buckets[pc]++;
+	}
+
+	void Clear();
+	bool LoadSymbols(const char* fileName);
+	bool LoadSymbols(const char* fileName, uint8_t bank);
+
+	bool SaveReport(const char* fileName, uint32_t top = 50) const;
+	bool SaveCollapsed(const char* fileName) const;
+};
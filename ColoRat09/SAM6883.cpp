@@ -1 +1,116 @@
+/******************************************************************************
+*		   File: SAM6883.cpp
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/21
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+#include <cstring>
+
 #include "SAM6883.h"
+
+
+//*****************************************************************************
+//	SAM6883()
+//*****************************************************************************
+//	Powers up with every control bit clear: map type 0, page 0, 4K memory
+// size, and RAM cleared. ROM reads as $FF until LoadROM() is called.
+//*****************************************************************************
+SAM6883::SAM6883()
+{
+	memset(ram, 0x00, sizeof(ram));
+	memset(rom, 0xff, sizeof(rom));
+	control = 0x0000;
+
+	Remap();
+}
+
+
+//*****************************************************************************
+//	LoadROM()
+//*****************************************************************************
+//	Copies a ROM image into the $8000-$FEFF ROM space. Returns false if it
+// does not fit.
+//*****************************************************************************
+bool SAM6883::LoadROM(uint16_t address, const uint8_t* data, uint16_t length)
+{
+	if ((address < 0x8000) || ((uint32_t)address + length > 0x10000))
+		return(false);
+
+	memcpy(&rom[address - 0x8000], data, length);
+	MemoryChanged();
+	return(true);
+}
+
+
+//*****************************************************************************
+//	Remap()
+//*****************************************************************************
+//	Rebuilds the page table from P1, M and TY. Only called when one of those
+// control bits changes.
+//*****************************************************************************
+void SAM6883::Remap()
+{
+	// P1 only swaps the lower 32K when 64K DRAMs are selected
+	uint8_t* low = ((control & P1) && ((control & M) == (0x02 << 13))) ? &ram[0x8000] : &ram[0x0000];
+
+	MapPages(0x00, 0x80, low, low);
+	if (control & TY)
+		MapPages(0x80, 0x7f, &ram[0x8000], &ram[0x8000]);
+	else
+		MapPages(0x80, 0x7f, &rom[0x0000], &ram[0x8000]);
+	MapPages(0xff, 1, nullptr, nullptr);
+}
+
+
+//*****************************************************************************
+//	Read()
+//*****************************************************************************
+//	Reads anywhere in the map, though the CPU only calls it for the I/O page.
+//	The PIAs are not emulated yet, so the rest of the I/O page reads as $FF.
+//*****************************************************************************
+uint8_t SAM6883::Read(uint16_t address, bool /*readOnly*/)
+{
+	const uint8_t* page = ReadPage(address);
+
+	if (page != nullptr)
+		return(page[address & 0xff]);
+	if (address >= 0xfff0)
+		return(ReadPage(0xbff0)[0xf0 + (address & 0x0f)]);
+	return(0xff);
+}
+
+
+//*****************************************************************************
+//	Write()
+//*****************************************************************************
+//	Writes anywhere in the map, though the CPU only calls it for the I/O page.
+//	Each SAM control bit has a pair of addresses: even clears, odd sets.
+//*****************************************************************************
+void SAM6883::Write(uint16_t address, uint8_t byte)
+{
+	uint8_t* page = WritePage(address);
+
+	if (page != nullptr)
+	{
+		page[address & 0xff] = byte;
+		return;
+	}
+
+	if ((address >= 0xffc0) && (address <= 0xffdf))
+	{
+		uint16_t bit = 1 << ((address - 0xffc0) >> 1);
+		uint16_t old = control;
+
+		if (address & 0x01)
+			control |= bit;
+		else
+			control &= ~bit;
+
+		if ((old ^ control) & (P1 | M | TY))
+			Remap();
+	}
+}
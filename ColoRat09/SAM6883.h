@@ -1,14 +1,60 @@
+/******************************************************************************
+*		   File: SAM6883.h
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/21
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
 #pragma once
+
+#include <cstdint>
+
 #include "MMU.h"
+
+
+//*****************************************************************************
+//	MC6883 / SN74LS783 Synchronous Address Multiplexer, as used in the CoCo 1
+// and 2, with 64K of RAM and 16K of ROM fitted.
+//
+//	$0000-$7FFF	RAM (upper or lower 32K picked by P1)
+//	$8000-$FEFF	ROM (map type 0, writes go to the RAM underneath) or RAM (map type 1)
+//	$FF00-$FFFF	I/O; SAM control bits at $FFC0-$FFDF, vectors at $FFF0 read from $BFF0
+//*****************************************************************************
 class SAM6883 : public MMU
 {
 private:
+	enum CONTROL : uint16_t
+	{
+		V  = (0x07 << 0),	// VDG display mode
+		F  = (0x7f << 3),	// display offset
+		P1 = (1 << 10),		// page #1
+		R  = (0x03 << 11),	// MPU rate
+		M  = (0x03 << 13),	// memory size
+		TY = (1 << 15),		// map type
+	};
+
+	uint8_t ram[0x10000];
+	uint8_t rom[0x8000];
+	uint16_t control;
+
 protected:
 public:
 
 private:
+	void Remap();
+
 protected:
 public:
+	SAM6883();
+	~SAM6883() {};
 
-};
+	bool LoadROM(uint16_t address, const uint8_t* data, uint16_t length);
+	uint16_t GetControl() const { return(control); }
 
+	uint8_t Read(uint16_t address, bool readOnly = false) override;
+	void Write(uint16_t address, uint8_t byte) override;
+
+};
@@ -1 +1,6 @@
 #include "VDP.h"
+
+
+VDP::~VDP()
+{
+}
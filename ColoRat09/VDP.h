@@ -1,9 +1,14 @@
 #pragma once
-class VDP
+
+#include "ClockedDevice.h"
+
+class VDP : public ClockedDevice
 {
 public:
 	virtual ~VDP() = 0;
 
-
+	// nothing is drawn yet, so there is nothing to catch up, but a CatchUp()
+	// for a tick already passed must not move it back
+	void AdvanceTo(uint64_t tick) override { if (tick > reached) SkipTo(tick); }
 };
 
@@ -0,0 +1,390 @@
+/******************************************************************************
+*		   File: CoreBench.cpp
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/21
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+//	Benchmark: emulated speed of the Mc6809 core on fixed 6809 workloads.
+//
+//	Each workload is a small hand assembled program, run from reset on 64K of
+// FlatRAM through Run() in slices, for a fixed time per workload. The same
+// number of slices is then replayed with Step() to count the instructions,
+// and the program is let finish its current pass so its result can be
+// checked. Results go to stdout (or the file given) as CSV, one row per
+// workload, so runs can be compared between releases.
+//
+//	When Run() comes back early because the CPU went idle, the rest of the
+// slice is skipped, as a machine would. Those cycles are counted in
+// idle_cycles only. cycles and the rates are what was actually executed.
+//
+//		CoreBench [seconds per workload] [results.csv]
+//
+//	Every program keeps a pass count at $01, the NMI handler counts at $02.
+//*****************************************************************************
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "FlatRAM.h"
+#include "Mc6809.h"
+
+
+//*****************************************************************************
+//	The core with the one piece of CPU it leaves to the machine
+//*****************************************************************************
+class BenchCpu : public Mc6809
+{
+public:
+	BenchCpu(MMU* device) : Mc6809(device) {};
+
+	uint8_t HardwareRESET() override
+	{
+		Assert(LINE::RESET);
+		return(0);
+	}
+};
+
+
+//*****************************************************************************
+//	Workloads, all at $1000 with the stack at $7F00
+//*****************************************************************************
+
+// ALU: 200 rounds of 8 bit arithmetic and logic, result to $10
+static const uint8_t AluLoop[] =
+{
+	0x10, 0xce, 0x7f, 0x00,		// 1000	LDS		#$7F00
+	0x86, 0x00,					// 1004	LDA		#$00
+	0xc6, 0xc8,					// 1006	LDB		#200
+	0x8b, 0x35,					// 1008	ADDA	#$35
+	0x88, 0x5a,					// 100A	EORA	#$5A
+	0x84, 0x7f,					// 100C	ANDA	#$7F
+	0x8a, 0x01,					// 100E	ORA		#$01
+	0x89, 0x03,					// 1010	ADCA	#$03
+	0x80, 0x11,					// 1012	SUBA	#$11
+	0x5a,						// 1014	DECB
+	0x26, 0xf1,					// 1015	BNE		$1008
+	0x97, 0x10,					// 1017	STA		<$10
+	0x0c, 0x01,					// 1019	INC		<$01
+	0x20, 0xe7,					// 101B	BRA		$1004
+};
+
+// indexed copy of $2000-$20FF to $3000, words and bytes
+static const uint8_t IndexedCopy[] =
+{
+	0x10, 0xce, 0x7f, 0x00,		// 1000	LDS		#$7F00
+	0x8e, 0x20, 0x00,			// 1004	LDX		#$2000
+	0x10, 0x8e, 0x30, 0x00,		// 1007	LDY		#$3000
+	0xec, 0x81,					// 100B	LDD		,X++
+	0xed, 0xa1,					// 100D	STD		,Y++
+	0xa6, 0x80,					// 100F	LDA		,X+
+	0xa7, 0xa0,					// 1011	STA		,Y+
+	0xa6, 0x80,					// 1013	LDA		,X+
+	0xa7, 0xa0,					// 1015	STA		,Y+
+	0x8c, 0x21, 0x00,			// 1017	CMPX	#$2100
+	0x26, 0xef,					// 101A	BNE		$100B
+	0x0c, 0x01,					// 101C	INC		<$01
+	0x20, 0xe4,					// 101E	BRA		$1004
+};
+
+// bubble sort of 32 bytes at $2000, refilled from a running seed at $04
+static const uint8_t BranchSort[] =
+{
+	0x10, 0xce, 0x7f, 0x00,		// 1000	LDS		#$7F00
+	0x8e, 0x20, 0x00,			// 1004	LDX		#$2000
+	0x96, 0x04,					// 1007	LDA		<$04
+	0xc6, 0x20,					// 1009	LDB		#32
+	0x8b, 0x3b,					// 100B	ADDA	#$3B
+	0x88, 0xa5,					// 100D	EORA	#$A5
+	0xa7, 0x80,					// 100F	STA		,X+
+	0x5a,						// 1011	DECB
+	0x26, 0xf7,					// 1012	BNE		$100B
+	0x97, 0x04,					// 1014	STA		<$04
+	0x0f, 0x05,					// 1016	CLR		<$05		pass
+	0x8e, 0x20, 0x00,			// 1018	LDX		#$2000
+	0x10, 0x8e, 0x00, 0x1f,		// 101B	LDY		#31
+	0xa6, 0x84,					// 101F	LDA		,X
+	0xe6, 0x01,					// 1021	LDB		1,X
+	0xa1, 0x01,					// 1023	CMPA	1,X
+	0x23, 0x06,					// 1025	BLS		$102D
+	0xe7, 0x84,					// 1027	STB		,X
+	0xa7, 0x01,					// 1029	STA		1,X
+	0x0c, 0x05,					// 102B	INC		<$05
+	0x30, 0x01,					// 102D	LEAX	1,X
+	0x31, 0x3f,					// 102F	LEAY	-1,Y
+	0x26, 0xec,					// 1031	BNE		$101F
+	0x0d, 0x05,					// 1033	TST		<$05
+	0x26, 0xdf,					// 1035	BNE		$1016
+	0x0c, 0x01,					// 1037	INC		<$01
+	0x20, 0xc9,					// 1039	BRA		$1004
+};
+
+// recursive fib(12) through BSR/RTS and PSHS/PULS, result to $10
+static const uint8_t CallRecursion[] =
+{
+	0x10, 0xce, 0x7f, 0x00,		// 1000	LDS		#$7F00
+	0xc6, 0x0c,					// 1004	LDB		#12
+	0x8d, 0x06,					// 1006	BSR		$100E
+	0xdd, 0x10,					// 1008	STD		<$10
+	0x0c, 0x01,					// 100A	INC		<$01
+	0x20, 0xf6,					// 100C	BRA		$1004
+	0xc1, 0x02,					// 100E	CMPB	#2			fib(B) to D, X kept
+	0x24, 0x02,					// 1010	BHS		$1014
+	0x4f,						// 1012	CLRA
+	0x39,						// 1013	RTS
+	0x34, 0x14,					// 1014	PSHS	X,B
+	0x8e, 0x00, 0x00,			// 1016	LDX		#0
+	0x5a,						// 1019	DECB
+	0x8d, 0xf2,					// 101A	BSR		$100E
+	0x30, 0x8b,					// 101C	LEAX	D,X
+	0x35, 0x04,					// 101E	PULS	B
+	0x34, 0x04,					// 1020	PSHS	B
+	0xc0, 0x02,					// 1022	SUBB	#2
+	0x8d, 0xe8,					// 1024	BSR		$100E
+	0x30, 0x8b,					// 1026	LEAX	D,X
+	0x35, 0x04,					// 1028	PULS	B
+	0x34, 0x10,					// 102A	PSHS	X
+	0x35, 0x06,					// 102C	PULS	A,B
+	0x35, 0x10,					// 102E	PULS	X
+	0x39,						// 1030	RTS
+};
+
+// SYNC until an interrupt, count it, wait again
+static const uint8_t SyncWait[] =
+{
+	0x10, 0xce, 0x7f, 0x00,		// 1000	LDS		#$7F00
+	0x1c, 0xaf,					// 1004	ANDCC	#$AF
+	0x13,						// 1006	SYNC
+	0x0c, 0x01,					// 1007	INC		<$01
+	0x20, 0xfb,					// 1009	BRA		$1006
+};
+
+// NMI handler for every workload
+static const uint8_t NmiHandler[] =
+{
+	0x0c, 0x02,					// 1100	INC		<$02
+	0x3b,						// 1102	RTI
+};
+
+
+//*****************************************************************************
+//	Result checks, on memory at the end of a pass
+//*****************************************************************************
+static bool CheckAlu(const uint8_t* memory)
+{
+	uint8_t a = 0;
+	uint8_t carry = 0;
+
+	for (int round = 0; round < 200; round++)
+	{
+		uint16_t sum = a + 0x35;
+
+		carry = (sum > 0xff) ? 1 : 0;
+		a = (((uint8_t)sum ^ 0x5a) & 0x7f) | 0x01;
+		a = (uint8_t)(a + 0x03 + carry) - 0x11;
+	}
+	return(memory[0x10] == a);
+}
+
+static bool CheckCopy(const uint8_t* memory)
+{
+	return(memcmp(&memory[0x2000], &memory[0x3000], 0x100) == 0);
+}
+
+static bool CheckSort(const uint8_t* memory)
+{
+	for (int n = 0; n < 31; n++)
+		if (memory[0x2000 + n] > memory[0x2001 + n])
+			return(false);
+	return(true);
+}
+
+static bool CheckFib(const uint8_t* memory)
+{
+	return(((memory[0x10] << 8) | memory[0x11]) == 144);
+}
+
+static bool CheckSync(const uint8_t* memory)
+{
+	return(memory[0x01] == memory[0x02]);		// one wake up per NMI
+}
+
+
+//*****************************************************************************
+//	Workload table
+//*****************************************************************************
+struct WORKLOAD
+{
+	const char* name;
+	const uint8_t* code;
+	uint16_t length;
+	uint32_t slice;								// cycles per Run() call, emulated time passes in whole slices
+	bool nmi;									// NMI edge at the start of every slice but the first
+	bool (*check)(const uint8_t* memory);
+};
+
+static const WORKLOAD Workloads[] =
+{
+	{ "alu_loop",		AluLoop,		sizeof(AluLoop),		10000,	false,	CheckAlu },
+	{ "indexed_copy",	IndexedCopy,	sizeof(IndexedCopy),	10000,	false,	CheckCopy },
+	{ "branch_sort",	BranchSort,		sizeof(BranchSort),		10000,	false,	CheckSort },
+	{ "call_recursion",	CallRecursion,	sizeof(CallRecursion),	10000,	false,	CheckFib },
+	{ "interrupt_storm",AluLoop,		sizeof(AluLoop),		64,		true,	CheckAlu },
+	{ "sync_wait",		SyncWait,		sizeof(SyncWait),		1000,	true,	CheckSync },
+};
+
+
+//*****************************************************************************
+//	Load a workload into RAM with its vectors
+//*****************************************************************************
+static void Load(FlatRAM& ram, const WORKLOAD& workload)
+{
+	uint8_t* memory = ram.Memory();
+
+	memcpy(&memory[0x1000], workload.code, workload.length);
+	memcpy(&memory[0x1100], NmiHandler, sizeof(NmiHandler));
+	for (int n = 0; n < 0x100; n++)
+		memory[0x2000 + n] = (uint8_t)(n * 7 + 3);
+	memory[0xfffc] = 0x11;						// NMI
+	memory[0xfffd] = 0x00;
+	memory[0xfffe] = 0x10;						// RESET
+	memory[0xffff] = 0x00;
+	ram.MemoryChanged();
+}
+
+
+//*****************************************************************************
+//	One slice of emulated time, through Run() or (counting) through Step()
+//*****************************************************************************
+static void Edge(BenchCpu& cpu, const WORKLOAD& workload, const uint64_t slice)
+{
+	// a 6809 ignores NMI until S is loaded, the first slice gets that done
+	if (workload.nmi && (slice != 0))
+	{
+		cpu.Assert(Mc6809::LINE::NMI);
+		cpu.Deassert(Mc6809::LINE::NMI);
+	}
+}
+
+static uint32_t Slice(BenchCpu& cpu, const WORKLOAD& workload, const uint64_t slice, uint64_t& idle)
+{
+	Edge(cpu, workload, slice);
+
+	uint32_t used = cpu.Run(workload.slice);
+	if (used < workload.slice)
+		idle += workload.slice - used;
+	return(used);
+}
+
+static uint32_t SliceSteps(BenchCpu& cpu, const WORKLOAD& workload, const uint64_t slice, uint64_t& instructions)
+{
+	uint32_t used = 0;
+
+	Edge(cpu, workload, slice);
+	while ((used < workload.slice) && !cpu.Idle())
+	{
+		used += cpu.Step();
+		++instructions;
+	}
+	return((used > workload.slice) ? used : workload.slice);
+}
+
+
+//*****************************************************************************
+//	Time one workload
+//*****************************************************************************
+struct RESULT
+{
+	uint64_t cycles;									// executed
+	uint64_t idle;										// skipped while idle
+	uint64_t instructions;
+	double seconds;
+	bool ok;
+};
+
+static RESULT Measure(const WORKLOAD& workload, double seconds)
+{
+	RESULT result = { 0, 0, 0, 0.0, false };
+	uint64_t slices = 0;
+
+	{
+		FlatRAM* ram = new FlatRAM;
+		BenchCpu cpu(ram);
+
+		Load(*ram, workload);
+		auto start = std::chrono::steady_clock::now();
+		do
+		{
+			for (int n = 0; n < 256; n++)
+				result.cycles += Slice(cpu, workload, slices++, result.idle);
+			result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		} while (result.seconds < seconds);
+		delete ram;
+	}
+
+	// replay the same slices one instruction at a time to count them, then
+	// let the program finish its pass and check what it left behind
+	{
+		FlatRAM* ram = new FlatRAM;
+		BenchCpu cpu(ram);
+		const uint8_t* memory = ram->Memory();
+
+		Load(*ram, workload);
+		for (uint64_t n = 0; n < slices; n++)
+			SliceSteps(cpu, workload, n, result.instructions);
+
+		uint8_t pass = memory[0x01];
+		uint64_t used = 0;
+		uint64_t next = 0;
+		while ((memory[0x01] == pass) && (used < 100000000))
+		{
+			if (used >= next)
+			{
+				Edge(cpu, workload, slices++);
+				next += workload.slice;
+			}
+			used += cpu.Idle() ? 1 : cpu.Step();
+		}
+		result.ok = (memory[0x01] != pass) && workload.check(memory);
+		delete ram;
+	}
+
+	return(result);
+}
+
+
+int main(int argc, char* argv[])
+{
+	double seconds = (argc > 1) ? strtod(argv[1], nullptr) : 1.0;
+	std::FILE* out = (argc > 2) ? std::fopen(argv[2], "w") : stdout;
+	bool ok = true;
+
+	if (out == nullptr)
+	{
+		fprintf(stderr, "can't write %s\n", argv[2]);
+		return(2);
+	}
+
+	fprintf(out, "workload,cycles,idle_cycles,instructions,seconds,emulated_mhz,ns_per_cycle,instructions_per_second,check\n");
+	for (const WORKLOAD& workload : Workloads)
+	{
+		RESULT result = Measure(workload, seconds);
+
+		fprintf(out, "%s,%llu,%llu,%llu,%.6f,%.3f,%.3f,%.0f,%s\n", workload.name,
+			(unsigned long long)result.cycles, (unsigned long long)result.idle,
+			(unsigned long long)result.instructions, result.seconds,
+			result.cycles / result.seconds / 1e6, result.seconds * 1e9 / result.cycles,
+			result.instructions / result.seconds, result.ok ? "ok" : "FAIL");
+		fflush(out);
+		ok = ok && result.ok;
+	}
+
+	if (out != stdout)
+		std::fclose(out);
+	return(ok ? 0 : 1);
+}
@@ -0,0 +1,1322 @@
+/******************************************************************************
+*		   File: CoreCheck.cpp
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/21
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+//	Regression checks for the Mc6809 core: small programs with known results
+// run on 64K of FlatRAM, checked for registers, memory and cycle counts.
+// Then the Clock: event order, device timebases, slices and turbo, and
+// RunFor() giving the same machine state every time.
+//
+//		CoreCheck [check ...]
+//
+//	With no names every check is run. Prints a line per failure and a total
+// per check.
+//
+//	Exit code 0 if everything passed, 1 otherwise.
+//*****************************************************************************
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "Clock.h"
+#include "FlatRAM.h"
+#include "MMU.h"
+#include "Mc6809.h"
+#include "VDP.h"
+
+
+//*****************************************************************************
+//	The core with the one piece of CPU it leaves to the machine, and the
+// tables the checks look at
+//*****************************************************************************
+class CheckCpu : public Mc6809
+{
+public:
+	using Mc6809::IDX;
+	using Mc6809::IDXMODE;
+	using Mc6809::IndexedModes;
+	using Mc6809::Interpret;
+	using Mc6809::DispatchSwitch;
+#if defined(__GNUC__)
+	using Mc6809::DispatchTable;
+#endif
+
+	CheckCpu(MMU* device) : Mc6809(device) {};
+
+	uint8_t HardwareRESET() override
+	{
+		Assert(LINE::RESET);
+		return(0);
+	}
+};
+
+
+//*****************************************************************************
+//	A machine: RAM filled with fill, code at $1000, the reset vector pointing
+// at it and the reset sequence already run.
+//*****************************************************************************
+struct MACHINE
+{
+	FlatRAM ram;
+	CheckCpu cpu;
+
+	MACHINE(const uint8_t* code, size_t length, uint8_t fill = 0x00) : cpu(&ram)
+	{
+		uint8_t* memory = ram.Memory();
+
+		memset(memory, fill, 0x10000);
+		memcpy(&memory[0x1000], code, length);
+		memory[0xfffe] = 0x10;
+		memory[0xffff] = 0x00;
+		ram.MemoryChanged();
+		cpu.Step();
+	}
+
+	uint8_t* Memory() { return(ram.Memory()); }
+};
+
+static uint32_t failures = 0;
+
+static bool Expect(bool ok, const char* check, const char* what, uint32_t expected, uint32_t actual)
+{
+	if (!ok)
+	{
+		printf("%s: %s expected %X, got %X\n", check, what, expected, actual);
+		failures++;
+	}
+	return(ok);
+}
+
+
+//*****************************************************************************
+//	indexed - every post byte against the data sheet
+//*****************************************************************************
+//	The data sheet's indexed addressing table, worked out from the post byte
+// bits rather than looked up, so it can't drift with IndexedModes.
+// Extra cycles over the base indexed cost, -1 for an illegal post byte.
+static int8_t DataSheetCycles(uint8_t postByte, uint8_t& bytes, bool& indirect)
+{
+	static const int8_t direct[16] = { 2, 3, 2, 3, 0, 1, 1, -1, 1, 4, -1, 4, 1, 5, -1, -1 };
+	static const int8_t viaPointer[16] = { -1, 6, -1, 6, 3, 4, 4, -1, 4, 7, -1, 7, 4, 8, -1, 5 };
+	static const uint8_t programBytes[16] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 1, 2, 0, 2 };
+
+	bytes = 0;
+	indirect = false;
+	if ((postByte & 0x80) == 0)
+		return(1);									// n5,R
+
+	indirect = (postByte & 0x10) != 0;
+	bytes = programBytes[postByte & 0x0f];
+	return(indirect ? viaPointer[postByte & 0x0f] : direct[postByte & 0x0f]);
+}
+
+static void CheckIndexed()
+{
+	static const char* name = "indexed";
+	static const struct
+	{
+		uint8_t opcode;
+		uint8_t baseCycles;
+		const char* mnemonic;
+	} opcodes[] =
+	{
+		{ 0xa6, 4, "LDA" },
+		{ 0x30, 4, "LEAX" },
+		{ 0x6e, 3, "JMP" },
+	};
+	char what[64];
+
+	for (uint16_t postByte = 0; postByte < 0x100; postByte++)
+	{
+		const CheckCpu::IDXMODE& mode = CheckCpu::IndexedModes[postByte];
+		uint8_t bytes;
+		bool indirect;
+		int8_t extra = DataSheetCycles((uint8_t)postByte, bytes, indirect);
+
+		snprintf(what, sizeof(what), "post byte $%02X legal", postByte);
+		if (!Expect((extra < 0) == (mode.offset == CheckCpu::IDX::ILLEGAL), name, what, extra >= 0, mode.offset != CheckCpu::IDX::ILLEGAL) || (extra < 0))
+			continue;
+
+		snprintf(what, sizeof(what), "post byte $%02X table cycles", postByte);
+		Expect(mode.cycles == extra, name, what, extra, mode.cycles);
+		snprintf(what, sizeof(what), "post byte $%02X table bytes", postByte);
+		Expect(mode.pgmBytes == bytes, name, what, bytes, mode.pgmBytes);
+		snprintf(what, sizeof(what), "post byte $%02X table indirect", postByte);
+		Expect(mode.indirect == indirect, name, what, indirect, mode.indirect);
+
+		for (const auto& op : opcodes)
+		{
+			// registers all at $2000, D at $0001, memory all $40 so every
+			// pointer is $4040, which alone holds $5A
+			const uint8_t code[] =
+			{
+				0x8e, 0x20, 0x00,				// 1000	LDX		#$2000
+				0x10, 0x8e, 0x20, 0x00,			// 1003	LDY		#$2000
+				0xce, 0x20, 0x00,				// 1007	LDU		#$2000
+				0x10, 0xce, 0x20, 0x00,			// 100A	LDS		#$2000
+				0xcc, 0x00, 0x01,				// 100E	LDD		#$0001
+				op.opcode, (uint8_t)postByte, 0x30, 0x00	// 1011	op	n,R
+			};
+			MACHINE machine(code, sizeof(code), 0x40);
+			machine.Memory()[0x4040] = 0x5a;
+			machine.ram.MemoryChanged();
+
+			for (uint8_t setup = 0; setup < 5; setup++)
+				machine.cpu.Step();
+
+			uint8_t cycles = machine.cpu.Step();
+			Mc6809::REGISTERS regs;
+			machine.cpu.GetRegisters(regs);
+
+			snprintf(what, sizeof(what), "%s post byte $%02X cycles", op.mnemonic, postByte);
+			Expect(cycles == op.baseCycles + extra, name, what, op.baseCycles + extra, cycles);
+			if (op.opcode == 0xa6)
+			{
+				snprintf(what, sizeof(what), "%s post byte $%02X A", op.mnemonic, postByte);
+				Expect(regs.a == (indirect ? 0x5a : 0x40), name, what, indirect ? 0x5a : 0x40, regs.a);
+				snprintf(what, sizeof(what), "%s post byte $%02X PC", op.mnemonic, postByte);
+				Expect(regs.pc == 0x1013 + bytes, name, what, 0x1013 + bytes, regs.pc);
+			}
+		}
+	}
+}
+
+
+//*****************************************************************************
+//	interrupts - IRQ and FIRQ against the CC masks
+//*****************************************************************************
+//	The IRQ vector points at $2000 and the FIRQ vector at $2100, both a
+// branch to itself. S starts at $8000 in every program.
+static void Vectors(MACHINE& machine)
+{
+	uint8_t* memory = machine.Memory();
+
+	memory[0xfff6] = 0x21;
+	memory[0xfff7] = 0x00;
+	memory[0xfff8] = 0x20;
+	memory[0xfff9] = 0x00;
+	memory[0x2000] = memory[0x2100] = 0x20;
+	memory[0x2001] = memory[0x2101] = 0xfe;
+	machine.ram.MemoryChanged();
+}
+
+static void CheckInterrupts()
+{
+	static const char* name = "interrupts";
+	Mc6809::REGISTERS regs;
+
+	// masked lines are held but never taken, stepped and run
+	for (uint8_t run = 0; run < 2; run++)
+	{
+		const uint8_t code[] =
+		{
+			0x10, 0xce, 0x80, 0x00,			// 1000	LDS		#$8000
+			0x1a, 0x50,						// 1004	ORCC	#$50
+			0x4c,							// 1006	INCA
+			0x20, 0xfd,						// 1007	BRA		$1006
+		};
+		MACHINE machine(code, sizeof(code), 0x12);
+		Vectors(machine);
+		machine.cpu.Step();
+		machine.cpu.Step();
+		machine.cpu.Assert(Mc6809::LINE::IRQ | Mc6809::LINE::FIRQ);
+		if (run == 0)
+			for (uint8_t i = 0; i < 10; i++)
+				machine.cpu.Step();
+		else
+			machine.cpu.Run(200);
+		machine.cpu.GetRegisters(regs);
+
+		Expect(regs.s == 0x8000, name, run ? "masked, run S" : "masked, stepped S", 0x8000, regs.s);
+		Expect((regs.pc >= 0x1006) && (regs.pc <= 0x1008), name, run ? "masked, run PC" : "masked, stepped PC", 0x1006, regs.pc);
+		Expect(regs.a != 0, name, run ? "masked, run A" : "masked, stepped A", 1, regs.a);
+	}
+
+	// an unmasked IRQ is taken at the next boundary, stepped and run
+	for (uint8_t run = 0; run < 2; run++)
+	{
+		const uint8_t code[] =
+		{
+			0x10, 0xce, 0x80, 0x00,			// 1000	LDS		#$8000
+			0x1c, 0xaf,						// 1004	ANDCC	#$AF
+			0x4c,							// 1006	INCA
+			0x20, 0xfd,						// 1007	BRA		$1006
+		};
+		MACHINE machine(code, sizeof(code), 0x12);
+		Vectors(machine);
+		machine.cpu.Step();
+		machine.cpu.Step();
+		machine.cpu.Assert(Mc6809::LINE::IRQ);
+		if (run == 0)
+			machine.cpu.Step();
+		else
+			machine.cpu.Run(40);
+		machine.cpu.GetRegisters(regs);
+
+		Expect(regs.pc == 0x2000, name, run ? "IRQ, run PC" : "IRQ, stepped PC", 0x2000, regs.pc);
+		Expect(regs.s == 0x8000 - 12, name, run ? "IRQ, run S" : "IRQ, stepped S", 0x8000 - 12, regs.s);
+		Expect((regs.cc & 0x90) == 0x90, name, run ? "IRQ, run CC E and I" : "IRQ, stepped CC E and I", 0x90, regs.cc & 0x90);
+	}
+
+	// SYNC wakes on a masked line and carries on
+	{
+		const uint8_t code[] =
+		{
+			0x10, 0xce, 0x80, 0x00,			// 1000	LDS		#$8000
+			0x1a, 0x50,						// 1004	ORCC	#$50
+			0x13,							// 1006	SYNC
+			0x4c,							// 1007	INCA
+			0x20, 0xfe,						// 1008	BRA		*
+		};
+		MACHINE machine(code, sizeof(code), 0x12);
+		Vectors(machine);
+		machine.cpu.Step();
+		machine.cpu.Step();
+		machine.cpu.Step();
+		Expect(machine.cpu.Idle(), name, "SYNC parked", 1, 0);
+		machine.cpu.Assert(Mc6809::LINE::IRQ);
+		Expect(!machine.cpu.Idle(), name, "SYNC woken by masked IRQ", 0, 1);
+		for (uint8_t i = 0; i < 3; i++)
+			machine.cpu.Step();
+		machine.cpu.GetRegisters(regs);
+
+		Expect(regs.pc == 0x1008, name, "SYNC masked PC", 0x1008, regs.pc);
+		Expect(regs.a == 1, name, "SYNC masked A", 1, regs.a);
+		Expect(regs.s == 0x8000, name, "SYNC masked S", 0x8000, regs.s);
+	}
+
+	// and takes an unmasked one once it has been held 3 cycles
+	{
+		const uint8_t code[] =
+		{
+			0x10, 0xce, 0x80, 0x00,			// 1000	LDS		#$8000
+			0x1c, 0xef,						// 1004	ANDCC	#$EF
+			0x13,							// 1006	SYNC
+			0x20, 0xfe,						// 1007	BRA		*
+		};
+		MACHINE machine(code, sizeof(code), 0x12);
+		Vectors(machine);
+		machine.cpu.Step();
+		machine.cpu.Step();
+		machine.cpu.Step();
+		machine.cpu.Assert(Mc6809::LINE::IRQ);
+		for (uint8_t i = 0; i < 3; i++)
+			machine.cpu.Step();
+		machine.cpu.GetRegisters(regs);
+
+		Expect(regs.pc == 0x2000, name, "SYNC IRQ PC", 0x2000, regs.pc);
+		Expect(regs.s == 0x8000 - 12, name, "SYNC IRQ S", 0x8000 - 12, regs.s);
+	}
+
+	// CWAI waits on through a masked line and takes an unmasked one
+	{
+		const uint8_t code[] =
+		{
+			0x10, 0xce, 0x80, 0x00,			// 1000	LDS		#$8000
+			0x3c, 0xbf,						// 1004	CWAI	#$BF
+			0x20, 0xfe,						// 1006	BRA		*
+		};
+		MACHINE machine(code, sizeof(code), 0x12);
+		Vectors(machine);
+		machine.cpu.Step();
+		machine.cpu.Step();
+		machine.cpu.Assert(Mc6809::LINE::IRQ);
+		machine.cpu.Step();
+		Expect(machine.cpu.Idle(), name, "CWAI parked through masked IRQ", 1, 0);
+		machine.cpu.Assert(Mc6809::LINE::FIRQ);
+		Expect(!machine.cpu.Idle(), name, "CWAI woken by FIRQ", 0, 1);
+		machine.cpu.Step();
+		machine.cpu.GetRegisters(regs);
+
+		Expect(regs.pc == 0x2100, name, "CWAI FIRQ PC", 0x2100, regs.pc);
+		Expect(regs.s == 0x8000 - 12, name, "CWAI FIRQ S", 0x8000 - 12, regs.s);
+	}
+}
+
+
+//*****************************************************************************
+//	aliases - code patched through a mirror of the page it runs from
+//*****************************************************************************
+//	32K of RAM seen twice, at $0000 and $8000.
+class MirrorRAM : public MMU
+{
+public:
+	uint8_t memory[0x8000];
+
+	MirrorRAM()
+	{
+		MapPages(0x00, 0x80, memory, memory);
+		MapPages(0x80, 0x80, memory, memory);
+	}
+
+	uint8_t Read(uint16_t address, bool /*readOnly*/) override { return(memory[address & 0x7fff]); }
+	void Write(uint16_t address, uint8_t byte) override { memory[address & 0x7fff] = byte; }
+};
+
+static void CheckAliases()
+{
+	static const char* name = "aliases";
+	// the first pass runs a NOP at $100C and then stores INCB over it
+	// through $900C, the second has to run the INCB
+	const uint8_t code[] =
+	{
+		0x8e, 0x90, 0x0c,				// 1000	LDX		#$900C
+		0x5f,							// 1003	CLRB
+		0x86, 0x5c,						// 1004	LDA		#$5C	INCB
+		0x12, 0x12, 0x12, 0x12,			// 1006	NOP x 6
+		0x12, 0x12,
+		0x12,							// 100C	NOP, becomes INCB
+		0xa7, 0x84,						// 100D	STA		,X
+		0x5d,							// 100F	TSTB
+		0x27, 0xf4,						// 1010	BEQ		$1006
+		0x20, 0xfe,						// 1012	BRA		*
+	};
+
+	for (uint8_t run = 0; run < 2; run++)
+	{
+		MirrorRAM ram;
+		CheckCpu cpu(&ram);
+		Mc6809::REGISTERS regs;
+
+		memset(ram.memory, 0x12, sizeof(ram.memory));
+		memcpy(&ram.memory[0x1000], code, sizeof(code));
+		ram.memory[0x7ffe] = 0x10;
+		ram.memory[0x7fff] = 0x00;
+		ram.MemoryChanged();
+		cpu.Step();
+
+		if (run == 0)
+			for (uint8_t i = 0; i < 40; i++)
+				cpu.Step();
+		else
+			cpu.Run(200);
+		cpu.GetRegisters(regs);
+
+		Expect(regs.b == 1, name, run ? "run B" : "stepped B", 1, regs.b);
+		Expect(regs.pc == 0x1012, name, run ? "run PC" : "stepped PC", 0x1012, regs.pc);
+	}
+}
+
+
+//*****************************************************************************
+//	stack - PSHS PSHU PULS PULU over every mask, and JSR/RTS
+//*****************************************************************************
+//	Each mask is pushed and pulled back straight away, with S at $3000 and
+// U at $4000. The push has to take 5 cycles plus one a byte, leave the
+// data sheet's image below the stack pointer (CC lowest, PC highest) and
+// touch no register but the stack pointer. The pull has the same cost and
+// has to put everything back, PC included, which lands on the pull itself.
+static void CheckStack()
+{
+	static const char* name = "stack";
+	char what[64];
+
+	for (uint8_t user = 0; user < 2; user++)
+	{
+		const char* push = user ? "PSHU" : "PSHS";
+
+		for (uint16_t mask = 0; mask < 0x100; mask++)
+		{
+			const uint8_t code[] =
+			{
+				0x10, 0xce, 0x30, 0x00,			// 1000	LDS		#$3000
+				0xce, 0x40, 0x00,				// 1004	LDU		#$4000
+				0x8e, 0x11, 0x22,				// 1007	LDX		#$1122
+				0x10, 0x8e, 0x33, 0x44,			// 100A	LDY		#$3344
+				0xcc, 0x55, 0x66,				// 100E	LDD		#$5566
+				0x1a, 0x0f,						// 1011	ORCC	#$0F
+				(uint8_t)(user ? 0x36 : 0x34), (uint8_t)mask,	// 1013	PSHS/PSHU	#mask
+				(uint8_t)(user ? 0x37 : 0x35), (uint8_t)mask,	// 1015	PULS/PULU	#mask
+			};
+			MACHINE machine(code, sizeof(code), 0x12);
+			Mc6809::REGISTERS before;
+			Mc6809::REGISTERS regs;
+
+			for (uint8_t setup = 0; setup < 6; setup++)
+				machine.cpu.Step();
+			machine.cpu.GetRegisters(before);
+
+			// the image, lowest address first
+			const uint16_t other = user ? before.s : before.u;
+			const uint8_t fields[8][2] =
+			{
+				{ before.cc, 0 }, { before.a, 0 }, { before.b, 0 }, { before.dp, 0 },
+				{ (uint8_t)(before.x >> 8), (uint8_t)before.x }, { (uint8_t)(before.y >> 8), (uint8_t)before.y },
+				{ (uint8_t)(other >> 8), (uint8_t)other }, { 0x10, 0x15 },
+			};
+			uint8_t image[12];
+			uint8_t bytes = 0;
+			for (uint8_t bit = 0; bit < 8; bit++)
+			{
+				if ((mask & (1 << bit)) == 0)
+					continue;
+				image[bytes++] = fields[bit][0];
+				if (bit >= 4)
+					image[bytes++] = fields[bit][1];
+			}
+
+			const uint16_t top = user ? 0x4000 : 0x3000;
+			uint8_t cycles = machine.cpu.Step();
+			machine.cpu.GetRegisters(regs);
+
+			snprintf(what, sizeof(what), "%s #$%02X cycles", push, mask);
+			Expect(cycles == 5 + bytes, name, what, 5 + bytes, cycles);
+			snprintf(what, sizeof(what), "%s #$%02X stack pointer", push, mask);
+			Expect((user ? regs.u : regs.s) == top - bytes, name, what, top - bytes, user ? regs.u : regs.s);
+			for (uint8_t n = 0; n < bytes; n++)
+			{
+				snprintf(what, sizeof(what), "%s #$%02X byte at $%04X", push, mask, top - bytes + n);
+				Expect(machine.Memory()[top - bytes + n] == image[n], name, what, image[n], machine.Memory()[top - bytes + n]);
+			}
+			snprintf(what, sizeof(what), "%s #$%02X byte below", push, mask);
+			Expect(machine.Memory()[top - bytes - 1] == 0x12, name, what, 0x12, machine.Memory()[top - bytes - 1]);
+			snprintf(what, sizeof(what), "%s #$%02X registers", push, mask);
+			Expect((regs.a == before.a) && (regs.b == before.b) && (regs.x == before.x) && (regs.y == before.y) &&
+				(regs.cc == before.cc) && ((user ? regs.s : regs.u) == other) && (regs.pc == 0x1015), name, what, 1, 0);
+
+			// and back
+			cycles = machine.cpu.Step();
+			machine.cpu.GetRegisters(regs);
+
+			snprintf(what, sizeof(what), "%s #$%02X cycles", user ? "PULU" : "PULS", mask);
+			Expect(cycles == 5 + bytes, name, what, 5 + bytes, cycles);
+			snprintf(what, sizeof(what), "%s #$%02X round trip", user ? "PULU" : "PULS", mask);
+			Expect((regs.a == before.a) && (regs.b == before.b) && (regs.dp == before.dp) && (regs.cc == before.cc) &&
+				(regs.x == before.x) && (regs.y == before.y) && (regs.s == before.s) && (regs.u == before.u), name, what, 1, 0);
+			snprintf(what, sizeof(what), "%s #$%02X PC", user ? "PULU" : "PULS", mask);
+			Expect(regs.pc == ((mask & 0x80) ? 0x1015 : 0x1017), name, what, (mask & 0x80) ? 0x1015 : 0x1017, regs.pc);
+		}
+	}
+
+	// JSR stacks the return address high byte lowest, RTS takes it back
+	{
+		const uint8_t code[] =
+		{
+			0x10, 0xce, 0x30, 0x00,			// 1000	LDS		#$3000
+			0xbd, 0x20, 0x00,				// 1004	JSR		$2000
+			0x20, 0xfe,						// 1007	BRA		*
+		};
+		MACHINE machine(code, sizeof(code), 0x12);
+		Mc6809::REGISTERS regs;
+
+		machine.Memory()[0x2000] = 0x39;	// 2000	RTS
+		machine.ram.MemoryChanged();
+		machine.cpu.Step();
+
+		uint8_t cycles = machine.cpu.Step();
+		machine.cpu.GetRegisters(regs);
+		Expect(cycles == 8, name, "JSR cycles", 8, cycles);
+		Expect(regs.s == 0x2ffe, name, "JSR S", 0x2ffe, regs.s);
+		Expect((machine.Memory()[0x2ffe] == 0x10) && (machine.Memory()[0x2fff] == 0x07), name, "JSR return address",
+			0x1007, (machine.Memory()[0x2ffe] << 8) | machine.Memory()[0x2fff]);
+
+		cycles = machine.cpu.Step();
+		machine.cpu.GetRegisters(regs);
+		Expect(cycles == 5, name, "RTS cycles", 5, cycles);
+		Expect(regs.pc == 0x1007, name, "RTS PC", 0x1007, regs.pc);
+		Expect(regs.s == 0x3000, name, "RTS S", 0x3000, regs.s);
+	}
+}
+
+
+//*****************************************************************************
+//	flags - CC after the instructions that read or write it whole
+//*****************************************************************************
+//	Every value is worked out from the data sheet, so the check passes the
+// same with USE_LAZY_CC on or off. Each program leaves flags owed by an ALU
+// op right before the instruction under test: TFR and EXG to and from CC,
+// PSHS CC, ANDCC, MUL, DAA, CLR, and every conditional branch.
+static void CheckFlags()
+{
+	static const char* name = "flags";
+	static const struct
+	{
+		const char* what;
+		uint8_t code[12];
+		uint8_t steps;
+		Mc6809::REGISTERS regs;							// pc x y u s a b dp cc
+		uint16_t address;								// and the byte there, 0 for none
+		uint8_t byte;
+	} programs[] =
+	{
+		// LDA #0  LDB #0  TFR B,CC
+		{ "TFR B,CC", { 0x86, 0x00, 0xc6, 0x00, 0x1f, 0x9a }, 3, { 0x1006, 0, 0, 0, 0, 0x00, 0x00, 0x00, 0x00 }, 0, 0 },
+		// LDA #$04  TFR A,CC
+		{ "TFR A,CC", { 0x86, 0x04, 0x1f, 0x8a }, 2, { 0x1004, 0, 0, 0, 0, 0x04, 0x00, 0x00, 0x04 }, 0, 0 },
+		// LDA #$80  TFR CC,A
+		{ "TFR CC,A", { 0x86, 0x80, 0x1f, 0xa8 }, 2, { 0x1004, 0, 0, 0, 0, 0x58, 0x00, 0x00, 0x58 }, 0, 0 },
+		// LDA #0  TFR CC,DP
+		{ "TFR CC,DP", { 0x86, 0x00, 0x1f, 0xab }, 2, { 0x1004, 0, 0, 0, 0, 0x00, 0x00, 0x54, 0x54 }, 0, 0 },
+		// LDA #$12  TFR A,DP  CLRA  TFR DP,CC
+		{ "TFR DP,CC", { 0x86, 0x12, 0x1f, 0x8b, 0x4f, 0x1f, 0xba }, 4, { 0x1007, 0, 0, 0, 0, 0x00, 0x00, 0x12, 0x12 }, 0, 0 },
+		// LDA #$12  TFR A,DP  CLRA  TFR DP,A
+		{ "TFR DP,A", { 0x86, 0x12, 0x1f, 0x8b, 0x4f, 0x1f, 0xb8 }, 4, { 0x1007, 0, 0, 0, 0, 0x12, 0x00, 0x12, 0x54 }, 0, 0 },
+		// ANDCC #0  LDA #$81  EXG A,CC
+		{ "EXG A,CC", { 0x1c, 0x00, 0x86, 0x81, 0x1e, 0x8a }, 3, { 0x1006, 0, 0, 0, 0, 0x08, 0x00, 0x00, 0x81 }, 0, 0 },
+		// ANDCC #0  LDA #$11  LDB #0  EXG B,CC
+		{ "EXG B,CC", { 0x1c, 0x00, 0x86, 0x11, 0xc6, 0x00, 0x1e, 0x9a }, 4, { 0x1008, 0, 0, 0, 0, 0x11, 0x04, 0x00, 0x00 }, 0, 0 },
+		// ANDCC #0  LDA #$33  TFR A,DP  LDA #$80  EXG CC,DP
+		{ "EXG CC,DP", { 0x1c, 0x00, 0x86, 0x33, 0x1f, 0x8b, 0x86, 0x80, 0x1e, 0xab }, 5, { 0x100a, 0, 0, 0, 0, 0x80, 0x00, 0x08, 0x33 }, 0, 0 },
+		// LDA #1  LDB #2  EXG B,A
+		{ "EXG B,A", { 0x86, 0x01, 0xc6, 0x02, 0x1e, 0x98 }, 3, { 0x1006, 0, 0, 0, 0, 0x02, 0x01, 0x00, 0x50 }, 0, 0 },
+		// LDX #$1234  LDY #$5678  EXG X,Y
+		{ "EXG X,Y", { 0x8e, 0x12, 0x34, 0x10, 0x8e, 0x56, 0x78, 0x1e, 0x12 }, 3, { 0x1009, 0x5678, 0x1234, 0, 0, 0x00, 0x00, 0x00, 0x50 }, 0, 0 },
+		// LDS #$3000  ANDCC #0  LDA #0  PSHS CC
+		{ "PSHS CC", { 0x10, 0xce, 0x30, 0x00, 0x1c, 0x00, 0x86, 0x00, 0x34, 0x01 }, 4, { 0x100a, 0, 0, 0, 0x2fff, 0x00, 0x00, 0x00, 0x04 }, 0x2fff, 0x04 },
+		// LDA #$80  ANDCC #$F7
+		{ "ANDCC", { 0x86, 0x80, 0x1c, 0xf7 }, 2, { 0x1004, 0, 0, 0, 0, 0x80, 0x00, 0x00, 0x50 }, 0, 0 },
+		// LDB #$80  LDA #2  ADDA #1  MUL
+		{ "MUL carry", { 0xc6, 0x80, 0x86, 0x02, 0x8b, 0x01, 0x3d }, 4, { 0x1007, 0, 0, 0, 0, 0x01, 0x80, 0x00, 0x51 }, 0, 0 },
+		// ANDCC #0  LDA #0  LDB #5  MUL
+		{ "MUL zero", { 0x1c, 0x00, 0x86, 0x00, 0xc6, 0x05, 0x3d }, 4, { 0x1007, 0, 0, 0, 0, 0x00, 0x00, 0x00, 0x04 }, 0, 0 },
+		// LDA #$80  CLRA
+		{ "CLRA", { 0x86, 0x80, 0x4f }, 2, { 0x1003, 0, 0, 0, 0, 0x00, 0x00, 0x00, 0x54 }, 0, 0 },
+		// LDA #$80  LBRA *+5
+		{ "LBRA", { 0x86, 0x80, 0x16, 0x00, 0x02 }, 2, { 0x1007, 0, 0, 0, 0, 0x80, 0x00, 0x00, 0x58 }, 0, 0 },
+		// LDA #$99  ADDA #1  DAA
+		{ "DAA", { 0x86, 0x99, 0x8b, 0x01, 0x19 }, 3, { 0x1005, 0, 0, 0, 0, 0x00, 0x00, 0x00, 0x55 }, 0, 0 },
+	};
+
+	// ALU ops ahead of a branch, each with the flags it leaves
+	static const struct
+	{
+		const char* what;
+		uint8_t code[8];
+		uint8_t length;
+		uint8_t steps;
+		uint8_t cc;
+	} alu[] =
+	{
+		{ "$7F+1", { 0x1c, 0x00, 0x86, 0x7f, 0x8b, 0x01 }, 6, 3, 0x2a },					// ANDCC #0  LDA #$7F  ADDA #1		H N V
+		{ "0-1", { 0x1c, 0x00, 0x86, 0x00, 0x80, 0x01 }, 6, 3, 0x09 },					// ANDCC #0  LDA #0  SUBA #1		N C
+		{ "$80-1", { 0x1c, 0x00, 0x86, 0x80, 0x80, 0x01 }, 6, 3, 0x02 },				// ANDCC #0  LDA #$80  SUBA #1		V
+		{ "5 cmp 5", { 0x1c, 0x00, 0x86, 0x05, 0x81, 0x05 }, 6, 3, 0x04 },				// ANDCC #0  LDA #5  CMPA #5		Z
+		{ "$FFFF+1", { 0x1c, 0x00, 0xcc, 0xff, 0xff, 0xc3, 0x00, 0x01 }, 8, 3, 0x05 },	// ANDCC #0  LDD #$FFFF  ADDD #1	Z C
+	};
+	static const char* branches[16] =
+	{
+		"BRA", "BRN", "BHI", "BLS", "BCC", "BCS", "BNE", "BEQ",
+		"BVC", "BVS", "BPL", "BMI", "BGE", "BLT", "BGT", "BLE",
+	};
+	char what[64];
+
+	for (const auto& program : programs)
+	{
+		MACHINE machine(program.code, sizeof(program.code));
+		Mc6809::REGISTERS regs;
+
+		for (uint8_t step = 0; step < program.steps; step++)
+			machine.cpu.Step();
+		machine.cpu.GetRegisters(regs);
+
+		snprintf(what, sizeof(what), "%s CC", program.what);
+		Expect(regs.cc == program.regs.cc, name, what, program.regs.cc, regs.cc);
+		snprintf(what, sizeof(what), "%s A", program.what);
+		Expect(regs.a == program.regs.a, name, what, program.regs.a, regs.a);
+		snprintf(what, sizeof(what), "%s B", program.what);
+		Expect(regs.b == program.regs.b, name, what, program.regs.b, regs.b);
+		snprintf(what, sizeof(what), "%s DP", program.what);
+		Expect(regs.dp == program.regs.dp, name, what, program.regs.dp, regs.dp);
+		snprintf(what, sizeof(what), "%s X", program.what);
+		Expect(regs.x == program.regs.x, name, what, program.regs.x, regs.x);
+		snprintf(what, sizeof(what), "%s Y", program.what);
+		Expect(regs.y == program.regs.y, name, what, program.regs.y, regs.y);
+		snprintf(what, sizeof(what), "%s S", program.what);
+		Expect(regs.s == program.regs.s, name, what, program.regs.s, regs.s);
+		snprintf(what, sizeof(what), "%s PC", program.what);
+		Expect(regs.pc == program.regs.pc, name, what, program.regs.pc, regs.pc);
+		if (program.address != 0)
+		{
+			snprintf(what, sizeof(what), "%s byte at $%04X", program.what, program.address);
+			Expect(machine.Memory()[program.address] == program.byte, name, what, program.byte, machine.Memory()[program.address]);
+		}
+	}
+
+	// the branch, short or long, has to be taken on exactly the data sheet's
+	// condition
+	for (const auto& op : alu)
+	{
+		const bool c = (op.cc & 0x01) != 0;
+		const bool v = (op.cc & 0x02) != 0;
+		const bool z = (op.cc & 0x04) != 0;
+		const bool n = (op.cc & 0x08) != 0;
+		const bool taken[16] =
+		{
+			true, false, !(c || z), c || z, !c, c, !z, z,
+			!v, v, !n, n, n == v, n != v, !z && (n == v), z || (n != v),
+		};
+
+		for (uint8_t condition = 0; condition < 32; condition++)
+		{
+			const bool isLong = (condition >= 16);
+			const uint8_t length = isLong ? 4 : 2;
+			uint8_t code[12];
+
+			if (condition == 16)
+				continue;								// LBRA has its own opcode
+			memcpy(code, op.code, op.length);
+			if (isLong)
+			{
+				code[op.length] = 0x10;					// LBcc	*+6
+				code[op.length + 1] = 0x20 + (condition & 0x0f);
+				code[op.length + 2] = 0x00;
+				code[op.length + 3] = 0x02;
+			}
+			else
+			{
+				code[op.length] = 0x20 + condition;		// Bcc	*+4
+				code[op.length + 1] = 0x02;
+			}
+			MACHINE machine(code, op.length + length);
+			Mc6809::REGISTERS regs;
+
+			for (uint8_t step = 0; step <= op.steps; step++)
+				machine.cpu.Step();
+			machine.cpu.GetRegisters(regs);
+
+			const uint16_t pc = 0x1000 + op.length + length + (taken[condition & 0x0f] ? 2 : 0);
+			snprintf(what, sizeof(what), "%s%s after %s PC", isLong ? "L" : "", branches[condition & 0x0f], op.what);
+			Expect(regs.pc == pc, name, what, pc, regs.pc);
+			snprintf(what, sizeof(what), "%s%s after %s CC", isLong ? "L" : "", branches[condition & 0x0f], op.what);
+			Expect(regs.cc == op.cc, name, what, op.cc, regs.cc);
+		}
+	}
+}
+
+
+//*****************************************************************************
+//	dispatch - every opcode through Interpret() and the threaded dispatches
+//*****************************************************************************
+//	Each opcode runs once per path from the same machine: registers loaded,
+// memory a pattern, the opcode at $1013 followed by $20 $40 $10 $30 (a
+// legal indexed post byte, an extended address, a branch offset). Cycles,
+// registers, Idle() and all of memory have to come out the same.
+static const struct
+{
+	const char* name;
+	uint8_t (CheckCpu::*run)(uint8_t page, uint8_t opcode);
+} paths[] =
+{
+	{ "Interpret", &CheckCpu::Interpret },
+	{ "DispatchSwitch", &CheckCpu::DispatchSwitch },
+#if defined(__GNUC__)
+	{ "DispatchTable", &CheckCpu::DispatchTable },
+#endif
+};
+
+struct OUTCOME
+{
+	uint8_t cycles;
+	bool idle;
+	Mc6809::REGISTERS regs;
+	uint8_t memory[0x10000];
+};
+
+static void RunPath(uint8_t path, uint8_t page, uint8_t opcode, OUTCOME& outcome)
+{
+	uint8_t code[] =
+	{
+		0x10, 0xce, 0x30, 0x00,			// 1000	LDS		#$3000
+		0xce, 0x31, 0x00,				// 1004	LDU		#$3100
+		0x8e, 0x20, 0x00,				// 1007	LDX		#$2000
+		0x10, 0x8e, 0x21, 0x00,			// 100A	LDY		#$2100
+		0xcc, 0x12, 0x34,				// 100E	LDD		#$1234
+		0x1a, 0x05,						// 1011	ORCC	#$05
+		0x00, 0x00, 0x20, 0x40, 0x10, 0x30	// 1013	[prefix] opcode operands
+	};
+	uint8_t at = 0x13;
+
+	if (page != 0)
+		code[at++] = (page == 1) ? 0x10 : 0x11;
+	code[at++] = opcode;
+	memcpy(&code[at], "\x20\x40\x10\x30", 4);
+
+	MACHINE machine(code, 0x13 + 6, 0x00);
+	uint8_t* memory = machine.Memory();
+	for (uint32_t address = 0; address < 0xfff0; address++)
+	{
+		if ((address < 0x1000) || (address >= 0x1100))
+			memory[address] = (uint8_t)(address * 7 + (address >> 8));
+	}
+	machine.ram.MemoryChanged();
+
+	for (uint8_t setup = 0; setup < 6; setup++)
+		machine.cpu.Step();
+
+	outcome.cycles = (machine.cpu.*paths[path].run)(page, opcode);
+	outcome.idle = machine.cpu.Idle();
+	machine.cpu.GetRegisters(outcome.regs);
+	memcpy(outcome.memory, memory, 0x10000);
+}
+
+static void CheckDispatch()
+{
+	static const char* name = "dispatch";
+	static OUTCOME expected;
+	static OUTCOME actual;
+	char what[96];
+
+	for (uint8_t page = 0; page < 3; page++)
+	{
+		for (uint16_t opcode = 0; opcode < 0x100; opcode++)
+		{
+			RunPath(0, page, (uint8_t)opcode, expected);
+			for (uint8_t path = 1; path < sizeof(paths) / sizeof(paths[0]); path++)
+			{
+				RunPath(path, page, (uint8_t)opcode, actual);
+
+#define SAME(field)																	\
+				snprintf(what, sizeof(what), "%s page %u $%02X " #field, paths[path].name, page, opcode);	\
+				Expect(actual.field == expected.field, name, what, expected.field, actual.field);
+				SAME(cycles)
+				SAME(idle)
+				SAME(regs.pc)
+				SAME(regs.x)
+				SAME(regs.y)
+				SAME(regs.u)
+				SAME(regs.s)
+				SAME(regs.a)
+				SAME(regs.b)
+				SAME(regs.dp)
+				SAME(regs.cc)
+#undef SAME
+
+				for (uint32_t address = 0; address < 0x10000; address++)
+				{
+					if (actual.memory[address] != expected.memory[address])
+					{
+						snprintf(what, sizeof(what), "%s page %u $%02X memory at $%04X", paths[path].name, page, opcode, address);
+						Expect(false, name, what, expected.memory[address], actual.memory[address]);
+						break;
+					}
+				}
+			}
+		}
+	}
+}
+
+
+//*****************************************************************************
+//	Clocked devices for the Clock checks
+//*****************************************************************************
+//	Counter is run in bulk by Clock and counts the cycles it is given.
+// Ticker and Stopper only have events. Ticker logs each one with where
+// the driving Counter had got to, Stopper calls Stop() every so often.
+struct Counter : public ClockedDevice
+{
+	uint64_t cycles = 0;
+
+	void AdvanceTo(uint64_t tick) override
+	{
+		uint64_t owed = CyclesTo(tick);
+
+		cycles += owed;
+		Ran(owed);
+	}
+};
+
+struct Ticker : public ClockedDevice
+{
+	uint8_t id;
+	uint64_t interval;
+
+	Ticker(uint8_t tickerId, uint64_t ticks) : id(tickerId), interval(ticks) {}
+	void AdvanceTo(uint64_t tick) override { if (tick > reached) SkipTo(tick); }
+};
+
+struct TICKED
+{
+	uint8_t id;
+	uint64_t tick;
+	uint64_t driver;
+};
+static TICKED ticked[32];
+static uint8_t tickedCount = 0;
+static const Counter* tickedDriver = nullptr;
+
+static uint64_t TickerEvent(ClockedDevice* device, uint64_t tick)
+{
+	Ticker* ticker = static_cast<Ticker*>(device);
+
+	ticker->AdvanceTo(tick);
+	if (tickedCount < sizeof(ticked) / sizeof(ticked[0]))
+		ticked[tickedCount++] = { ticker->id, tick, (tickedDriver != nullptr) ? tickedDriver->Reached() : 0 };
+	return(tick + ticker->interval);
+}
+
+struct Stopper : public ClockedDevice
+{
+	Clock* clock;
+	uint64_t every;
+
+	Stopper(Clock* owner, uint64_t ticks) : clock(owner), every(ticks) {}
+	void AdvanceTo(uint64_t tick) override { if (tick > reached) SkipTo(tick); }
+};
+
+static uint64_t StopperEvent(ClockedDevice* device, uint64_t tick)
+{
+	Stopper* stopper = static_cast<Stopper*>(device);
+
+	if (tick >= stopper->every)
+		stopper->clock->Stop();
+	return(tick + stopper->every);
+}
+
+struct CheckVdp : public VDP
+{
+};
+
+
+//*****************************************************************************
+//	events - the event queue's order, and the driving device kept ahead
+//*****************************************************************************
+//	Six tickers, the first every 300 ticks and the rest every 200, added in
+// that order. Events go in tick order, and ones on the same tick in the
+// order they were queued. The Counter has to be up to each event before it
+// is handled.
+static void CheckEvents()
+{
+	static const char* name = "events";
+	TICKED expected[32];
+	uint8_t count = 0;
+	char what[64];
+
+	for (uint8_t id = 0; id < 6; id++)				// Add() asks for the first
+		expected[count++] = { id, 0, 0 };
+	for (uint64_t tick = 200; tick <= 600; tick += 200)
+	{
+		if (tick == 600)							// queued at 300, before the rest
+			expected[count++] = { 0, 600, 0 };
+		for (uint8_t id = 1; id < 6; id++)
+			expected[count++] = { id, tick, 0 };
+		if (tick == 200)
+			expected[count++] = { 0, 300, 0 };
+	}
+
+	Clock clock(SYS_CLOCK::clk_890K);
+	Counter counter;
+	Ticker tickers[6] = { { 0, 300 }, { 1, 200 }, { 2, 200 }, { 3, 200 }, { 4, 200 }, { 5, 200 } };
+
+	tickedCount = 0;
+	tickedDriver = &counter;
+	clock.Add(&counter);
+	for (Ticker& ticker : tickers)
+		clock.Add(&ticker, 1, TickerEvent);
+	clock.RunFor(600);
+	tickedDriver = nullptr;
+
+	Expect(tickedCount == count, name, "events handled", count, tickedCount);
+	for (uint8_t n = 0; (n < count) && (n < tickedCount); n++)
+	{
+		snprintf(what, sizeof(what), "event %u device", n);
+		Expect(ticked[n].id == expected[n].id, name, what, expected[n].id, ticked[n].id);
+		snprintf(what, sizeof(what), "event %u tick", n);
+		Expect(ticked[n].tick == expected[n].tick, name, what, (uint32_t)expected[n].tick, (uint32_t)ticked[n].tick);
+		snprintf(what, sizeof(what), "event %u driver behind", n);
+		Expect(ticked[n].driver >= ticked[n].tick, name, what, (uint32_t)ticked[n].tick, (uint32_t)ticked[n].driver);
+	}
+	Expect(clock.Now() == 600, name, "Now()", 600, (uint32_t)clock.Now());
+	Expect(tickers[0].Reached() == 600, name, "ticker brought up to its event", 600, (uint32_t)tickers[0].Reached());
+
+	// a VDP gets a line event every scanline, and one caught up to a tick it
+	// has passed stays where it is
+	Clock lines(SYS_CLOCK::clk_890K);
+	Counter cpu;
+	CheckVdp vdp;
+
+	lines.Add(&cpu);
+	lines.Add(&vdp, 1, Clock::VdpLine);
+	lines.RunFor(2000);
+	Expect(vdp.Reached() == 2 * Clock::LINE_TICKS, name, "VDP at its last line", 2 * Clock::LINE_TICKS, (uint32_t)vdp.Reached());
+	vdp.AdvanceTo(100);
+	Expect(vdp.Reached() == 2 * Clock::LINE_TICKS, name, "VDP moved back", 2 * Clock::LINE_TICKS, (uint32_t)vdp.Reached());
+}
+
+
+//*****************************************************************************
+//	timebase - every clock's rate exact, and no drift over uneven batches
+//*****************************************************************************
+//	Each speed's RATIO has to give its frequency exactly, in lowest terms.
+// A Counter run through a few thousand RunFor()s of uneven length then has
+// to have been given the cycles of the whole run rounded up, no more and no
+// fewer, and finish less than one of its cycles past the end.
+static uint32_t Gcd(uint32_t a, uint32_t b)
+{
+	while (b != 0)
+	{
+		uint32_t r = a % b;
+		a = b;
+		b = r;
+	}
+	return(a);
+}
+
+static void CheckTimebase()
+{
+	static const char* name = "timebase";
+	static const struct
+	{
+		SYS_CLOCK clock;
+		uint64_t hz;									// hz / per cycles a second
+		uint64_t per;
+	} speeds[] =
+	{
+		{ SYS_CLOCK::clk_10K, 10000, 1 },
+		{ SYS_CLOCK::clk_890K, Clock::MASTER_HZ_NUM, Clock::MASTER_HZ_DEN * 16 },
+		{ SYS_CLOCK::clk_1M, 1000000, 1 },
+		{ SYS_CLOCK::clk_1M5, 1500000, 1 },
+		{ SYS_CLOCK::clk_1M78, Clock::MASTER_HZ_NUM, Clock::MASTER_HZ_DEN * 8 },
+		{ SYS_CLOCK::clk_2M, 2000000, 1 },
+		{ SYS_CLOCK::clk_3M, 3000000, 1 },
+		{ SYS_CLOCK::clk_4M, 4000000, 1 },
+		{ SYS_CLOCK::clk_4M77, Clock::MASTER_HZ_NUM, Clock::MASTER_HZ_DEN * 3 },
+		{ SYS_CLOCK::clk_6M, 6000000, 1 },
+		{ SYS_CLOCK::clk_8M, 8000000, 1 },
+		{ SYS_CLOCK::clk_10M, 10000000, 1 },
+		{ SYS_CLOCK::clk_16M, 16000000, 1 },
+	};
+	char what[64];
+
+	for (const auto& speed : speeds)
+	{
+		for (uint32_t divider = 1; divider <= 3; divider += 2)
+		{
+			Clock clock(speed.clock);
+			Counter counter;
+
+			clock.Add(&counter, divider);
+			const Clock::RATIO rate = counter.Rate();
+
+			// cycles / ticks == (hz / (per * divider)) / (NUM / DEN)
+			snprintf(what, sizeof(what), "%s / %u rate", Clock::ClockName(speed.clock), divider);
+			Expect(uint64_t(rate.cycles) * speed.per * divider * Clock::MASTER_HZ_NUM ==
+				uint64_t(rate.ticks) * speed.hz * Clock::MASTER_HZ_DEN, name, what, rate.ticks, rate.cycles);
+			snprintf(what, sizeof(what), "%s / %u rate in lowest terms", Clock::ClockName(speed.clock), divider);
+			Expect(Gcd(rate.ticks, rate.cycles) == 1, name, what, 1, Gcd(rate.ticks, rate.cycles));
+
+			uint64_t total = 0;
+			uint32_t seed = 12345;
+			for (uint16_t batch = 0; batch < 2000; batch++)
+			{
+				seed = seed * 1103515245 + 12345;
+				uint64_t ticks = 1 + ((seed >> 16) % 2000);
+
+				total += ticks;
+				Expect(clock.RunFor(ticks) == total, name, "RunFor() return", (uint32_t)total, (uint32_t)clock.Now());
+			}
+
+			const uint64_t cycles = (total * rate.cycles + rate.ticks - 1) / rate.ticks;
+			snprintf(what, sizeof(what), "%s / %u cycles", Clock::ClockName(speed.clock), divider);
+			Expect(counter.cycles == cycles, name, what, (uint32_t)cycles, (uint32_t)counter.cycles);
+			snprintf(what, sizeof(what), "%s / %u past the end", Clock::ClockName(speed.clock), divider);
+			Expect((counter.Reached() >= total) && ((counter.Reached() - total) * rate.cycles < rate.ticks), name, what,
+				(uint32_t)total, (uint32_t)counter.Reached());
+		}
+	}
+}
+
+
+//*****************************************************************************
+//	slices - Run() a slice at a time, Stop(), StopRun() and turbo
+//*****************************************************************************
+//	A Stop() made before Run() ends it after one slice, so Now() is one
+// slice of each kind. A Stop() from an event ends it at the end of that
+// slice, and every Run() here has one ten slices in, so a lost Stop()
+// shows as the wrong Now() rather than a hang. Out of turbo Run() never
+// gets ahead of the host clock, in turbo it does not wait at all. The
+// CPU's StopRun() latches the same way.
+static void CheckSlices()
+{
+	static const char* name = "slices";
+	static const struct
+	{
+		SYS_SLICE slice;
+		uint32_t microseconds;
+		uint64_t ticks;
+	} slices[] =
+	{
+		{ SYS_SLICE::slice_line, 0, Clock::LINE_TICKS },
+		{ SYS_SLICE::slice_frame, 0, 262 * Clock::LINE_TICKS },
+		{ SYS_SLICE::slice_us, 1000, 14318 },			// 14318.18
+		{ SYS_SLICE::slice_us, 1, 14 },
+	};
+	char what[64];
+
+	for (const auto& slice : slices)
+	{
+		Clock clock(SYS_CLOCK::clk_890K);
+		Counter counter;
+		Stopper stopper(&clock, 10 * slice.ticks);
+
+		clock.Add(&counter);
+		clock.Add(&stopper, 1, StopperEvent);
+		clock.SetSlice(slice.slice, slice.microseconds);
+		clock.Stop();
+		bool more = clock.Run();
+
+		snprintf(what, sizeof(what), "slice %u/%u Run() after Stop()", slice.slice, slice.microseconds);
+		Expect(!more, name, what, 0, more);
+		snprintf(what, sizeof(what), "slice %u/%u ticks", slice.slice, slice.microseconds);
+		Expect(clock.Now() == slice.ticks, name, what, (uint32_t)slice.ticks, (uint32_t)clock.Now());
+	}
+
+	// a Stop() before Run() is used up by it, the next comes from an event
+	{
+		Clock clock(SYS_CLOCK::clk_890K);
+		Counter counter;
+		Stopper stopper(&clock, 5000);
+
+		clock.Add(&counter);
+		clock.Add(&stopper, 1, StopperEvent);
+		clock.Stop();
+		clock.Run();
+		Expect(clock.Now() == Clock::LINE_TICKS, name, "Stop() before Run()", Clock::LINE_TICKS, (uint32_t)clock.Now());
+		clock.Run();
+		Expect(clock.Now() == 6 * Clock::LINE_TICKS, name, "Stop() from an event", 6 * Clock::LINE_TICKS, (uint32_t)clock.Now());
+	}
+
+	// six frames take at least their own time, six hundred in turbo far less
+	for (uint8_t fast = 0; fast < 2; fast++)
+	{
+		const uint64_t frames = fast ? 600 : 6;
+		const uint64_t ticks = frames * 262 * Clock::LINE_TICKS;
+		Clock clock(SYS_CLOCK::clk_890K);
+		Counter counter;
+		Stopper stopper(&clock, ticks);
+
+		clock.Add(&counter);
+		clock.Add(&stopper, 1, StopperEvent);
+		clock.SetSlice(SYS_SLICE::slice_frame);
+		clock.SetTurbo(fast != 0);
+
+		std::chrono::steady_clock::time_point start(std::chrono::steady_clock::now());
+		clock.Run();
+		uint64_t host = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+		uint64_t emulated = Clock::TicksToNanoseconds(ticks);
+
+		Expect(clock.Now() == ticks, name, fast ? "turbo ticks" : "ticks", (uint32_t)ticks, (uint32_t)clock.Now());
+		if (fast)
+			Expect(host < emulated / 10, name, "turbo waited, ms", uint32_t(emulated / 10000000), uint32_t(host / 1000000));
+		else
+			Expect(host >= emulated, name, "ran ahead of the host, ms", uint32_t(emulated / 1000000), uint32_t(host / 1000000));
+	}
+
+	// a StopRun() before Run() stops it before the first instruction
+	{
+		const uint8_t code[] = { 0x4c, 0x20, 0xfd };	// 1000	INCA, BRA $1000
+		MACHINE machine(code, sizeof(code));
+
+		machine.cpu.StopRun();
+		uint32_t cycles = machine.cpu.Run(100);
+		Expect(cycles == 0, name, "Run() after StopRun()", 0, cycles);
+		cycles = machine.cpu.Run(100);
+		Expect(cycles >= 100, name, "Run() after that", 100, cycles);
+	}
+}
+
+
+//*****************************************************************************
+//	runfor - RunFor() is deterministic, and catches devices up on access
+//*****************************************************************************
+//	A counting loop with an IRQ raised for 100 ticks at the start of every
+// scanline by an event, and a handler counting IRQs. The same RunFor()s
+// twice have to leave the same registers, memory and device ticks.
+//
+//	The device at $FF00 is caught up to the CPU's Now() before the CPU
+// reads it: the LDA there starts 4 cycles, 64 ticks, in.
+class IoRAM : public MMU
+{
+public:
+	uint8_t memory[0x10000];
+
+	IoRAM()
+	{
+		memset(memory, 0x00, sizeof(memory));
+		MapPages(0x00, 0xff, memory, memory);
+	}
+
+	uint8_t Read(uint16_t address, bool /*readOnly*/) override { return((address == 0xff00) ? 0xa5 : memory[address]); }
+	void Write(uint16_t address, uint8_t byte) override { memory[address] = byte; }
+};
+
+struct IrqLine : public ClockedDevice
+{
+	Mc6809* cpu;
+	bool raised = false;
+
+	IrqLine(Mc6809* target) : cpu(target) {}
+	void AdvanceTo(uint64_t tick) override { if (tick > reached) SkipTo(tick); }
+};
+
+static uint64_t IrqLineEvent(ClockedDevice* device, uint64_t tick)
+{
+	IrqLine* line = static_cast<IrqLine*>(device);
+
+	if (tick == 0)
+		return(Clock::LINE_TICKS);
+	line->raised = !line->raised;
+	if (line->raised)
+		line->cpu->Assert(Mc6809::LINE::IRQ);
+	else
+		line->cpu->Deassert(Mc6809::LINE::IRQ);
+	return(tick + (line->raised ? 100 : Clock::LINE_TICKS - 100));
+}
+
+struct RUNFOR
+{
+	Mc6809::REGISTERS regs;
+	uint64_t now;
+	uint64_t cpu;
+	uint64_t line;
+	uint8_t memory[0x10000];
+};
+
+static void RunForJob(RUNFOR& outcome)
+{
+	const uint8_t code[] =
+	{
+		0x10, 0xce, 0x30, 0x00,			// 1000	LDS		#$3000
+		0x1c, 0xef,						// 1004	ANDCC	#$EF
+		0x7c, 0x20, 0x00,				// 1006	INC		$2000
+		0x20, 0xfb,						// 1009	BRA		$1006
+	};
+	const uint8_t handler[] =
+	{
+		0x7c, 0x20, 0x01,				// 1100	INC		$2001
+		0x3b,							// 1103	RTI
+	};
+	MACHINE machine(code, sizeof(code));
+	memcpy(&machine.Memory()[0x1100], handler, sizeof(handler));
+	machine.Memory()[0xfff8] = 0x11;
+	machine.Memory()[0xfff9] = 0x00;
+	machine.ram.MemoryChanged();
+
+	Clock clock(SYS_CLOCK::clk_890K);
+	IrqLine line(&machine.cpu);
+	clock.Add(&machine.cpu);
+	clock.Add(&line, 1, IrqLineEvent);
+
+	uint32_t seed = 999;
+	for (uint16_t batch = 0; batch < 500; batch++)
+	{
+		seed = seed * 1103515245 + 12345;
+		clock.RunFor(1 + ((seed >> 16) % 5000));
+	}
+
+	machine.cpu.GetRegisters(outcome.regs);
+	outcome.now = clock.Now();
+	outcome.cpu = machine.cpu.Reached();
+	outcome.line = line.Reached();
+	memcpy(outcome.memory, machine.Memory(), sizeof(outcome.memory));
+}
+
+static void CheckRunFor()
+{
+	static const char* name = "runfor";
+	static RUNFOR first;
+	static RUNFOR second;
+
+	RunForJob(first);
+	RunForJob(second);
+
+	Expect(first.memory[0x2001] > 100, name, "IRQs taken", 100, first.memory[0x2001]);
+	Expect(memcmp(&first.regs, &second.regs, sizeof(first.regs)) == 0, name, "registers", first.regs.pc, second.regs.pc);
+	Expect(first.now == second.now, name, "Now()", (uint32_t)first.now, (uint32_t)second.now);
+	Expect(first.cpu == second.cpu, name, "CPU tick", (uint32_t)first.cpu, (uint32_t)second.cpu);
+	Expect(first.line == second.line, name, "IRQ line tick", (uint32_t)first.line, (uint32_t)second.line);
+	for (uint32_t address = 0; address < 0x10000; address++)
+	{
+		if (first.memory[address] != second.memory[address])
+		{
+			char what[64];
+			snprintf(what, sizeof(what), "memory at $%04X", address);
+			Expect(false, name, what, first.memory[address], second.memory[address]);
+			break;
+		}
+	}
+
+	// caught up on access
+	{
+		const uint8_t code[] =
+		{
+			0x12,						// 1000	NOP
+			0x12,						// 1001	NOP
+			0xb6, 0xff, 0x00,			// 1002	LDA		$FF00
+			0x20, 0xfe,					// 1005	BRA		*
+		};
+		IoRAM ram;
+		CheckCpu cpu(&ram);
+		Ticker device(0, 0);
+		Clock clock(SYS_CLOCK::clk_890K);
+		Mc6809::REGISTERS regs;
+
+		memcpy(&ram.memory[0x1000], code, sizeof(code));
+		ram.memory[0xfffe] = 0x10;
+		ram.memory[0xffff] = 0x00;
+		ram.MemoryChanged();
+		ram.Attach(&device, 0xff00, 0xff00);
+		cpu.Step();
+
+		clock.Add(&cpu);
+		clock.RunFor(1000);
+		cpu.GetRegisters(regs);
+		Expect(regs.a == 0xa5, name, "read through the MMU", 0xa5, regs.a);
+		Expect(device.Reached() == 64, name, "device caught up to", 64, (uint32_t)device.Reached());
+	}
+}
+
+
+//*****************************************************************************
+//	The checks, in the order they run
+//*****************************************************************************
+static const struct
+{
+	const char* name;
+	void (*run)();
+} checks[] =
+{
+	{ "indexed", CheckIndexed },
+	{ "interrupts", CheckInterrupts },
+	{ "aliases", CheckAliases },
+	{ "stack", CheckStack },
+	{ "flags", CheckFlags },
+	{ "dispatch", CheckDispatch },
+	{ "events", CheckEvents },
+	{ "timebase", CheckTimebase },
+	{ "slices", CheckSlices },
+	{ "runfor", CheckRunFor },
+};
+
+
+int main(int argc, char* argv[])
+{
+	bool ran = false;
+
+	for (const auto& check : checks)
+	{
+		bool wanted = (argc < 2);
+		for (int arg = 1; arg < argc; arg++)
+			wanted = wanted || (strcmp(argv[arg], check.name) == 0);
+		if (!wanted)
+			continue;
+
+		uint32_t before = failures;
+		check.run();
+		printf("%-12s %s\n", check.name, (failures == before) ? "ok" : "FAILED");
+		ran = true;
+	}
+
+	if (!ran)
+	{
+		fprintf(stderr, "usage: CoreCheck [check ...]\n");
+		return(1);
+	}
+	return((failures == 0) ? 0 : 1);
+}
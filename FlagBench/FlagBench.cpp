@@ -0,0 +1,137 @@
+/******************************************************************************
+*		   File: FlagBench.cpp
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/14
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+//	Microbenchmark: 8 bit ALU condition codes from Mc6809::AluFlags against
+// the per flag read-modify-write helpers the core used before.
+//
+//	Checks both give the same flags for every reg, data and carry first, then
+// times each over the same pseudo-random operands.
+//
+//		FlagBench [iterations]
+//*****************************************************************************
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "Mc6809.h"
+
+enum CC : uint8_t { C = 0x01, V = 0x02, Z = 0x04, N = 0x08, H = 0x20 };
+
+
+//*****************************************************************************
+//	Per flag helpers, one read-modify-write of cc each (the old AdjustCC_x)
+//*****************************************************************************
+static void AdjustCC_H(uint8_t& cc, uint8_t reg, uint8_t data, uint16_t result)
+{
+	cc = (((reg ^ data ^ result) & 0x10) != 0) ? (cc | CC::H) : (cc & ~CC::H);
+}
+
+static void AdjustCC_N(uint8_t& cc, uint16_t result)
+{
+	cc = ((result & 0x80) != 0) ? (cc | CC::N) : (cc & ~CC::N);
+}
+
+static void AdjustCC_Z(uint8_t& cc, uint16_t result)
+{
+	cc = ((result & 0xff) == 0) ? (cc | CC::Z) : (cc & ~CC::Z);
+}
+
+static void AdjustCC_V(uint8_t& cc, uint8_t reg, uint8_t data, uint16_t result)
+{
+	cc = (((reg ^ result) & (data ^ result) & 0x80) != 0) ? (cc | CC::V) : (cc & ~CC::V);
+}
+
+static void AdjustCC_C(uint8_t& cc, uint16_t result)
+{
+	cc = ((result & 0x100) != 0) ? (cc | CC::C) : (cc & ~CC::C);
+}
+
+static uint8_t HelperAdd8(uint8_t reg, uint8_t data, uint8_t carry)
+{
+	uint16_t result = reg + data + carry;
+	uint8_t cc = 0;
+
+	AdjustCC_H(cc, reg, data, result);
+	AdjustCC_N(cc, result);
+	AdjustCC_Z(cc, result);
+	AdjustCC_V(cc, reg, data, result);
+	AdjustCC_C(cc, result);
+	return(cc);
+}
+
+static uint8_t HelperSub8(uint8_t reg, uint8_t data, uint8_t borrow)
+{
+	uint16_t result = reg - data - borrow;
+	uint8_t cc = 0;
+
+	AdjustCC_N(cc, result);
+	AdjustCC_Z(cc, result);
+	cc = (((reg ^ data) & (reg ^ result) & 0x80) != 0) ? (cc | CC::V) : (cc & ~CC::V);
+	AdjustCC_C(cc, result);
+	return(cc);
+}
+
+
+//*****************************************************************************
+//	Time one flag function over the operand list
+//*****************************************************************************
+template <typename F>
+static double Time(F flags, const std::vector<uint32_t>& operands, uint32_t iterations, uint32_t& sink)
+{
+	auto start = std::chrono::steady_clock::now();
+	for (uint32_t pass = 0; pass < iterations; ++pass)
+	{
+		for (uint32_t op : operands)
+			sink += flags((uint8_t)op, (uint8_t)(op >> 8), (uint8_t)((op >> 16) & 0x01));
+	}
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+	return(elapsed.count() / ((double)iterations * operands.size()));
+}
+
+
+int main(int argc, char* argv[])
+{
+	uint32_t iterations = (argc > 1) ? (uint32_t)strtoul(argv[1], nullptr, 0) : 200;
+	uint32_t mismatches = 0;
+	uint32_t sink = 0;
+
+	// H is only defined for adds, the subtract helpers leave it clear
+	for (uint32_t i = 0; i < 0x20000; ++i)
+	{
+		uint8_t reg = i & 0xff, data = (i >> 8) & 0xff, carry = (i >> 16) & 0x01;
+
+		if (Mc6809::FlagsAdd8(reg, data, carry) != HelperAdd8(reg, data, carry))
+			++mismatches;
+		if ((Mc6809::FlagsSub8(reg, data, carry) & ~CC::H) != HelperSub8(reg, data, carry))
+			++mismatches;
+	}
+	printf("table check: %u mismatches\n", mismatches);
+
+	// same operands for every run, xorshift so the compiler cannot fold them
+	std::vector<uint32_t> operands(1 << 16);
+	uint32_t seed = 0x6809;
+	for (uint32_t& op : operands)
+	{
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+		op = seed;
+	}
+
+	printf("add8 helpers: %6.2f ns/op\n", Time(HelperAdd8, operands, iterations, sink));
+	printf("add8 table:   %6.2f ns/op\n", Time(Mc6809::FlagsAdd8, operands, iterations, sink));
+	printf("sub8 helpers: %6.2f ns/op\n", Time(HelperSub8, operands, iterations, sink));
+	printf("sub8 table:   %6.2f ns/op\n", Time(Mc6809::FlagsSub8, operands, iterations, sink));
+	printf("(%08x)\n", sink);
+
+	return((mismatches == 0) ? 0 : 1);
+}
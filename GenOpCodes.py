@@ -0,0 +1,333 @@
+#!/usr/bin/env python3
+###############################################################################
+#		   File: GenOpCodes.py
+# * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+#		 Author: William Barnes
+#		Created: 2020/06/14
+#	  Copyright: 2020 - under Apache 2.0 Licensing
+# * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+# Modifications: (Who, whenm, what)
+#
+###############################################################################
+#	Builds ColoRat09/Mc6809OpCodes.cpp, the compile-time opcode dispatch
+# tables for the Mc6809, from the opcode sheets Opcodes_p1.csv (no prefix),
+# Opcodes_p2.csv ($10 prefix) and Opcodes_p3.csv ($11 prefix), and the
+# indexed addressing post byte table. Also builds ColoRat09/Mc6809Dispatch.h,
+# the same opcode map as a DISPATCH() list for the threaded Step().
+#
+#	Each CSV row is one opcode, in opcode order:
+#		"mnemonic", base name, cycles, program bytes, address mode
+#
+#	The generated file is checked in so the Visual Studio build does not
+# need Python. Re-run this script after changing any of the CSV sheets:
+#
+#		python GenOpCodes.py
+###############################################################################
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.abspath(__file__))
+SHEETS = ["Opcodes_p1.csv", "Opcodes_p2.csv", "Opcodes_p3.csv"]
+HEADER = os.path.join(ROOT, "ColoRat09", "Mc6809.h")
+OUTPUT = os.path.join(ROOT, "ColoRat09", "Mc6809OpCodes.cpp")
+DISPATCH = os.path.join(ROOT, "ColoRat09", "Mc6809Dispatch.h")
+
+# base names in the sheets that share one handler with an alias mnemonic
+ALIASES = {
+	"LSL":  "ASL_LSL",
+	"LSLA": "ASLA_LSLA",
+	"LSLB": "ASLB_LSLB",
+	"BCC":  "BHS_BCC",
+	"BCS":  "BLO_BCS",
+	"LBCC": "LBHS_LBCC",
+	"LBCS": "LBCS_LBLO",
+}
+
+# opcodes whose cost is not fixed. 99 = depends on post byte, 0 = open ended
+# (waits on an interrupt line). Anything not listed costs exactly its cycles.
+VARIABLE = {
+	"PSHS": 99, "PULS": 99, "PSHU": 99, "PULU": 99,
+	"SYNC": 0, "CWAI": 0,
+	"RTI": 15,
+}
+
+# undocumented $3E RESET, only built when USE_RESET_3E is defined
+RESET_3E = ("RESET", "RESET_inh", 19, 19, 1)
+RESET_3E_ROW = '"RESET",RESET,19,1 ,INH    '
+
+
+# indexed post byte, low 4 bits with bit 7 set:
+#	(syntax, offset kind, step, direct cycles, indirect cycles, program bytes)
+#	cycles are the extra cycles over the base indexed cost, None = illegal
+INDEXED = {
+	0x0: (",R+",   "NO_OFFSET",    1,    2, None, 0),
+	0x1: (",R++",  "NO_OFFSET",    2,    3,    6, 0),
+	0x2: (",-R",   "NO_OFFSET",   -1,    2, None, 0),
+	0x3: (",--R",  "NO_OFFSET",   -2,    3,    6, 0),
+	0x4: (",R",    "NO_OFFSET",    0,    0,    3, 0),
+	0x5: ("B,R",   "OFFSET_B",     0,    1,    4, 0),
+	0x6: ("A,R",   "OFFSET_A",     0,    1,    4, 0),
+	0x8: ("n8,R",  "OFFSET_8BIT",  0,    1,    4, 1),
+	0x9: ("n16,R", "OFFSET_16BIT", 0,    4,    7, 2),
+	0xB: ("D,R",   "OFFSET_D",     0,    4,    7, 0),
+	0xC: ("n8,PCR",  "OFFSET_8BIT",  0,  1,    4, 1),
+	0xD: ("n16,PCR", "OFFSET_16BIT", 0,  5,    8, 2),
+	0xF: ("n16",   "OFFSET_16BIT", 0, None,    5, 2),
+}
+
+
+def indexed(postByte):
+	reg = "XYUS"[(postByte >> 5) & 0x03]
+
+	if (postByte & 0x80) == 0:
+		offset = postByte & 0x1f
+		offset = offset - 32 if offset & 0x10 else offset
+		return ("&op::reg_" + reg, "OFFSET_5BIT", offset, 0, "false", 1, 0, "%d,%s" % (offset, reg))
+
+	mode = INDEXED.get(postByte & 0x0f)
+	indirect = (postByte & 0x10) != 0
+	if mode is None or mode[4 if indirect else 3] is None:
+		return ("nullptr", "ILLEGAL", 0, 0, "false", 0, 0, "illegal")
+
+	syntax, kind, step, cycles, indCycles, pgmBytes = mode
+	if syntax.endswith("PCR"):
+		base = "&op::reg_PC"
+	elif postByte & 0x0f == 0xf:
+		base = "nullptr"
+	else:
+		base = "&op::reg_" + reg
+		syntax = syntax.replace("R", reg)
+	if indirect:
+		syntax = "[" + syntax + "]"
+	return (base, kind, 0, step, "true" if indirect else "false",
+			indCycles if indirect else cycles, pgmBytes, syntax)
+
+
+def read_sheet(name, raw=False):
+	rows = []
+	with open(os.path.join(ROOT, name)) as sheet:
+		for line in sheet:
+			if not line.strip():
+				continue
+			if raw:
+				rows.append(line.rstrip("\r\n"))
+				continue
+			cols = [c.strip() for c in line.split(",")]
+			rows.append((cols[0].strip('"'), cols[1], int(cols[2]), int(cols[3]), cols[4]))
+	if len(rows) != 256:
+		sys.exit("%s: expected 256 opcodes, found %d" % (name, len(rows)))
+	return rows
+
+
+def cstring(text):
+	return '"' + text.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
+
+def entry(page, row):
+	mnemonic, base, cycles, pgmBytes, mode = row
+
+	if base == "nullptr":
+		return (mnemonic, None, cycles, cycles, pgmBytes)
+	if base == "XXX":
+		return (mnemonic, "XXX", cycles, cycles, pgmBytes)
+
+	handler = ALIASES.get(base, base) + "_" + mode.lower()
+
+	if mode == "IDX":
+		maxCycles = 99
+	elif base in VARIABLE:
+		maxCycles = VARIABLE[base]
+	elif page == 1 and mode == "REL" and base != "LBRN":
+		maxCycles = cycles + 1				# one more when the branch is taken
+	else:
+		maxCycles = cycles
+	return (mnemonic, handler, cycles, maxCycles, pgmBytes)
+
+
+def hot(e):
+	handler = "nullptr" if e[1] is None else "&op::" + e[1]
+	return "{ %-20s,%3d,%3d,%2d }" % (handler, e[2], e[3], e[4])
+
+
+def main():
+	declared = set(re.findall(r"uint8_t\s+(\w+)\(\);", open(HEADER).read()))
+	pages = [[entry(p, r) for r in read_sheet(s)] for p, s in enumerate(SHEETS)]
+
+	for p, page in enumerate(pages):
+		for code, e in enumerate(page):
+			if e[1] is not None and e[1] not in declared:
+				sys.exit("%s $%02X: no handler Mc6809::%s()" % (SHEETS[p], code, e[1]))
+
+	out = []
+	out.append("""/******************************************************************************
+*		   File: Mc6809OpCodes.cpp
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/14
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+//	GENERATED FILE - DO NOT EDIT.
+//
+//	Built by GenOpCodes.py from Opcodes_p1.csv, Opcodes_p2.csv and
+// Opcodes_p3.csv. Edit the sheets and re-run the script instead.
+//*****************************************************************************
+#include "Mc6809.h"
+
+using op = Mc6809;
+""")
+
+	out.append("""
+//*****************************************************************************
+//	OpCode[page][opcode]
+//*****************************************************************************
+//	Hot dispatch table: handler, min cycles, max cycles, program bytes.
+//	max cycles: 99 = variable (post byte dependent), 0 = open ended
+//*****************************************************************************
+constexpr Mc6809::OPCODE Mc6809::OpCode[3][256] =
+{""")
+	for p, page in enumerate(pages):
+		out.append("\t{\t// page %d%s" % (p + 1, ["", " - $10 prefix", " - $11 prefix"][p]))
+		for code, e in enumerate(page):
+			if p == 0 and code == 0x3e:
+				out.append("#ifdef USE_RESET_3E")
+				out.append("\t\t%s,\t// $%02X %s" % (hot(RESET_3E), code, RESET_3E[0]))
+				out.append("#else")
+				out.append("\t\t%s,\t// $%02X %s" % (hot(e), code, e[0]))
+				out.append("#endif")
+			else:
+				out.append("\t\t%s,\t// $%02X %s" % (hot(e), code, e[0]))
+		out.append("\t},")
+	out.append("};")
+
+	out.append("""
+
+//*****************************************************************************
+//	OpCodeName[page][opcode]
+//*****************************************************************************
+//	Cold table: mnemonics, only needed by debuggers and disassembly.
+//*****************************************************************************
+constexpr const char* const Mc6809::OpCodeName[3][256] =
+{""")
+	for p, page in enumerate(pages):
+		out.append("\t{\t// page %d" % (p + 1))
+		for row in range(0, 256, 8):
+			names = ['%-12s' % ('"%s",' % page[code][0]) for code in range(row, row + 8)]
+			if p == 0 and row <= 0x3e < row + 8:
+				split = 0x3e - row
+				out.append("\t\t" + " ".join(names[:split]).rstrip())
+				out.append("#ifdef USE_RESET_3E")
+				out.append('\t\t"%s",' % RESET_3E[0])
+				out.append("#else")
+				out.append("\t\t" + names[split].rstrip())
+				out.append("#endif")
+				out.append("\t\t" + " ".join(names[split + 1:]).rstrip())
+			else:
+				out.append("\t\t" + " ".join(names).rstrip())
+		out.append("\t},")
+	out.append("};")
+
+	out.append("""
+
+//*****************************************************************************
+//	IndexedModes[postbyte]
+//*****************************************************************************
+//	Indexed addressing post byte: base register, offset kind, 5 bit offset,
+// auto increment (+) / decrement (-), indirect, extra cycles, extra program
+// bytes.
+//*****************************************************************************
+constexpr Mc6809::IDXMODE Mc6809::IndexedModes[256] =
+{""")
+	for postByte in range(256):
+		m = indexed(postByte)
+		out.append("\t{ %-13s %-18s %3d, %2d, %-6s %d, %d },\t// $%02X %s" % (
+			m[0] + ",", "IDX::" + m[1] + ",", m[2], m[3], m[4] + ",", m[5], m[6], postByte, m[7]))
+	out.append("};")
+
+	out.append("""
+
+#ifdef USE_OPCODE_PROFILE
+//*****************************************************************************
+//	OpCodeSheet[page][opcode]
+//*****************************************************************************
+//	Cold table: each opcode's row as it reads in its CSV sheet, so the
+// profile can be written out in the same layout (see Mc6809Profile.cpp).
+//*****************************************************************************
+constexpr const char* const Mc6809::OpCodeSheet[3][256] =
+{""")
+	for p, sheet in enumerate(SHEETS):
+		out.append("\t{\t// %s" % sheet)
+		for code, row in enumerate(read_sheet(sheet, True)):
+			if p == 0 and code == 0x3e:
+				out.append("#ifdef USE_RESET_3E")
+				out.append("\t\t%s," % cstring(RESET_3E_ROW))
+				out.append("#else")
+				out.append("\t\t%s," % cstring(row))
+				out.append("#endif")
+			else:
+				out.append("\t\t%s," % cstring(row))
+		out.append("\t},")
+	out.append("};")
+
+	out.append("""
+
+//*****************************************************************************
+//	IndexedName[postbyte]
+//*****************************************************************************
+//	Cold table: assembler syntax of each indexed post byte.
+//*****************************************************************************
+constexpr const char* const Mc6809::IndexedName[256] =
+{""")
+	for row in range(0, 256, 8):
+		names = ['%-12s' % (cstring(indexed(postByte)[7]) + ",") for postByte in range(row, row + 8)]
+		out.append("\t" + " ".join(names).rstrip())
+	out.append("};")
+	out.append("#endif")
+
+	with open(OUTPUT, "w", newline="\n") as gen:
+		gen.write("\n".join(out) + "\n")
+
+	out = []
+	out.append("""/******************************************************************************
+*		   File: Mc6809Dispatch.h
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/21
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+//	GENERATED FILE - DO NOT EDIT.
+//
+//	Built by GenOpCodes.py from Opcodes_p1.csv, Opcodes_p2.csv and
+// Opcodes_p3.csv. Edit the sheets and re-run the script instead.
+//
+//	DISPATCH(page, opcode, handler) for every opcode of every page, in table
+// order. Only included by Mc6809.cpp, which defines DISPATCH first, so there
+// is no include guard.
+//*****************************************************************************""")
+	for p, page in enumerate(pages):
+		out.append("")
+		out.append("// page %d%s" % (p + 1, ["", " - $10 prefix", " - $11 prefix"][p]))
+		for code, e in enumerate(page):
+			handler = "XXX" if e[1] is None else e[1]
+			line = "DISPATCH(%d, 0x%02X, %s)" % (p, code, handler)
+			if p == 0 and code == 0x3e:
+				out.append("#ifdef USE_RESET_3E")
+				out.append("DISPATCH(%d, 0x%02X, %s)" % (p, code, RESET_3E[1]))
+				out.append("#else")
+				out.append(line)
+				out.append("#endif")
+			else:
+				out.append(line)
+
+	with open(DISPATCH, "w", newline="\n") as gen:
+		gen.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+	main()
@@ -0,0 +1,347 @@
+/******************************************************************************
+*		   File: TraceCheck.cpp
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*		 Author: William Barnes
+*		Created: 2020/06/21
+*	  Copyright: 2020 - under Apache 2.0 Licensing
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+* Modifications: (Who, whenm, what)
+*
+******************************************************************************/
+//	Conformance: runs a 6809 test program on Mc6809 one instruction at a time
+// and checks the registers and cycle count after every instruction against a
+// golden trace (see GoldenTrace.h), stopping at the first difference. Also
+// reports instructions per second, decoding included, so the same run times
+// the core.
+//
+//		TraceCheck record <program> <trace> [instructions]
+//		TraceCheck check <program> <trace> [run]
+//
+//	record writes the trace of a known good build, check replays it. Both
+// go through Step(), which decodes every instruction afresh. With run, check
+// drives Run() instead, so the decode and block caches are what is checked:
+// Run() is handed budgets of 1 to 64 cycles in turn, and the registers are
+// checked wherever it stops, in the middle of a block or at its end.
+//
+//	The program is a Motorola S-record file (.s19 .srec .s), or a raw binary
+// given as file@hexaddress. It runs from reset on 64K of FlatRAM; the reset
+// vector is pointed at the S9 entry or the load address unless the program
+// loads the vectors itself. Recording stops at the instruction count (1
+// million by default) or when the program idles.
+//
+//	selfmod.s19 (from selfmod.asm) patches its own code as it runs, and
+// selfmod.gt is its trace.
+//
+//	Exit code 0 for a match, 1 for a difference, 2 for anything else.
+//*****************************************************************************
+#include <chrono>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "FlatRAM.h"
+#include "GoldenTrace.h"
+#include "Mc6809.h"
+
+
+//*****************************************************************************
+//	The core with the one piece of CPU it leaves to the machine
+//*****************************************************************************
+class CheckCpu : public Mc6809
+{
+public:
+	CheckCpu(MMU* device) : Mc6809(device) {};
+
+	uint8_t HardwareRESET() override
+	{
+		Assert(LINE::RESET);
+		return(0);
+	}
+};
+
+
+//*****************************************************************************
+//	Program loading
+//*****************************************************************************
+static uint8_t Hex(const char* text)
+{
+	char value[3] = { text[0], text[1], '\0' };
+
+	return((uint8_t)strtoul(value, nullptr, 16));
+}
+
+// S1 data records and the S9 entry point, anything else is passed over
+static bool LoadSRecords(const char* fileName, uint8_t* memory, bool* loaded, int32_t& entry)
+{
+	std::FILE* file = std::fopen(fileName, "r");
+	char line[600];
+	bool any = false;
+
+	if (file == nullptr)
+		return(false);
+
+	while (std::fgets(line, sizeof(line), file) != nullptr)
+	{
+		size_t length = strcspn(line, "\r\n");
+
+		if ((length < 10) || (line[0] != 'S') || ((line[1] != '1') && (line[1] != '9')))
+			continue;
+
+		uint8_t count = Hex(&line[2]);
+		if (length < (size_t)(4 + count * 2))
+			continue;
+
+		uint16_t address = (Hex(&line[4]) << 8) | Hex(&line[6]);
+		if (line[1] == '9')
+		{
+			entry = address;
+			continue;
+		}
+
+		for (uint8_t n = 0; n < count - 3; n++)
+		{
+			memory[(uint16_t)(address + n)] = Hex(&line[8 + n * 2]);
+			loaded[(uint16_t)(address + n)] = true;
+		}
+		any = true;
+	}
+
+	std::fclose(file);
+	return(any);
+}
+
+static bool LoadBinary(const char* fileName, uint16_t address, uint8_t* memory, bool* loaded)
+{
+	std::FILE* file = std::fopen(fileName, "rb");
+	int byte;
+	uint32_t count = 0;
+
+	if (file == nullptr)
+		return(false);
+
+	while (((byte = std::fgetc(file)) != EOF) && (address + count < 0x10000))
+	{
+		memory[address + count] = (uint8_t)byte;
+		loaded[address + count] = true;
+		count++;
+	}
+
+	std::fclose(file);
+	return(count != 0);
+}
+
+static bool Load(FlatRAM& ram, const char* program)
+{
+	static bool loaded[0x10000];
+	uint8_t* memory = ram.Memory();
+	std::string name(program);
+	std::string::size_type at = name.rfind('@');
+	int32_t entry = -1;
+	bool ok;
+
+	memset(loaded, 0x00, sizeof(loaded));
+	if (at != std::string::npos)
+	{
+		entry = (uint16_t)strtoul(name.c_str() + at + 1, nullptr, 16);
+		ok = LoadBinary(name.substr(0, at).c_str(), entry, memory, loaded);
+	}
+	else
+	{
+		ok = LoadSRecords(program, memory, loaded, entry);
+		for (int32_t address = 0; (entry < 0) && (address < 0x10000); address++)
+			if (loaded[address])
+				entry = address;				// no S9, start at the lowest byte loaded
+	}
+
+	if (ok && !loaded[0xfffe] && !loaded[0xffff])
+	{
+		memory[0xfffe] = (uint8_t)(entry >> 8);
+		memory[0xffff] = (uint8_t)entry;
+	}
+	ram.MemoryChanged();
+	return(ok);
+}
+
+
+//*****************************************************************************
+//	Reporting
+//*****************************************************************************
+// cycles 0 for a state no instruction led to
+static void Print(const char* label, const Mc6809::REGISTERS& regs, const uint8_t cycles)
+{
+	printf("%-9s PC=%04X A=%02X B=%02X DP=%02X CC=%02X X=%04X Y=%04X U=%04X S=%04X",
+		label, regs.pc, regs.a, regs.b, regs.dp, regs.cc, regs.x, regs.y, regs.u, regs.s);
+	if (cycles != 0)
+		printf("  %u cycles", cycles);
+	printf("\n");
+}
+
+static bool Same(const Mc6809::REGISTERS& a, const Mc6809::REGISTERS& b)
+{
+	return((a.pc == b.pc) && (a.a == b.a) && (a.b == b.b) && (a.dp == b.dp) && (a.cc == b.cc) &&
+		(a.x == b.x) && (a.y == b.y) && (a.u == b.u) && (a.s == b.s));
+}
+
+
+//*****************************************************************************
+//	record and check
+//*****************************************************************************
+static int Record(CheckCpu& cpu, const char* traceName, const uint64_t limit)
+{
+	GoldenTrace trace;
+	Mc6809::REGISTERS regs;
+	uint64_t count = 0;
+
+	cpu.Step();										// reset sequence
+	cpu.GetRegisters(regs);
+	if (!trace.Create(traceName, regs))
+	{
+		fprintf(stderr, "can't create %s\n", traceName);
+		return(2);
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	while ((count < limit) && !cpu.Idle())
+	{
+		uint8_t cycles = cpu.Step();
+
+		cpu.GetRegisters(regs);
+		trace.Append(regs, cycles);
+		count++;
+	}
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	if (!trace.Close())
+	{
+		fprintf(stderr, "can't write %s\n", traceName);
+		return(2);
+	}
+	printf("recorded %" PRIu64 " instructions in %.3f s, %.0f instructions/s\n", count, seconds, count / seconds);
+	return(0);
+}
+
+static int Check(CheckCpu& cpu, const char* traceName, const bool run)
+{
+	GoldenTrace trace;
+	Mc6809::REGISTERS expected;
+	Mc6809::REGISTERS actual;
+	uint8_t expectedCycles = 0;
+	uint8_t cycles;
+
+	if (!trace.Open(traceName))
+	{
+		fprintf(stderr, "can't read %s\n", traceName);
+		return(2);
+	}
+
+	cpu.Step();										// reset sequence
+	cpu.GetRegisters(actual);
+	if (!Same(actual, trace.Start()))
+	{
+		printf("differs after reset\n");
+		Print("expected", trace.Start(), 0);
+		Print("actual", actual, 0);
+		return(1);
+	}
+
+	Mc6809::REGISTERS before = actual;
+	Mc6809::REGISTERS last = trace.Start();
+	bool match = true;
+	uint32_t budget = 0;
+	uint32_t owed = 0;									// cycles Run() used that the trace hasn't reached
+
+	auto start = std::chrono::steady_clock::now();
+	while (trace.Next(expected, expectedCycles))
+	{
+		last = expected;
+		if (!run)
+		{
+			cycles = cpu.Step();
+			cpu.GetRegisters(actual);
+			match = (cycles == expectedCycles) && Same(actual, expected);
+		}
+		else
+		{
+			if (owed == 0)
+			{
+				budget = (budget % 64) + 1;
+				owed = cpu.Run(budget);
+				cpu.GetRegisters(actual);
+			}
+			// Run() stopped short of this instruction, or part way through it
+			cycles = 0;
+			match = (owed >= expectedCycles);
+			owed -= match ? expectedCycles : 0;
+			if (match && (owed != 0))
+				continue;								// inside what Run() ran, not seen
+			match = match && Same(actual, expected);
+		}
+		if (!match)
+			break;
+		before = actual;
+	}
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	uint64_t count = trace.Position() - (match ? 0 : 1);
+
+	if (!match)
+	{
+		printf("differs at instruction %" PRIu64 ", PC=%04X\n", trace.Position(), before.pc);
+		Print("before", before, 0);
+		Print("expected", expected, expectedCycles);
+		Print("actual", actual, cycles);
+	}
+	else if ((owed != 0) && !(cpu.Idle() && Same(actual, last)))
+	{
+		// the trace stops where the program idles, Run() only sees that after
+		// going round the idle loop once more
+		printf("Run() went %u cycles past the end of the trace\n", owed);
+		match = false;
+	}
+	else if (trace.Position() != trace.Count())
+	{
+		printf("trace ends early, %" PRIu64 " of %" PRIu64 " instructions\n", trace.Position(), trace.Count());
+		match = false;
+	}
+	else
+		printf("matches, %" PRIu64 " instructions\n", count);
+
+	printf("%.3f s, %.0f instructions/s, trace %.2f bytes/instruction\n",
+		seconds, count / seconds, (trace.Count() != 0) ? (double)trace.Size() / trace.Count() : 0.0);
+	return(match ? 0 : 1);
+}
+
+
+int main(int argc, char* argv[])
+{
+	bool run = (argc > 4) && (strcmp(argv[1], "check") == 0) && (strcmp(argv[4], "run") == 0);
+
+	if ((argc < 4) || ((strcmp(argv[1], "record") != 0) && (strcmp(argv[1], "check") != 0)) ||
+		((strcmp(argv[1], "check") == 0) && (argc > 4) && !run))
+	{
+		fprintf(stderr, "usage: TraceCheck record <program> <trace> [instructions]\n"
+			"       TraceCheck check <program> <trace> [run]\n");
+		return(2);
+	}
+
+	FlatRAM* ram = new FlatRAM;
+	CheckCpu cpu(ram);
+	int result;
+
+	if (!Load(*ram, argv[2]))
+	{
+		fprintf(stderr, "can't load %s\n", argv[2]);
+		delete ram;
+		return(2);
+	}
+
+	if (strcmp(argv[1], "record") == 0)
+		result = Record(cpu, argv[3], (argc > 4) ? strtoull(argv[4], nullptr, 10) : 1000000);
+	else
+		result = Check(cpu, argv[3], run);
+
+	delete ram;
+	return(result);
+}
@@ -0,0 +1,37 @@
+; selfmod.asm - self-modifying code for TraceCheck run
+;
+;	Patches code in three ways while it loops: the first opcode of a
+; subroutine it has already called (a block cached earlier), an opcode
+; further on in the block doing the patching, and nothing at all on every
+; other pass through the subroutine's second opcode. A core that replays
+; stale decoded code ends with a different U.
+;
+;	selfmod.s19 is this file assembled, selfmod.gt its golden trace:
+;		TraceCheck check selfmod.s19 selfmod.gt run
+
+		org		$1000
+start	lds		#$8000
+		ldu		#$0000			; sum of A after every pass
+		ldy		#$0020			; passes
+		ldx		#sub
+loop	jsr		sub
+		ldb		,x				; INCA <-> DECA at sub
+		eorb	#$06
+		stb		,x
+		stb		patch,pcr		; and the same opcode a little further on
+		nop
+		nop
+		nop
+		nop
+patch	inca
+		leau	a,u
+		leay	-1,y
+		bne		loop
+		bra		*
+
+		org		$1040
+sub		inca					; patched
+		inca
+		rts
+
+		end		start